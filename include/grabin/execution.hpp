@@ -0,0 +1,410 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_EXECUTION_HPP_INCLUDED
+#define Z_GRABIN_EXECUTION_HPP_INCLUDED
+
+/** @file grabin/execution.hpp
+ @brief Стратегии выполнения алгоритмов
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace execution
+{
+    /// @brief Тип стратегии последовательного выполнения
+    class sequenced_policy
+    {};
+
+    /** @brief Тип стратегии параллельного выполнения
+
+    Последовательность разбивается на блоки фиксированного размера, которые
+    распределяются между потоками. Границы блоков зависят только от длины
+    последовательности и размера блока, а частичные результаты объединяются в
+    порядке следования блоков. Поэтому результат для чисел с плавающей точкой
+    воспроизводится от запуска к запуску и не зависит от количества потоков.
+
+    Потоки не создаются при каждом вызове алгоритма: используется общий пул,
+    который создаётся при первом параллельном вызове, пополняется до
+    <tt>threads() - 1</tt> потоков и существует до завершения программы.
+    Вызывающий поток тоже обрабатывает блоки. Если последовательность
+    умещается в один блок (не длиннее @c grain_size()), то она целиком
+    обрабатывается вызывающим потоком без обращения к пулу, поэтому размер
+    блока служит и порогом, ниже которого распараллеливание не применяется.
+    */
+    class parallel_policy
+    {
+    public:
+        /// @brief Размер блока по умолчанию (количество элементов)
+        static constexpr std::ptrdiff_t default_grain_size = std::ptrdiff_t(1) << 16;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор без аргументов
+        @post <tt>this->threads() == std::thread::hardware_concurrency()</tt>,
+        если это значение известно, иначе -- 1
+        @post <tt>this->grain_size() == default_grain_size</tt>
+        */
+        constexpr parallel_policy()
+         : threads_(0)
+         , grain_size_(default_grain_size)
+        {}
+
+        /** @brief Конструктор с указанием количества потоков
+        @param threads количество потоков, 0 означает количество аппаратных
+        потоков
+        @param grain_size размер блока, значения меньше единицы заменяются
+        единицей
+        */
+        constexpr explicit parallel_policy(std::size_t threads,
+                                           std::ptrdiff_t grain_size = default_grain_size)
+         : threads_(threads)
+         , grain_size_(grain_size < 1 ? 1 : grain_size)
+        {}
+
+        // Свойства
+        /// @brief Количество потоков, используемое алгоритмами
+        std::size_t threads() const
+        {
+            if(this->threads_ != 0)
+            {
+                return this->threads_;
+            }
+
+            return std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        /// @brief Количество элементов в одном блоке
+        constexpr std::ptrdiff_t grain_size() const
+        {
+            return this->grain_size_;
+        }
+
+    private:
+        std::size_t threads_;
+        std::ptrdiff_t grain_size_;
+    };
+
+    /// @brief Стратегия последовательного выполнения
+    constexpr sequenced_policy seq{};
+
+    /// @brief Стратегия параллельного выполнения с количеством потоков по умолчанию
+    constexpr parallel_policy par{};
+
+    /** @brief Класс-характеристика для определения того, является ли тип
+    стратегией выполнения
+    @tparam T тип
+    */
+    template <class T>
+    struct is_execution_policy
+     : std::false_type
+    {};
+
+    template <>
+    struct is_execution_policy<sequenced_policy>
+     : std::true_type
+    {};
+
+    template <>
+    struct is_execution_policy<parallel_policy>
+     : std::true_type
+    {};
+
+    /// @cond false
+    namespace detail
+    {
+        /* Пул потоков, общий для всех вызовов blocked_for. Потоки создаются
+        по мере необходимости и завершаются в деструкторе. Поток, ожидающий
+        завершения своих задач, сам выполняет задачи из очереди, поэтому
+        вложенные параллельные вызовы (из задач пула) не приводят к взаимной
+        блокировке, а невозможность создать поток лишь уменьшает параллелизм.
+        */
+        class thread_pool
+        {
+        public:
+            static thread_pool & instance()
+            {
+                static thread_pool pool;
+                return pool;
+            }
+
+            thread_pool() = default;
+
+            thread_pool(thread_pool const &) = delete;
+            thread_pool & operator=(thread_pool const &) = delete;
+
+            ~thread_pool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex_);
+                    this->stop_ = true;
+                }
+
+                this->work_.notify_all();
+
+                for(auto & worker : this->workers_)
+                {
+                    worker.join();
+                }
+            }
+
+            /* Выполнение task(index) для всех index из [0; count). task(0)
+            выполняется вызывающим потоком, остальные -- потоками пула.
+            Возврат происходит после завершения всех задач. task не должна
+            выбрасывать исключений.
+            */
+            template <class Task>
+            void run(std::ptrdiff_t count, Task & task)
+            {
+                auto remaining = std::ptrdiff_t(0);
+                std::exception_ptr error;
+
+                try
+                {
+                    this->reserve(static_cast<std::size_t>(count - 1));
+
+                    std::lock_guard<std::mutex> lock(this->mutex_);
+
+                    for(auto index = std::ptrdiff_t(1); index < count; ++ index)
+                    {
+                        this->queue_.emplace_back([this, &task, &remaining, index]
+                        {
+                            task(index);
+                            this->finish(remaining);
+                        });
+
+                        ++ remaining;
+                    }
+                }
+                catch(...)
+                {
+                    error = std::current_exception();
+                }
+
+                this->work_.notify_all();
+
+                if(!error)
+                {
+                    task(0);
+                }
+
+                this->wait(remaining);
+
+                if(error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+
+        private:
+            void reserve(std::size_t count)
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+
+                try
+                {
+                    while(this->workers_.size() < count)
+                    {
+                        this->workers_.emplace_back([this] { this->loop(); });
+                    }
+                }
+                catch(std::system_error &)
+                {}
+            }
+
+            void loop()
+            {
+                std::unique_lock<std::mutex> lock(this->mutex_);
+
+                for(;;)
+                {
+                    this->work_.wait(lock, [this] { return this->stop_ || !this->queue_.empty(); });
+
+                    if(this->queue_.empty())
+                    {
+                        return;
+                    }
+
+                    this->execute_front(lock);
+                }
+            }
+
+            void wait(std::ptrdiff_t const & remaining)
+            {
+                std::unique_lock<std::mutex> lock(this->mutex_);
+
+                while(remaining != 0)
+                {
+                    if(!this->queue_.empty())
+                    {
+                        this->execute_front(lock);
+                    }
+                    else
+                    {
+                        this->done_.wait(lock);
+                    }
+                }
+            }
+
+            void finish(std::ptrdiff_t & remaining)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex_);
+                    -- remaining;
+                }
+
+                this->done_.notify_all();
+            }
+
+            void execute_front(std::unique_lock<std::mutex> & lock)
+            {
+                auto job = std::move(this->queue_.front());
+                this->queue_.pop_front();
+
+                lock.unlock();
+                job();
+                lock.lock();
+            }
+
+            std::mutex mutex_;
+            std::condition_variable work_;
+            std::condition_variable done_;
+            std::deque<std::function<void()>> queue_;
+            std::vector<std::thread> workers_;
+            bool stop_ = false;
+        };
+
+        /* Применение body(first, last) ко всем блокам [first; last), на которые
+        [0; n) разбивается с шагом policy.grain_size(). Каждая задача
+        обрабатывает непрерывную группу блоков, первая группа обрабатывается
+        вызывающим потоком, остальные -- потоками общего пула. Если группа
+        одна, то пул не используется. Исключение, выброшенное при обработке
+        любой из групп, передаётся вызывающему после завершения всех задач.
+        */
+        template <class BlockFunction>
+        void blocked_for(parallel_policy const & policy, std::ptrdiff_t n, BlockFunction body)
+        {
+            if(n <= 0)
+            {
+                return;
+            }
+
+            auto const grain = policy.grain_size();
+            auto const blocks = (n - 1) / grain + 1;
+            auto const threads = std::min(blocks, static_cast<std::ptrdiff_t>(policy.threads()));
+
+            if(threads == 1)
+            {
+                for(auto first = std::ptrdiff_t(0); first < n; first += grain)
+                {
+                    body(first, std::min(n, first + grain));
+                }
+
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(threads);
+
+            auto worker = [&](std::ptrdiff_t thread_index)
+            {
+                try
+                {
+                    auto const first_block = blocks * thread_index / threads;
+                    auto const last_block = blocks * (thread_index + 1) / threads;
+
+                    for(auto block = first_block; block != last_block; ++ block)
+                    {
+                        auto const first = block * grain;
+                        auto const last = std::min(n, first + grain);
+
+                        body(first, last);
+                    }
+                }
+                catch(...)
+                {
+                    errors[thread_index] = std::current_exception();
+                }
+            };
+
+            thread_pool::instance().run(threads, worker);
+
+            for(auto const & error : errors)
+            {
+                if(error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        /* Свёртка [0; n), разбитого на блоки размера policy.grain_size().
+        reduce_block(first, last) вычисляет частичный результат для непустого
+        блока [first; last), частичные результаты объединяются слева направо
+        операцией op, начиная с init. Разбиение на блоки не зависит от
+        количества потоков, поэтому результат тоже от него не зависит.
+        */
+        template <class T, class BlockReducer, class BinaryOperation>
+        T blocked_reduce(parallel_policy const & policy, std::ptrdiff_t n, T init,
+                         BlockReducer reduce_block, BinaryOperation op)
+        {
+            if(n <= 0)
+            {
+                return init;
+            }
+
+            auto const grain = policy.grain_size();
+
+            std::vector<T> partial((n - 1) / grain + 1, init);
+
+            execution::detail::blocked_for(policy, n, [&](std::ptrdiff_t first, std::ptrdiff_t last)
+            {
+                partial[first / grain] = reduce_block(first, last);
+            });
+
+            for(auto & value : partial)
+            {
+                init = op(std::move(init), std::move(value));
+            }
+
+            return init;
+        }
+    }
+    // namespace detail
+    /// @endcond
+}
+// namespace execution
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_EXECUTION_HPP_INCLUDED
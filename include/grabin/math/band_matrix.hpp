@@ -0,0 +1,228 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_BAND_MATRIX_HPP_INCLUDED
+#define Z_GRABIN_MATH_BAND_MATRIX_HPP_INCLUDED
+
+/** @file grabin/math/band_matrix.hpp
+ @brief Ленточные матрицы
+*/
+
+#include <grabin/math/matrix.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Квадратная ленточная матрица
+    @tparam T тип элементов
+    @tparam Check стратегия проверок и обработки ошибок
+
+    Хранятся только элементы <tt>(i, j)</tt>, для которых
+    <tt>-lower_bandwidth() <= j - i <= upper_bandwidth()</tt>, остальные
+    элементы равны нулю. Элементы ленты хранятся по строкам: строка @c i
+    занимает <tt>lower_bandwidth() + upper_bandwidth() + 1</tt> элементов,
+    причём элементы за пределами матрицы в первых и последних строках
+    не используются. Трёхдиагональная матрица -- частный случай с обеими
+    ширинами, равными единице.
+
+    Объём памяти и время умножения на вектор пропорциональны
+    <tt>n * (lower_bandwidth() + upper_bandwidth() + 1)</tt>. Системы
+    уравнений с такими матрицами решаются @c linear_algebra::band_LU_solver и
+    @c linear_algebra::tridiagonal_solver.
+    */
+    template <class T, class Check = grabin::math_vector_throws_check_policy>
+    class band_matrix
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления количества элементов и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = Check;
+
+        // Создание, копирование, уничтожение
+        /** @brief Создание нулевой ленточной матрицы
+        @param n порядок матрицы
+        @param lower количество диагоналей под главной
+        @param upper количество диагоналей над главной
+        @pre <tt>n >= 0 && lower >= 0 && upper >= 0</tt>
+        @post <tt>this->dim1() == n && this->dim2() == n</tt>
+        @post <tt>this->lower_bandwidth() == lower</tt>
+        @post <tt>this->upper_bandwidth() == upper</tt>
+        */
+        band_matrix(size_type n, size_type lower, size_type upper)
+         : n_(n)
+         , lower_(lower)
+         , upper_(upper)
+         , data_(n * (lower + upper + 1), value_type(0))
+        {
+            assert(n >= 0 && lower >= 0 && upper >= 0);
+        }
+
+        // Размерность
+        /// @brief Количество строк матрицы
+        size_type dim1() const
+        {
+            return this->n_;
+        }
+
+        /// @brief Количество столбцов матрицы
+        size_type dim2() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Размерности матрицы
+        @return <tt>make_pair(this->dim1(), this->dim2())</tt>
+        */
+        std::pair<size_type, size_type> dim() const
+        {
+            return {this->dim1(), this->dim2()};
+        }
+
+        /// @brief Количество диагоналей под главной
+        size_type lower_bandwidth() const
+        {
+            return this->lower_;
+        }
+
+        /// @brief Количество диагоналей над главной
+        size_type upper_bandwidth() const
+        {
+            return this->upper_;
+        }
+
+        /** @brief Проверка принадлежности элемента ленте
+        @param row номер строки
+        @param col номер столбца
+        @return @b true, если элемент <tt>(row, col)</tt> хранится
+        */
+        bool in_band(size_type row, size_type col) const
+        {
+            return col - row <= this->upper_ && row - col <= this->lower_;
+        }
+
+        // Доступ к элементам
+        /** @brief Значение элемента
+        @param row номер строки
+        @param col номер столбца
+        @return Значение элемента, расположенного в строке @c row и столбце
+        @c col, ноль для элементов вне ленты
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+        */
+        value_type operator()(size_type row, size_type col) const
+        {
+            check_policy::check_index(*this, row, col);
+
+            return this->in_band(row, col) ? this->element(row, col) : value_type(0);
+        }
+
+        /** @brief Доступ к элементу ленты
+        @param row номер строки
+        @param col номер столбца
+        @return Ссылка на элемент, расположенный в строке @c row и столбце
+        @c col
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+        @throw std::out_of_range, если элемент не принадлежит ленте
+        */
+        value_type & operator()(size_type row, size_type col)
+        {
+            check_policy::check_index(*this, row, col);
+
+            if(!this->in_band(row, col))
+            {
+                throw std::out_of_range("band_matrix: element is outside of the band");
+            }
+
+            return this->element(row, col);
+        }
+
+    private:
+        value_type const & element(size_type row, size_type col) const
+        {
+            return this->data_[row * (this->lower_ + this->upper_ + 1) + (col - row + this->lower_)];
+        }
+
+        value_type & element(size_type row, size_type col)
+        {
+            return this->data_[row * (this->lower_ + this->upper_ + 1) + (col - row + this->lower_)];
+        }
+
+        size_type n_;
+        size_type lower_;
+        size_type upper_;
+        std::vector<value_type> data_;
+    };
+
+    /** @brief Умножение ленточной матрицы на вектор
+    @param A ленточная матрица
+    @param x вектор или выражение, результатом которого является вектор
+    @pre <tt>A.dim2() == x.dim()</tt>
+    @return Вектор размерности <tt>A.dim1()</tt>, равный <tt>A*x</tt>
+    @throw std::logic_error, если <tt>A.dim2() != x.dim()</tt>
+
+    Для каждой строки перебираются только элементы ленты.
+    */
+    template <class T, class Check, class E,
+              class = detail::enable_if_vector_expression_t<E>>
+    math_vector<T, Check>
+    operator*(band_matrix<T, Check> const & A, E const & x)
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        using size_type = typename band_matrix<T, Check>::size_type;
+
+        auto const n = A.dim1();
+
+        math_vector<T, Check> result(n, grabin::no_init);
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            auto const first = std::max(i - A.lower_bandwidth(), size_type(0));
+            auto const last = std::min(i + A.upper_bandwidth() + 1, n);
+
+            auto sum = T(0);
+
+            for(auto j = first; j < last; ++ j)
+            {
+                sum += A(i, j) * x_value[j];
+            }
+
+            result[i] = sum;
+        }
+
+        return result;
+    }
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_BAND_MATRIX_HPP_INCLUDED
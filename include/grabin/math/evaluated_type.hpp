@@ -0,0 +1,62 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_EVALUATED_TYPE_HPP_INCLUDED
+#define Z_GRABIN_MATH_EVALUATED_TYPE_HPP_INCLUDED
+
+/** @file grabin/math/evaluated_type.hpp
+ @brief Класс-характеристика для определения типа значения, в котором следует
+ хранить результат вычисления выражения
+*/
+
+#include <type_traits>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Класс-характеристика для определения типа значения, в котором
+    следует хранить результат вычисления выражения
+    @tparam T тип выражения
+
+    Операции над некоторыми типами (например, математическими векторами)
+    возвращают не значения, а "ленивые" выражения, которые вычисляются только при
+    присваивании. Сохранять такие выражения в переменных-членах нельзя, так как
+    они могут ссылаться на временные объекты. Данный класс-характеристика
+    позволяет определить тип, в котором следует хранить результат. По умолчанию
+    это сам тип @c T без ссылок и cv-квалификаторов.
+    */
+    template <class T>
+    struct evaluated_type
+    {
+        /// @brief Тип-результат
+        using type = std::decay_t<T>;
+    };
+
+    /** @brief Тип-синоним для типа значения, в котором следует хранить результат
+    вычисления выражения
+    @tparam T тип выражения
+    */
+    template <class T>
+    using evaluated_type_t = typename evaluated_type<std::decay_t<T>>::type;
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_EVALUATED_TYPE_HPP_INCLUDED
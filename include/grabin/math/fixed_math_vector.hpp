@@ -0,0 +1,479 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_FIXED_MATH_VECTOR_HPP_INCLUDED
+#define Z_GRABIN_MATH_FIXED_MATH_VECTOR_HPP_INCLUDED
+
+/** @file grabin/math/fixed_math_vector.hpp
+ @brief Математический вектор, размерность которого известна на этапе
+ компиляции
+*/
+
+#include <grabin/math/math_vector.hpp>
+
+#include <array>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace detail
+    {
+        /* Объект, имеющий только размерность: позволяет проверять размерность,
+        переданную конструктору, с помощью стратегии проверок
+        */
+        template <class Size>
+        struct dimension_holder
+        {
+            Size dim() const
+            {
+                return this->value;
+            }
+
+            Size value;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Математический вектор, размерность которого известна на этапе
+    компиляции
+    @tparam T тип элементов
+    @tparam N размерность
+    @tparam CheckPolicy стратегия проверок и обработки ошибок
+
+    Элементы хранятся непосредственно в объекте, поэтому создание и копирование
+    таких векторов не требует выделения динамической памяти. Так как количество
+    итераций всех циклов известно на этапе компиляции, для небольших
+    размерностей компилятор полностью разворачивает их.
+
+    Интерфейс совпадает с интерфейсом @c math_vector, поэтому такие векторы
+    могут использоваться в обобщённом коде (например, в накопителях статистик)
+    и в выражениях, в том числе вместе с векторами динамической размерности.
+    */
+    template <class T, std::ptrdiff_t N,
+              class CheckPolicy = math_vector_throws_check_policy>
+    class fixed_math_vector
+     : grabin::operators::container_equality::enable_adl
+    {
+        static_assert(N >= 0, "Dimension must be non-negative");
+
+        using Container = std::array<T, N>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления размера и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Тип для представления разности итераторов
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief Тип неконстантного итератора
+        using iterator = typename Container::iterator;
+
+        /// @brief Тип константного итератора
+        using const_iterator = typename Container::const_iterator;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = CheckPolicy;
+
+        /// @brief Размерность
+        static constexpr size_type extent = N;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор по-умолчанию
+        @post <tt>this->dim() == N</tt>
+        @post Все элементы <tt>*this</tt> равны <tt>value_type()</tt>
+        */
+        fixed_math_vector()
+         : data_{}
+        {}
+
+        /** @brief Конструктор с явным указанием размерности
+        @param dim размерность вектора
+        @pre <tt>dim == N</tt>
+        @post Все элементы <tt>*this</tt> равны <tt>value_type()</tt>
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        @c dim не совпадает с @c N
+
+        Данный конструктор нужен для совместимости с @c math_vector.
+        */
+        explicit fixed_math_vector(size_type dim)
+         : data_{}
+        {
+            check_policy::ensure_equal_dimensions(*this, detail::dimension_holder<size_type>{dim});
+        }
+
+        /** @brief Конструктор с явным указанием размерности без инициализации
+        элементов
+        @param dim размерность вектора
+        @pre <tt>dim == N</tt>
+        @post Элементы <tt>*this</tt> инициализированы по умолчанию, то есть
+        для встроенных типов их значения не определены
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        @c dim не совпадает с @c N
+        */
+        fixed_math_vector(size_type dim, no_init_t)
+        {
+            check_policy::ensure_equal_dimensions(*this, detail::dimension_holder<size_type>{dim});
+        }
+
+        /** @brief Конструктор с явным указанием размерности и значения
+        элементов
+        @param dim размерность вектора
+        @param value значение элементов
+        @pre <tt>dim == N</tt>
+        @post Все элементы <tt>*this</tt> равны @c value
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        @c dim не совпадает с @c N
+        */
+        fixed_math_vector(size_type dim, value_type const & value)
+        {
+            check_policy::ensure_equal_dimensions(*this, detail::dimension_holder<size_type>{dim});
+
+            this->data_.fill(value);
+        }
+
+        /** @brief Конструктор на основе интервала значений
+        @param values интервал значений
+        @pre <tt>(values.end() - values.begin()) == N</tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c values
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        количество элементов @c values не совпадает с @c N
+        */
+        template <class Range, class = decltype(std::declval<Range&>().begin()),
+                  class = std::enable_if_t<!is_math_vector_expression<Range>::value>>
+        explicit fixed_math_vector(Range const & values)
+         : data_{}
+        {
+            this->assign_range(values.begin(), values.end());
+        }
+
+        /** @brief Конструктор на основе списка инициализации
+        @param values список значений
+        @pre <tt>values.size() == N</tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c values
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        количество элементов @c values не совпадает с @c N
+        */
+        fixed_math_vector(std::initializer_list<value_type> values)
+         : data_{}
+        {
+            this->assign_range(values.begin(), values.end());
+        }
+
+        /** @brief Конструктор на основе выражения
+        @param expr выражение, результатом которого является вектор
+        @pre <tt>expr.dim() == N</tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c expr
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, expr)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        fixed_math_vector(Expression const & expr)
+        {
+            *this = expr;
+        }
+
+        /// @brief Конструктор копий
+        fixed_math_vector(fixed_math_vector const &) = default;
+
+        /// @brief Оператор присваивания
+        fixed_math_vector & operator=(fixed_math_vector const &) = default;
+
+        /** @brief Присваивание выражения
+        @param expr выражение, результатом которого является вектор
+        @pre <tt>expr.dim() == N</tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c expr
+        @return <tt>*this</tt>
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, expr)</tt>
+
+        Выражение может содержать ссылки на <tt>*this</tt>.
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        fixed_math_vector & operator=(Expression const & expr)
+        {
+            check_policy::ensure_equal_dimensions(*this, expr);
+
+            this->assign_elementwise(expr, [](value_type & x, auto const & y) { x = y; });
+            return *this;
+        }
+
+        // Размер
+        //@{
+        /// @brief Размерность вектора
+        static constexpr size_type dim()
+        {
+            return N;
+        }
+
+        static constexpr size_type size()
+        {
+            return N;
+        }
+        //@}
+
+        // Доступ к данным
+        //@{
+        /** @brief Индексированный доступ к данным
+        @param index индекс элемента
+        @return Ссылка на элемент с индексом @c index
+        @throw То же, что <tt>check_policy::check_index(*this, index)</tt>
+        */
+        value_type & operator[](size_type index)
+        {
+            return const_cast<value_type&>(grabin::as_const(*this)[index]);
+        }
+
+        value_type const & operator[](size_type index) const
+        {
+            check_policy::check_index(*this, index);
+
+            return this->data_[index];
+        }
+        //@}
+
+        //@{
+        /** @brief Индексированный доступ к данным c проверкой индекса
+        @param index индекс элемента
+        @return Ссылка на элемент с индексом @c index
+        std::out_of_range, если @c index не принадлежит интервалу
+        <tt>[0;N)</tt>
+        */
+        value_type & at(size_type index)
+        {
+            return const_cast<value_type&>(grabin::as_const(*this).at(index));
+        }
+
+        value_type const & at(size_type index) const
+        {
+            if(index < 0 || this->dim() <= index)
+            {
+                throw std::out_of_range("fixed_math_vector::at - Invalid index");
+            }
+
+            return this->data_[index];
+        }
+        //@}
+
+        //@{
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент вектора
+        */
+        value_type * data()
+        {
+            return this->data_.data();
+        }
+
+        value_type const * data() const
+        {
+            return this->data_.data();
+        }
+        //@}
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов
+        iterator begin()
+        {
+            return this->data_.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return this->data_.begin();
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+        //@}
+
+        //@{
+        /// @brief Итератор конца последовательности элементов
+        iterator end()
+        {
+            return this->data_.end();
+        }
+
+        const_iterator end() const
+        {
+            return this->data_.end();
+        }
+
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+        //@}
+
+        // Линейные операции
+        /** @brief Умножение вектора на скаляр
+        @param a скаляр
+        @return <tt> *this </tt>
+        @post Каждый элемент <tt>*this</tt> умножается на @c a
+        */
+        fixed_math_vector & operator*=(value_type const & a)
+        {
+            for(auto & x : this->data_)
+            {
+                x *= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Деление вектора на скаляр
+        @param a скаляр
+        @return <tt> *this </tt>
+        @post Каждый элемент <tt>*this</tt> делится на @c a
+        */
+        fixed_math_vector & operator/=(value_type const & a)
+        {
+            check_policy::check_division_by_zero(a);
+
+            for(auto & x : this->data_)
+            {
+                x /= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Прибавление выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == N</tt>
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        fixed_math_vector & operator+=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](value_type & a, auto const & b) { a += b; });
+
+            return *this;
+        }
+
+        /** @brief Вычитание выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == N</tt>
+        @return <tt>*this</tt>
+        @post Из каждого элемента <tt>*this</tt> вычитаются соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        fixed_math_vector & operator-=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](value_type & a, auto const & b) { a -= b; });
+
+            return *this;
+        }
+
+    private:
+        friend struct detail::math_vector_access;
+
+        value_type const & element(size_type index) const
+        {
+            return this->data_[index];
+        }
+
+        template <class Iterator>
+        void assign_range(Iterator first, Iterator last)
+        {
+            check_policy::ensure_equal_dimensions(*this,
+                detail::dimension_holder<size_type>{static_cast<size_type>(std::distance(first, last))});
+
+            std::copy(first, last, this->data_.begin());
+        }
+
+        template <class Expression, class Assign>
+        void assign_elementwise(Expression const & expr, Assign assign)
+        {
+            assert(expr.dim() == N);
+
+            for(auto index = size_type(0); index != N; ++ index)
+            {
+                assign(this->data_[index], detail::math_vector_access::element(expr, index));
+            }
+        }
+
+        Container data_;
+    };
+
+    template <class T, std::ptrdiff_t N, class Check>
+    constexpr typename fixed_math_vector<T, N, Check>::size_type
+    fixed_math_vector<T, N, Check>::extent;
+
+    template <class T, std::ptrdiff_t N, class Check>
+    struct is_math_vector_expression<fixed_math_vector<T, N, Check>>
+     : std::true_type
+    {};
+
+    /// @cond false
+    namespace detail
+    {
+        template <class T, std::ptrdiff_t N, class Check, class Value>
+        struct rebind_math_vector<fixed_math_vector<T, N, Check>, Value>
+        {
+            using type = fixed_math_vector<Value, N, Check>;
+        };
+
+        // Размерность, известная на этапе компиляции, сохраняется в результате
+        template <class T1, class Check, class A, class T2, std::ptrdiff_t N>
+        struct common_math_vector<math_vector<T1, Check, A>, fixed_math_vector<T2, N, Check>>
+        {
+            using type = fixed_math_vector<T2, N, Check>;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Специализация класса-характеристики для определения типа среднего
+    для векторов фиксированной размерности
+    @tparam T тип элементов
+    @tparam N размерность
+    @tparam Check тип стратегии проверок
+    @tparam W тип весов
+    */
+    template <class T, std::ptrdiff_t N, class Check, class W>
+    struct average_type<fixed_math_vector<T, N, Check>, W>
+    {
+        /// @brief Тип-результат
+        using type = fixed_math_vector<grabin::average_type_t<T, W>, N, Check>;
+    };
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_FIXED_MATH_VECTOR_HPP_INCLUDED
@@ -0,0 +1,391 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_FIXED_MATRIX_HPP_INCLUDED
+#define Z_GRABIN_MATH_FIXED_MATRIX_HPP_INCLUDED
+
+/** @file grabin/math/fixed_matrix.hpp
+ @brief Матрица, размерности которой известны на этапе компиляции
+*/
+
+#include <grabin/math/fixed_math_vector.hpp>
+#include <grabin/math/matrix.hpp>
+
+#include <array>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Матрица, размерности которой известны на этапе компиляции
+    @tparam T тип элементов
+    @tparam Rows количество строк
+    @tparam Cols количество столбцов
+    @tparam Check стратегия проверок и обработки ошибок
+
+    Элементы хранятся непосредственно в объекте, без выделения динамической
+    памяти. Интерфейс совпадает с интерфейсом @c matrix.
+    */
+    template <class T, std::ptrdiff_t Rows, std::ptrdiff_t Cols,
+              class Check = grabin::math_vector_throws_check_policy>
+    class fixed_matrix
+     : grabin::operators::container_equality::enable_adl
+    {
+        using Data = std::array<T, Rows * Cols>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления количества элементов и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Тип неконстатного итератора
+        using iterator = typename Data::iterator;
+
+        /// @brief Тип констатного итератора
+        using const_iterator = typename Data::const_iterator;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = Check;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор без параметров
+        @post Все элементы <tt>*this</tt> равны <tt>value_type()</tt>
+        */
+        fixed_matrix()
+         : data_{}
+        {}
+
+        /** @brief Конструктор с указанием размерностей
+        @param rows количество строк
+        @param cols количество столбцов
+        @pre <tt>rows == Rows</tt>
+        @pre <tt>cols == Cols</tt>
+        @post Все элементы <tt>*this</tt> равны <tt>value_type()</tt>
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        размерности не совпадают с заданными параметрами шаблона
+
+        Данный конструктор нужен для совместимости с @c matrix.
+        */
+        fixed_matrix(size_type rows, size_type cols)
+         : data_{}
+        {
+            using Dims = std::pair<size_type, size_type>;
+            check_policy::ensure_equal_dimensions(*this, detail::dimension_holder<Dims>{{rows, cols}});
+        }
+
+        /** @brief Конструктор с указанием размерностей без инициализации
+        элементов
+        @param rows количество строк
+        @param cols количество столбцов
+        @pre <tt>rows == Rows</tt>
+        @pre <tt>cols == Cols</tt>
+        @post Элементы <tt>*this</tt> инициализированы по умолчанию, то есть
+        для встроенных типов их значения не определены
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions</tt>, если
+        размерности не совпадают с заданными параметрами шаблона
+        */
+        fixed_matrix(size_type rows, size_type cols, no_init_t)
+        {
+            using Dims = std::pair<size_type, size_type>;
+            check_policy::ensure_equal_dimensions(*this, detail::dimension_holder<Dims>{{rows, cols}});
+        }
+
+        // Размерность
+        /// @brief Количество строк матрицы
+        static constexpr size_type dim1()
+        {
+            return Rows;
+        }
+
+        /// @brief Количество столбцов матрицы
+        static constexpr size_type dim2()
+        {
+            return Cols;
+        }
+
+        /** @brief Размерности матрицы
+        @return <tt>make_pair(this->dim1(), this->dim2())</tt>
+        */
+        std::pair<size_type, size_type> dim() const
+        {
+            return {this->dim1(), this->dim2()};
+        }
+
+        /// @brief Количество элементов матрицы
+        static constexpr size_type size()
+        {
+            return Rows * Cols;
+        }
+
+        // Доступ к элементам
+        //@{
+        /** @brief Доступ к элементам
+        @param rows номер строки
+        @param cols номер столбца
+        @return Ссылка на элемент, расположенный в строке @c row и столбце @c col
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+        */
+        value_type const & operator()(size_type row, size_type col) const
+        {
+            check_policy::check_index(*this, row, col);
+            return this->data_[row*Cols + col];
+        }
+
+        value_type & operator()(size_type row, size_type col)
+        {
+            return const_cast<value_type&>(grabin::as_const(*this)(row, col));
+        }
+        //@}
+
+        //@{
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент матрицы, элементы хранятся по
+        строкам
+        */
+        value_type * data()
+        {
+            return this->data_.data();
+        }
+
+        value_type const * data() const
+        {
+            return this->data_.data();
+        }
+        //@}
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов
+        iterator begin()
+        {
+            return this->data_.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return this->data_.begin();
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+        //@}
+
+        //@{
+        /// @brief Итератор конца последовательности элементов
+        iterator end()
+        {
+            return this->data_.end();
+        }
+
+        const_iterator end() const
+        {
+            return this->data_.end();
+        }
+
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+        //@}
+
+        // Линейные операции
+        /** @brief Умножение матрицы на скаляр
+        @param a скаляр
+        @post Каждый элементы <tt>*this</tt> умножается на @c y
+        @return <tt>*this</tt>
+        */
+        fixed_matrix & operator*=(value_type const & a)
+        {
+            for(auto & x : this->data_)
+            {
+                x *= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Деление матрицы на скаляр
+        @param a скаляр
+        @post Каждый элементы <tt>*this</tt> делится на @c y
+        @return <tt>*this</tt>
+        */
+        fixed_matrix & operator/=(value_type const & a)
+        {
+            check_policy::check_division_by_zero(a);
+
+            for(auto & x : this->data_)
+            {
+                x /= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Прибавление матрицы
+        @param x вектор
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        */
+        fixed_matrix & operator+=(fixed_matrix const & x)
+        {
+            for(auto index = size_type(0); index != this->size(); ++ index)
+            {
+                this->data_[index] += x.data_[index];
+            }
+
+            return *this;
+        }
+
+    private:
+        Data data_;
+    };
+
+    // Линейные операции
+    //@{
+    /** @brief Умножение матрицы на скаляр
+    @param x матрица
+    @param a скаляр
+    @return Матрица, элементы которой равны соответствующим элементам @c x,
+    умноженным на скаляр @c a.
+    */
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t C, class Check>
+    fixed_matrix<T, R, C, Check>
+    operator*(fixed_matrix<T, R, C, Check> x,
+              typename fixed_matrix<T, R, C, Check>::value_type const & a)
+    {
+        x *= a;
+        return x;
+    }
+
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t C, class Check>
+    fixed_matrix<T, R, C, Check>
+    operator*(typename fixed_matrix<T, R, C, Check>::value_type const & a,
+              fixed_matrix<T, R, C, Check> const & x)
+    {
+        return x * a;
+    }
+    //@}
+
+    /** @brief Деление матрицы на скаляр
+    @param x матрица
+    @param a скаляр
+    @return Матрица, элементы которой равны соответствующим элементам @c x,
+    делённым на скаляр @c a.
+    */
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t C, class Check>
+    fixed_matrix<T, R, C, Check>
+    operator/(fixed_matrix<T, R, C, Check> x,
+              typename fixed_matrix<T, R, C, Check>::value_type const & a)
+    {
+        x /= a;
+        return x;
+    }
+
+    /** @brief Оператор сложения двух матриц
+    @param x, y слагаемые
+    @return Матрица, элементы которой равны сумме соответствующих элементов
+    слагаемых.
+    */
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t C, class Check>
+    fixed_matrix<T, R, C, Check>
+    operator+(fixed_matrix<T, R, C, Check> x, fixed_matrix<T, R, C, Check> const & y)
+    {
+        x += y;
+        return x;
+    }
+
+    /** @brief Умножение матрицы не вектор
+    @param A матрица
+    @param x вектор
+    @return Вектор размерности @c R, равный произведению матрицы @c A на
+    вектор @c x
+
+    Совпадение размерностей проверяется на этапе компиляции.
+    */
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t C, class Check>
+    fixed_math_vector<T, R, Check>
+    operator*(fixed_matrix<T, R, C, Check> const & A, fixed_math_vector<T, C, Check> const & x)
+    {
+        fixed_math_vector<T, R, Check> result(R, grabin::no_init);
+
+        detail::matrix_vector_product(A, x, result);
+
+        return result;
+    }
+
+    /** @brief Умножение матриц
+    @param A, B матрицы
+    @return Матрица размера <tt>R x C</tt>, равная произведению @c A на @c B
+
+    Совпадение размерностей проверяется на этапе компиляции.
+    */
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t K, std::ptrdiff_t C, class Check>
+    fixed_matrix<T, R, C, Check>
+    operator*(fixed_matrix<T, R, K, Check> const & A, fixed_matrix<T, K, C, Check> const & B)
+    {
+        fixed_matrix<T, R, C, Check> result(R, C, grabin::no_init);
+
+        detail::matrix_matrix_product(A, B, result);
+
+        return result;
+    }
+
+    /** @brief Транспонирование матрицы
+    @param A матрица
+    @return Матрица размера <tt>C x R</tt>, такая что <tt>B(j, i) == A(i, j)</tt>
+    */
+    template <class T, std::ptrdiff_t R, std::ptrdiff_t C, class Check>
+    fixed_matrix<T, C, R, Check>
+    transpose(fixed_matrix<T, R, C, Check> const & A)
+    {
+        fixed_matrix<T, C, R, Check> result(C, R, grabin::no_init);
+
+        kernels::transpose(R, C, A.data(), C, result.data(), R);
+
+        return result;
+    }
+
+namespace linear_algebra
+{
+    /** @brief Специализация класса-характеристики для определения типа
+    внешнего произведения векторов фиксированной размерности
+    @tparam T тип элементов
+    @tparam N размерность
+    @tparam Check стратегия проверок
+    */
+    template <class T, std::ptrdiff_t N, class Check>
+    struct outer_product_type<fixed_math_vector<T, N, Check>>
+    {
+        /// @brief Тип-результат
+        using type = fixed_matrix<T, N, N>;
+    };
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_FIXED_MATRIX_HPP_INCLUDED
@@ -0,0 +1,1621 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_KERNELS_HPP_INCLUDED
+#define Z_GRABIN_MATH_KERNELS_HPP_INCLUDED
+
+/** @file grabin/math/kernels.hpp
+ @brief Низкоуровневые вычислительные ядра для непрерывных массивов чисел
+
+ Ядра работают с указателями и количеством элементов и не выполняют никаких
+ проверок. Для @c float и @c double используются векторные инструкции SSE2
+ или AVX (если при компиляции задан ключ <tt>-mavx2</tt> или аналогичный),
+ для остальных типов -- обобщённые реализации. Векторные инструкции можно
+ отключить, определив макрос @c GRABIN_NO_SIMD.
+*/
+
+#include <grabin/memory.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#if !defined(GRABIN_NO_SIMD)
+#   if defined(__AVX2__)
+#       define GRABIN_SIMD_AVX 1
+#       include <immintrin.h>
+#   elif defined(__SSE2__) || defined(_M_X64)
+#       define GRABIN_SIMD_SSE2 1
+#       include <emmintrin.h>
+#   endif
+#endif
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace kernels
+{
+    /// @brief Тип для представления количества элементов в ядрах
+    using size_type = std::ptrdiff_t;
+
+    // Обобщённые реализации
+    /** @brief Скалярное произведение
+    @param n количество элементов
+    @param x, y указатели на начала массивов
+    @return Сумма <tt>x[i] * y[i]</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    T dot(size_type n, T const * x, T const * y)
+    {
+        auto result = T(0);
+
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            result += x[i] * y[i];
+        }
+
+        return result;
+    }
+
+    /** @brief Прибавление массива, умноженного на скаляр
+    @param n количество элементов
+    @param a скаляр
+    @param x указатель на начало массива-слагаемого
+    @param y указатель на начало изменяемого массива
+    @post <tt>y[i] += a * x[i]</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    void axpy(size_type n, T const & a, T const * x, T * y)
+    {
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            y[i] += a * x[i];
+        }
+    }
+
+    /** @brief Поэлементное прибавление массива
+    @param n количество элементов
+    @param x указатель на начало массива-слагаемого
+    @param y указатель на начало изменяемого массива
+    @post <tt>y[i] += x[i]</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    void add(size_type n, T const * x, T * y)
+    {
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            y[i] += x[i];
+        }
+    }
+
+    /** @brief Поэлементное вычитание массива
+    @param n количество элементов
+    @param x указатель на начало массива-вычитаемого
+    @param y указатель на начало изменяемого массива
+    @post <tt>y[i] -= x[i]</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    void subtract(size_type n, T const * x, T * y)
+    {
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            y[i] -= x[i];
+        }
+    }
+
+    /** @brief Умножение массива на скаляр
+    @param n количество элементов
+    @param a скаляр
+    @param x указатель на начало изменяемого массива
+    @post <tt>x[i] *= a</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    void scale(size_type n, T const & a, T * x)
+    {
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            x[i] *= a;
+        }
+    }
+
+    /** @brief Деление массива на скаляр
+    @param n количество элементов
+    @param a скаляр
+    @param x указатель на начало изменяемого массива
+    @pre <tt>a != 0</tt>
+    @post <tt>x[i] /= a</tt> для всех @c i из <tt>[0; n)</tt>
+
+    Для чисел с плавающей точкой вместо деления выполняется умножение на
+    обратную величину, поэтому результат может отличаться от точного частного
+    в последнем разряде.
+    */
+    template <class T>
+    void divide(size_type n, T const & a, T * x)
+    {
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            x[i] /= a;
+        }
+    }
+
+    /** @brief Сумма элементов
+    @param n количество элементов
+    @param x указатель на начало массива
+    @return Сумма <tt>x[i]</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    T sum(size_type n, T const * x)
+    {
+        auto result = T(0);
+
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            result += x[i];
+        }
+
+        return result;
+    }
+
+    /** @brief Сумма модулей
+    @param n количество элементов
+    @param x указатель на начало массива
+    @return Сумма <tt>|x[i]|</tt> для всех @c i из <tt>[0; n)</tt>
+    */
+    template <class T>
+    T asum(size_type n, T const * x)
+    {
+        using std::abs;
+
+        auto result = T(0);
+
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            result += abs(x[i]);
+        }
+
+        return result;
+    }
+
+    /** @brief Применение вращения Гивенса
+    @param n количество элементов
+    @param x, y указатели на начала изменяемых массивов
+    @param c, s косинус и синус угла поворота
+    @post Для всех @c i из <tt>[0; n)</tt> пара <tt>(x[i], y[i])</tt> заменяется
+    на <tt>(c*x[i] + s*y[i], c*y[i] - s*x[i])</tt>
+    */
+    template <class T>
+    void rot(size_type n, T * x, T * y, T const & c, T const & s)
+    {
+        for(auto i = size_type(0); i != n; ++ i)
+        {
+            auto const xi = x[i];
+            auto const yi = y[i];
+
+            x[i] = c * xi + s * yi;
+            y[i] = c * yi - s * xi;
+        }
+    }
+
+    /** @brief Произведение матриц: <tt>C = alpha*A*B + beta*C</tt>
+    @param m, n, k размерности: @c A имеет размер <tt>m x k</tt>, @c B --
+    <tt>k x n</tt>, @c C -- <tt>m x n</tt>
+    @param alpha, beta скаляры
+    @param a, a_row_stride, a_col_stride указатель на первый элемент @c A и
+    шаги между соседними строками и столбцами: элемент <tt>A(i, p)</tt>
+    равен <tt>a[i*a_row_stride + p*a_col_stride]</tt>
+    @param b, b_row_stride, b_col_stride то же для матрицы @c B
+    @param c, ldc указатель на первый элемент @c C, хранящейся по строкам, и
+    расстояние между началами соседних строк @c C
+    @pre Массив @c C не пересекается с массивами @c A и @c B
+
+    Шаги позволяют использовать матрицы, хранящиеся как по строкам, так и по
+    столбцам. Если <tt>beta == 0</tt>, то исходные значения элементов @c C не
+    читаются, поэтому они могут быть не инициализированы.
+    */
+    template <class T>
+    void gemm(size_type m, size_type n, size_type k, T const & alpha,
+              T const * a, size_type a_row_stride, size_type a_col_stride,
+              T const * b, size_type b_row_stride, size_type b_col_stride,
+              T const & beta, T * c, size_type ldc)
+    {
+        for(auto i = size_type(0); i != m; ++ i)
+        {
+            auto const c_row = c + i * ldc;
+
+            for(auto j = size_type(0); j != n; ++ j)
+            {
+                c_row[j] = (beta == T(0)) ? T(0) : beta * c_row[j];
+            }
+
+            for(auto p = size_type(0); p != k; ++ p)
+            {
+                auto const a_ip = alpha * a[i * a_row_stride + p * a_col_stride];
+                auto const b_row = b + p * b_row_stride;
+
+                for(auto j = size_type(0); j != n; ++ j)
+                {
+                    c_row[j] += a_ip * b_row[j * b_col_stride];
+                }
+            }
+        }
+    }
+
+    /** @brief Произведение матриц, хранящихся по строкам:
+    <tt>C = alpha*A*B + beta*C</tt>
+
+    Эквивалентно вызову варианта с шагами <tt>(lda, 1)</tt> и
+    <tt>(ldb, 1)</tt>.
+    */
+    template <class T>
+    void gemm(size_type m, size_type n, size_type k, T const & alpha,
+              T const * a, size_type lda, T const * b, size_type ldb,
+              T const & beta, T * c, size_type ldc)
+    {
+        kernels::gemm(m, n, k, alpha, a, lda, size_type(1), b, ldb, size_type(1), beta, c, ldc);
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        /* Обёртки над векторными инструкциями, позволяющие записать ядра один
+        раз для float и double.
+        */
+        template <class T>
+        struct simd;
+
+#if defined(GRABIN_SIMD_AVX)
+        template <>
+        struct simd<double>
+        {
+            using reg = __m256d;
+            static constexpr size_type width = 4;
+
+            static reg zero() { return _mm256_setzero_pd(); }
+            static reg broadcast(double a) { return _mm256_set1_pd(a); }
+            static reg load(double const * p) { return _mm256_loadu_pd(p); }
+            static void store(double * p, reg x) { _mm256_storeu_pd(p, x); }
+            static reg add(reg x, reg y) { return _mm256_add_pd(x, y); }
+            static reg sub(reg x, reg y) { return _mm256_sub_pd(x, y); }
+            static reg mul(reg x, reg y) { return _mm256_mul_pd(x, y); }
+            static reg abs(reg x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+
+            static reg fmadd(reg a, reg b, reg c)
+            {
+#   if defined(__FMA__)
+                return _mm256_fmadd_pd(a, b, c);
+#   else
+                return add(mul(a, b), c);
+#   endif
+            }
+
+            static double sum(reg x)
+            {
+                auto const r = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+                return _mm_cvtsd_f64(_mm_add_sd(r, _mm_unpackhi_pd(r, r)));
+            }
+        };
+
+        template <>
+        struct simd<float>
+        {
+            using reg = __m256;
+            static constexpr size_type width = 8;
+
+            static reg zero() { return _mm256_setzero_ps(); }
+            static reg broadcast(float a) { return _mm256_set1_ps(a); }
+            static reg load(float const * p) { return _mm256_loadu_ps(p); }
+            static void store(float * p, reg x) { _mm256_storeu_ps(p, x); }
+            static reg add(reg x, reg y) { return _mm256_add_ps(x, y); }
+            static reg sub(reg x, reg y) { return _mm256_sub_ps(x, y); }
+            static reg mul(reg x, reg y) { return _mm256_mul_ps(x, y); }
+            static reg abs(reg x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+
+            static reg fmadd(reg a, reg b, reg c)
+            {
+#   if defined(__FMA__)
+                return _mm256_fmadd_ps(a, b, c);
+#   else
+                return add(mul(a, b), c);
+#   endif
+            }
+
+            static float sum(reg x)
+            {
+                auto r = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+                r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+                return _mm_cvtss_f32(_mm_add_ss(r, _mm_shuffle_ps(r, r, 1)));
+            }
+        };
+#elif defined(GRABIN_SIMD_SSE2)
+        template <>
+        struct simd<double>
+        {
+            using reg = __m128d;
+            static constexpr size_type width = 2;
+
+            static reg zero() { return _mm_setzero_pd(); }
+            static reg broadcast(double a) { return _mm_set1_pd(a); }
+            static reg load(double const * p) { return _mm_loadu_pd(p); }
+            static void store(double * p, reg x) { _mm_storeu_pd(p, x); }
+            static reg add(reg x, reg y) { return _mm_add_pd(x, y); }
+            static reg sub(reg x, reg y) { return _mm_sub_pd(x, y); }
+            static reg mul(reg x, reg y) { return _mm_mul_pd(x, y); }
+            static reg abs(reg x) { return _mm_andnot_pd(_mm_set1_pd(-0.0), x); }
+            static reg fmadd(reg a, reg b, reg c) { return add(mul(a, b), c); }
+
+            static double sum(reg x)
+            {
+                return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+            }
+        };
+
+        template <>
+        struct simd<float>
+        {
+            using reg = __m128;
+            static constexpr size_type width = 4;
+
+            static reg zero() { return _mm_setzero_ps(); }
+            static reg broadcast(float a) { return _mm_set1_ps(a); }
+            static reg load(float const * p) { return _mm_loadu_ps(p); }
+            static void store(float * p, reg x) { _mm_storeu_ps(p, x); }
+            static reg add(reg x, reg y) { return _mm_add_ps(x, y); }
+            static reg sub(reg x, reg y) { return _mm_sub_ps(x, y); }
+            static reg mul(reg x, reg y) { return _mm_mul_ps(x, y); }
+            static reg abs(reg x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+            static reg fmadd(reg a, reg b, reg c) { return add(mul(a, b), c); }
+
+            static float sum(reg x)
+            {
+                auto const r = _mm_add_ps(x, _mm_movehl_ps(x, x));
+                return _mm_cvtss_f32(_mm_add_ss(r, _mm_shuffle_ps(r, r, 1)));
+            }
+        };
+#endif
+
+#if defined(GRABIN_SIMD_AVX) || defined(GRABIN_SIMD_SSE2)
+        /* Четыре независимых аккумулятора скрывают задержку сложения, так что
+        скорость ограничивается пропускной способностью памяти.
+        */
+        template <class T>
+        T simd_dot(size_type n, T const * x, T const * y)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto acc0 = S::zero();
+            auto acc1 = S::zero();
+            auto acc2 = S::zero();
+            auto acc3 = S::zero();
+
+            auto i = size_type(0);
+
+            for(; i + 4*w <= n; i += 4*w)
+            {
+                acc0 = S::fmadd(S::load(x + i), S::load(y + i), acc0);
+                acc1 = S::fmadd(S::load(x + i + w), S::load(y + i + w), acc1);
+                acc2 = S::fmadd(S::load(x + i + 2*w), S::load(y + i + 2*w), acc2);
+                acc3 = S::fmadd(S::load(x + i + 3*w), S::load(y + i + 3*w), acc3);
+            }
+
+            for(; i + w <= n; i += w)
+            {
+                acc0 = S::fmadd(S::load(x + i), S::load(y + i), acc0);
+            }
+
+            auto result = S::sum(S::add(S::add(acc0, acc1), S::add(acc2, acc3)));
+
+            for(; i != n; ++ i)
+            {
+                result += x[i] * y[i];
+            }
+
+            return result;
+        }
+
+        template <class T>
+        void simd_axpy(size_type n, T a, T const * x, T * y)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto const a_reg = S::broadcast(a);
+
+            auto i = size_type(0);
+
+            for(; i + 2*w <= n; i += 2*w)
+            {
+                S::store(y + i, S::fmadd(a_reg, S::load(x + i), S::load(y + i)));
+                S::store(y + i + w, S::fmadd(a_reg, S::load(x + i + w), S::load(y + i + w)));
+            }
+
+            for(; i + w <= n; i += w)
+            {
+                S::store(y + i, S::fmadd(a_reg, S::load(x + i), S::load(y + i)));
+            }
+
+            for(; i != n; ++ i)
+            {
+                y[i] += a * x[i];
+            }
+        }
+
+        template <class T>
+        void simd_add(size_type n, T const * x, T * y)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto i = size_type(0);
+
+            for(; i + w <= n; i += w)
+            {
+                S::store(y + i, S::add(S::load(y + i), S::load(x + i)));
+            }
+
+            for(; i != n; ++ i)
+            {
+                y[i] += x[i];
+            }
+        }
+
+        template <class T>
+        void simd_subtract(size_type n, T const * x, T * y)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto i = size_type(0);
+
+            for(; i + w <= n; i += w)
+            {
+                S::store(y + i, S::sub(S::load(y + i), S::load(x + i)));
+            }
+
+            for(; i != n; ++ i)
+            {
+                y[i] -= x[i];
+            }
+        }
+
+        template <class T>
+        void simd_scale(size_type n, T a, T * x)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto const a_reg = S::broadcast(a);
+
+            auto i = size_type(0);
+
+            for(; i + w <= n; i += w)
+            {
+                S::store(x + i, S::mul(S::load(x + i), a_reg));
+            }
+
+            for(; i != n; ++ i)
+            {
+                x[i] *= a;
+            }
+        }
+
+        template <class T>
+        T simd_sum(size_type n, T const * x)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto acc0 = S::zero();
+            auto acc1 = S::zero();
+
+            auto i = size_type(0);
+
+            for(; i + 2*w <= n; i += 2*w)
+            {
+                acc0 = S::add(acc0, S::load(x + i));
+                acc1 = S::add(acc1, S::load(x + i + w));
+            }
+
+            for(; i + w <= n; i += w)
+            {
+                acc0 = S::add(acc0, S::load(x + i));
+            }
+
+            auto result = S::sum(S::add(acc0, acc1));
+
+            for(; i != n; ++ i)
+            {
+                result += x[i];
+            }
+
+            return result;
+        }
+
+        template <class T>
+        T simd_asum(size_type n, T const * x)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto acc0 = S::zero();
+            auto acc1 = S::zero();
+
+            auto i = size_type(0);
+
+            for(; i + 2*w <= n; i += 2*w)
+            {
+                acc0 = S::add(acc0, S::abs(S::load(x + i)));
+                acc1 = S::add(acc1, S::abs(S::load(x + i + w)));
+            }
+
+            for(; i + w <= n; i += w)
+            {
+                acc0 = S::add(acc0, S::abs(S::load(x + i)));
+            }
+
+            auto result = S::sum(S::add(acc0, acc1));
+
+            for(; i != n; ++ i)
+            {
+                result += (x[i] < 0 ? -x[i] : x[i]);
+            }
+
+            return result;
+        }
+
+        template <class T>
+        void simd_rot(size_type n, T * x, T * y, T c, T s)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            auto const c_reg = S::broadcast(c);
+            auto const s_reg = S::broadcast(s);
+
+            auto i = size_type(0);
+
+            for(; i + w <= n; i += w)
+            {
+                auto const xi = S::load(x + i);
+                auto const yi = S::load(y + i);
+
+                S::store(x + i, S::add(S::mul(c_reg, xi), S::mul(s_reg, yi)));
+                S::store(y + i, S::sub(S::mul(c_reg, yi), S::mul(s_reg, xi)));
+            }
+
+            for(; i != n; ++ i)
+            {
+                auto const xi = x[i];
+                auto const yi = y[i];
+
+                x[i] = c * xi + s * yi;
+                y[i] = c * yi - s * xi;
+            }
+        }
+
+        /* Произведение матриц по схеме Гото: блоки A размера mc x kc (в кэше
+        L2) и панели B размера kc x nc (в кэше L3) упаковываются в непрерывные
+        буферы, а микроядро вычисляет блок C размера mr x nr, аккумулируя его в
+        регистрах. Упакованная часть A уже умножена на alpha, неполные блоки
+        дополняются нулями.
+        */
+        template <class T>
+        struct gemm_blocking
+        {
+            static constexpr size_type mr = 6;
+            static constexpr size_type nr = 2 * simd<T>::width;
+            static constexpr size_type kc = 256;
+            static constexpr size_type mc = 72;
+            static constexpr size_type nc = 4080;
+
+            // Для меньших задач упаковка не окупается
+            static constexpr size_type min_flops = 16 * 16 * 16;
+        };
+
+        template <class T> constexpr size_type gemm_blocking<T>::mr;
+        template <class T> constexpr size_type gemm_blocking<T>::nr;
+        template <class T> constexpr size_type gemm_blocking<T>::kc;
+        template <class T> constexpr size_type gemm_blocking<T>::mc;
+        template <class T> constexpr size_type gemm_blocking<T>::nc;
+        template <class T> constexpr size_type gemm_blocking<T>::min_flops;
+
+        template <class T>
+        void gemm_pack_a(size_type rows, size_type depth, T const * a,
+                         size_type row_stride, size_type col_stride, T alpha, T * buffer)
+        {
+            constexpr auto mr = gemm_blocking<T>::mr;
+
+            for(auto i0 = size_type(0); i0 < rows; i0 += mr)
+            {
+                auto const valid = std::min(mr, rows - i0);
+
+                for(auto p = size_type(0); p != depth; ++ p)
+                {
+                    for(auto i = size_type(0); i != mr; ++ i)
+                    {
+                        *buffer++ = (i < valid) ? alpha * a[(i0 + i) * row_stride + p * col_stride]
+                                                : T(0);
+                    }
+                }
+            }
+        }
+
+        template <class T>
+        void gemm_pack_b(size_type depth, size_type cols, T const * b,
+                         size_type row_stride, size_type col_stride, T * buffer)
+        {
+            constexpr auto nr = gemm_blocking<T>::nr;
+
+            for(auto j0 = size_type(0); j0 < cols; j0 += nr)
+            {
+                auto const valid = std::min(nr, cols - j0);
+
+                for(auto p = size_type(0); p != depth; ++ p)
+                {
+                    auto const b_row = b + p * row_stride + j0 * col_stride;
+
+                    for(auto j = size_type(0); j != nr; ++ j)
+                    {
+                        *buffer++ = (j < valid) ? b_row[j * col_stride] : T(0);
+                    }
+                }
+            }
+        }
+
+        template <class T>
+        void gemm_update_row(T * c, typename simd<T>::reg acc0, typename simd<T>::reg acc1,
+                             T beta)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+
+            if(beta == T(0))
+            {
+                S::store(c, acc0);
+                S::store(c + w, acc1);
+            }
+            else
+            {
+                auto const beta_reg = S::broadcast(beta);
+
+                S::store(c, S::fmadd(beta_reg, S::load(c), acc0));
+                S::store(c + w, S::fmadd(beta_reg, S::load(c + w), acc1));
+            }
+        }
+
+        template <class T>
+        void gemm_micro_kernel(size_type depth, T const * a, T const * b, T beta,
+                               T * c, size_type ldc, size_type rows, size_type cols)
+        {
+            using S = simd<T>;
+            constexpr auto w = S::width;
+            constexpr auto mr = gemm_blocking<T>::mr;
+            constexpr auto nr = gemm_blocking<T>::nr;
+
+            static_assert(mr == 6 && nr == 2 * w, "Micro-kernel is written for 6 x 2w blocks");
+
+            auto c00 = S::zero(), c01 = S::zero();
+            auto c10 = S::zero(), c11 = S::zero();
+            auto c20 = S::zero(), c21 = S::zero();
+            auto c30 = S::zero(), c31 = S::zero();
+            auto c40 = S::zero(), c41 = S::zero();
+            auto c50 = S::zero(), c51 = S::zero();
+
+            for(auto p = size_type(0); p != depth; ++ p)
+            {
+                auto const b0 = S::load(b);
+                auto const b1 = S::load(b + w);
+
+                auto a_reg = S::broadcast(a[0]);
+                c00 = S::fmadd(a_reg, b0, c00);
+                c01 = S::fmadd(a_reg, b1, c01);
+
+                a_reg = S::broadcast(a[1]);
+                c10 = S::fmadd(a_reg, b0, c10);
+                c11 = S::fmadd(a_reg, b1, c11);
+
+                a_reg = S::broadcast(a[2]);
+                c20 = S::fmadd(a_reg, b0, c20);
+                c21 = S::fmadd(a_reg, b1, c21);
+
+                a_reg = S::broadcast(a[3]);
+                c30 = S::fmadd(a_reg, b0, c30);
+                c31 = S::fmadd(a_reg, b1, c31);
+
+                a_reg = S::broadcast(a[4]);
+                c40 = S::fmadd(a_reg, b0, c40);
+                c41 = S::fmadd(a_reg, b1, c41);
+
+                a_reg = S::broadcast(a[5]);
+                c50 = S::fmadd(a_reg, b0, c50);
+                c51 = S::fmadd(a_reg, b1, c51);
+
+                a += mr;
+                b += nr;
+            }
+
+            if(rows == mr && cols == nr)
+            {
+                gemm_update_row(c, c00, c01, beta);
+                gemm_update_row(c + ldc, c10, c11, beta);
+                gemm_update_row(c + 2*ldc, c20, c21, beta);
+                gemm_update_row(c + 3*ldc, c30, c31, beta);
+                gemm_update_row(c + 4*ldc, c40, c41, beta);
+                gemm_update_row(c + 5*ldc, c50, c51, beta);
+                return;
+            }
+
+            // Неполный блок на краю матрицы
+            T tile[mr * nr];
+
+            S::store(tile, c00);          S::store(tile + w, c01);
+            S::store(tile + nr, c10);     S::store(tile + nr + w, c11);
+            S::store(tile + 2*nr, c20);   S::store(tile + 2*nr + w, c21);
+            S::store(tile + 3*nr, c30);   S::store(tile + 3*nr + w, c31);
+            S::store(tile + 4*nr, c40);   S::store(tile + 4*nr + w, c41);
+            S::store(tile + 5*nr, c50);   S::store(tile + 5*nr + w, c51);
+
+            for(auto i = size_type(0); i != rows; ++ i)
+            {
+                for(auto j = size_type(0); j != cols; ++ j)
+                {
+                    auto & c_ij = c[i * ldc + j];
+
+                    c_ij = (beta == T(0)) ? tile[i * nr + j] : beta * c_ij + tile[i * nr + j];
+                }
+            }
+        }
+
+        template <class T>
+        void simd_gemm(size_type m, size_type n, size_type k, T alpha,
+                       T const * a, size_type a_rs, size_type a_cs,
+                       T const * b, size_type b_rs, size_type b_cs,
+                       T beta, T * c, size_type ldc)
+        {
+            using Blocking = gemm_blocking<T>;
+
+            if(m == 0 || n == 0)
+            {
+                return;
+            }
+
+            if(k == 0 || alpha == T(0) || m * n * k < Blocking::min_flops)
+            {
+                return kernels::gemm<T>(m, n, k, alpha, a, a_rs, a_cs, b, b_rs, b_cs, beta, c, ldc);
+            }
+
+            auto const nr = Blocking::nr;
+            auto const panel_cols = std::min(Blocking::nc, (n + nr - 1) / nr * nr);
+
+            std::vector<T, grabin::aligned_allocator<T>> a_buffer(Blocking::mc * Blocking::kc);
+            std::vector<T, grabin::aligned_allocator<T>> b_buffer(Blocking::kc * panel_cols);
+
+            for(auto j0 = size_type(0); j0 < n; j0 += Blocking::nc)
+            {
+                auto const cols = std::min(Blocking::nc, n - j0);
+
+                for(auto p0 = size_type(0); p0 < k; p0 += Blocking::kc)
+                {
+                    auto const depth = std::min(Blocking::kc, k - p0);
+
+                    // Вклад первой панели учитывает beta, последующие -- прибавляются
+                    auto const beta_panel = (p0 == 0) ? beta : T(1);
+
+                    gemm_pack_b(depth, cols, b + p0 * b_rs + j0 * b_cs, b_rs, b_cs, b_buffer.data());
+
+                    for(auto i0 = size_type(0); i0 < m; i0 += Blocking::mc)
+                    {
+                        auto const rows = std::min(Blocking::mc, m - i0);
+
+                        gemm_pack_a(rows, depth, a + i0 * a_rs + p0 * a_cs, a_rs, a_cs,
+                                    alpha, a_buffer.data());
+
+                        for(auto jr = size_type(0); jr < cols; jr += Blocking::nr)
+                        for(auto ir = size_type(0); ir < rows; ir += Blocking::mr)
+                        {
+                            gemm_micro_kernel(depth, a_buffer.data() + ir * depth,
+                                              b_buffer.data() + jr * depth, beta_panel,
+                                              c + (i0 + ir) * ldc + j0 + jr, ldc,
+                                              std::min(Blocking::mr, rows - ir),
+                                              std::min(Blocking::nr, cols - jr));
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    }
+    // namespace detail
+    /// @endcond
+
+#if defined(GRABIN_SIMD_AVX) || defined(GRABIN_SIMD_SSE2)
+    // Векторизованные реализации для float и double
+    //@{
+    inline double dot(size_type n, double const * x, double const * y)
+    {
+        return detail::simd_dot(n, x, y);
+    }
+
+    inline float dot(size_type n, float const * x, float const * y)
+    {
+        return detail::simd_dot(n, x, y);
+    }
+
+    inline void axpy(size_type n, double const & a, double const * x, double * y)
+    {
+        detail::simd_axpy(n, a, x, y);
+    }
+
+    inline void axpy(size_type n, float const & a, float const * x, float * y)
+    {
+        detail::simd_axpy(n, a, x, y);
+    }
+
+    inline void add(size_type n, double const * x, double * y)
+    {
+        detail::simd_add(n, x, y);
+    }
+
+    inline void add(size_type n, float const * x, float * y)
+    {
+        detail::simd_add(n, x, y);
+    }
+
+    inline void subtract(size_type n, double const * x, double * y)
+    {
+        detail::simd_subtract(n, x, y);
+    }
+
+    inline void subtract(size_type n, float const * x, float * y)
+    {
+        detail::simd_subtract(n, x, y);
+    }
+
+    inline void scale(size_type n, double const & a, double * x)
+    {
+        detail::simd_scale(n, a, x);
+    }
+
+    inline void scale(size_type n, float const & a, float * x)
+    {
+        detail::simd_scale(n, a, x);
+    }
+
+    inline double sum(size_type n, double const * x)
+    {
+        return detail::simd_sum(n, x);
+    }
+
+    inline float sum(size_type n, float const * x)
+    {
+        return detail::simd_sum(n, x);
+    }
+
+    inline double asum(size_type n, double const * x)
+    {
+        return detail::simd_asum(n, x);
+    }
+
+    inline float asum(size_type n, float const * x)
+    {
+        return detail::simd_asum(n, x);
+    }
+
+    inline void rot(size_type n, double * x, double * y, double const & c, double const & s)
+    {
+        detail::simd_rot(n, x, y, c, s);
+    }
+
+    inline void rot(size_type n, float * x, float * y, float const & c, float const & s)
+    {
+        detail::simd_rot(n, x, y, c, s);
+    }
+
+    inline void gemm(size_type m, size_type n, size_type k, double const & alpha,
+                     double const * a, size_type a_row_stride, size_type a_col_stride,
+                     double const * b, size_type b_row_stride, size_type b_col_stride,
+                     double const & beta, double * c, size_type ldc)
+    {
+        detail::simd_gemm(m, n, k, alpha, a, a_row_stride, a_col_stride,
+                          b, b_row_stride, b_col_stride, beta, c, ldc);
+    }
+
+    inline void gemm(size_type m, size_type n, size_type k, float const & alpha,
+                     float const * a, size_type a_row_stride, size_type a_col_stride,
+                     float const * b, size_type b_row_stride, size_type b_col_stride,
+                     float const & beta, float * c, size_type ldc)
+    {
+        detail::simd_gemm(m, n, k, alpha, a, a_row_stride, a_col_stride,
+                          b, b_row_stride, b_col_stride, beta, c, ldc);
+    }
+
+    inline void gemm(size_type m, size_type n, size_type k, double const & alpha,
+                     double const * a, size_type lda, double const * b, size_type ldb,
+                     double const & beta, double * c, size_type ldc)
+    {
+        detail::simd_gemm(m, n, k, alpha, a, lda, size_type(1), b, ldb, size_type(1), beta, c, ldc);
+    }
+
+    inline void gemm(size_type m, size_type n, size_type k, float const & alpha,
+                     float const * a, size_type lda, float const * b, size_type ldb,
+                     float const & beta, float * c, size_type ldc)
+    {
+        detail::simd_gemm(m, n, k, alpha, a, lda, size_type(1), b, ldb, size_type(1), beta, c, ldc);
+    }
+    //@}
+#endif
+
+    /** @brief Произведение матрицы, хранящейся по строкам, на вектор:
+    <tt>y = alpha*A*x + beta*y</tt>
+    @param m, n количество строк и столбцов матрицы @c A
+    @param alpha, beta скаляры
+    @param a, lda указатель на первый элемент @c A и расстояние между началами
+    соседних строк @c A
+    @param x указатель на начало массива из @c n элементов
+    @param y указатель на начало изменяемого массива из @c m элементов
+    @pre Массив @c y не пересекается с массивами @c A и @c x
+
+    Каждая строка умножается на @c x ядром @c dot. Если <tt>beta == 0</tt>, то
+    исходные значения элементов @c y не читаются.
+    */
+    template <class T>
+    void gemv(size_type m, size_type n, T const & alpha, T const * a, size_type lda,
+              T const * x, T const & beta, T * y)
+    {
+        for(auto i = size_type(0); i != m; ++ i)
+        {
+            auto const sum = alpha * kernels::dot(n, a + i * lda, x);
+
+            y[i] = (beta == T(0)) ? sum : sum + beta * y[i];
+        }
+    }
+
+    /** @brief Произведение транспонированной матрицы, хранящейся по строкам,
+    на вектор: <tt>y = alpha*A^T*x + beta*y</tt>
+    @param m, n количество строк и столбцов матрицы @c A
+    @param alpha, beta скаляры
+    @param a, lda указатель на первый элемент @c A и расстояние между началами
+    соседних строк @c A
+    @param x указатель на начало массива из @c m элементов
+    @param y указатель на начало изменяемого массива из @c n элементов
+    @pre Массив @c y не пересекается с массивами @c A и @c x
+
+    Строки @c A, умноженные на соответствующие элементы @c x, прибавляются к
+    @c y ядром @c axpy, так что матрица читается последовательно. Если
+    <tt>beta == 0</tt>, то исходные значения элементов @c y не читаются.
+    */
+    template <class T>
+    void gemv_t(size_type m, size_type n, T const & alpha, T const * a, size_type lda,
+                T const * x, T const & beta, T * y)
+    {
+        if(beta == T(0))
+        {
+            std::fill(y, y + n, T(0));
+        }
+        else if(beta != T(1))
+        {
+            kernels::scale(n, beta, y);
+        }
+
+        for(auto i = size_type(0); i != m; ++ i)
+        {
+            kernels::axpy(n, T(alpha * x[i]), a + i * lda, y);
+        }
+    }
+
+    /** @brief Обновление ранга один матрицы, хранящейся по строкам:
+    <tt>A += alpha*x*y^T</tt>
+    @param m, n количество строк и столбцов матрицы @c A
+    @param alpha скаляр
+    @param x указатель на начало массива из @c m элементов
+    @param y указатель на начало массива из @c n элементов
+    @param a, lda указатель на первый элемент @c A и расстояние между началами
+    соседних строк @c A
+    @pre Массив @c A не пересекается с массивами @c x и @c y
+
+    К каждой строке @c A прибавляется @c y, умноженный на
+    <tt>alpha * x[i]</tt>, ядром @c axpy.
+    */
+    template <class T>
+    void ger(size_type m, size_type n, T const & alpha, T const * x, T const * y,
+             T * a, size_type lda)
+    {
+        for(auto i = size_type(0); i != m; ++ i)
+        {
+            kernels::axpy(n, T(alpha * x[i]), y, a + i * lda);
+        }
+    }
+
+    /** @brief Симметричное обновление ранга один симметричной матрицы,
+    хранящейся в упакованном виде: <tt>A += alpha*x*x^T</tt>
+    @param n порядок матрицы
+    @param alpha скаляр
+    @param x указатель на начало массива из @c n элементов
+    @param ap указатель на начало массива из <tt>n*(n+1)/2</tt> элементов,
+    в котором по столбцам хранится верхний треугольник @c A
+    @pre Массив @c ap не пересекается с массивом @c x
+
+    Столбец @c j верхнего треугольника хранится непрерывно, поэтому к нему
+    прибавляется начало @c x ядром @c axpy.
+    */
+    template <class T>
+    void spr(size_type n, T const & alpha, T const * x, T * ap)
+    {
+        for(auto j = size_type(0); j != n; ++ j)
+        {
+            kernels::axpy(j + 1, T(alpha * x[j]), x, ap + j * (j + 1) / 2);
+        }
+    }
+
+    /** @brief Произведение симметричной матрицы, хранящейся в упакованном
+    виде, на вектор: <tt>y = alpha*A*x + beta*y</tt>
+    @param n порядок матрицы
+    @param alpha, beta скаляры
+    @param ap указатель на начало массива из <tt>n*(n+1)/2</tt> элементов,
+    в котором по столбцам хранится верхний треугольник @c A
+    @param x указатель на начало массива из @c n элементов
+    @param y указатель на начало изменяемого массива из @c n элементов
+    @pre Массив @c y не пересекается с массивами @c ap и @c x
+
+    Каждый хранимый элемент читается один раз: столбец @c j верхнего
+    треугольника прибавляется к @c y ядром @c axpy (вклад элементов над
+    диагональю) и умножается на @c x ядром @c dot (вклад симметричных им
+    элементов и диагонального элемента). Если <tt>beta == 0</tt>, то исходные
+    значения элементов @c y не читаются.
+    */
+    template <class T>
+    void spmv(size_type n, T const & alpha, T const * ap, T const * x,
+              T const & beta, T * y)
+    {
+        if(beta == T(0))
+        {
+            std::fill(y, y + n, T(0));
+        }
+        else if(beta != T(1))
+        {
+            kernels::scale(n, beta, y);
+        }
+
+        for(auto j = size_type(0); j != n; ++ j)
+        {
+            auto const column = ap + j * (j + 1) / 2;
+
+            kernels::axpy(j, T(alpha * x[j]), column, y);
+            y[j] += alpha * kernels::dot(j + 1, column, x);
+        }
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        /* Наибольший размер блока, который транспонируется непосредственно.
+        Блоки такого размера для исходной и результирующей матриц вместе
+        помещаются в кэш первого уровня
+        */
+        constexpr size_type transpose_leaf_size = 32;
+
+        template <class T>
+        void transpose_copy(size_type rows, size_type cols, T const * a, size_type lda,
+                            T * b, size_type ldb)
+        {
+            if(rows <= transpose_leaf_size && cols <= transpose_leaf_size)
+            {
+                for(auto i = size_type(0); i != rows; ++ i)
+                for(auto j = size_type(0); j != cols; ++ j)
+                {
+                    b[j * ldb + i] = a[i * lda + j];
+                }
+            }
+            else if(rows >= cols)
+            {
+                auto const half = rows / 2;
+
+                detail::transpose_copy(half, cols, a, lda, b, ldb);
+                detail::transpose_copy(rows - half, cols, a + half * lda, lda, b + half, ldb);
+            }
+            else
+            {
+                auto const half = cols / 2;
+
+                detail::transpose_copy(rows, half, a, lda, b, ldb);
+                detail::transpose_copy(rows, cols - half, a + half, lda, b + half * ldb, ldb);
+            }
+        }
+
+        // Обмен элементов x(i, j) и y(j, i) блоков размера rows x cols и cols x rows
+        template <class T>
+        void transpose_swap(size_type rows, size_type cols, T * x, T * y, size_type ld)
+        {
+            if(rows <= transpose_leaf_size && cols <= transpose_leaf_size)
+            {
+                using std::swap;
+
+                for(auto i = size_type(0); i != rows; ++ i)
+                for(auto j = size_type(0); j != cols; ++ j)
+                {
+                    swap(x[i * ld + j], y[j * ld + i]);
+                }
+            }
+            else if(rows >= cols)
+            {
+                auto const half = rows / 2;
+
+                detail::transpose_swap(half, cols, x, y, ld);
+                detail::transpose_swap(rows - half, cols, x + half * ld, y + half, ld);
+            }
+            else
+            {
+                auto const half = cols / 2;
+
+                detail::transpose_swap(rows, half, x, y, ld);
+                detail::transpose_swap(rows, cols - half, x + half, y + half * ld, ld);
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Транспонирование матрицы, хранящейся по строкам: <tt>B = A^T</tt>
+    @param m, n количество строк и столбцов матрицы @c A
+    @param a, lda указатель на первый элемент @c A и расстояние между началами
+    соседних строк @c A
+    @param b, ldb указатель на первый элемент изменяемой матрицы @c B размера
+    <tt>n x m</tt> и расстояние между началами соседних строк @c B
+    @pre Массивы @c A и @c B не пересекаются
+
+    Матрица рекурсивно делится пополам по большей размерности, пока блоки не
+    станут достаточно малыми, поэтому на каждом уровне иерархии памяти
+    (кэши, TLB) обрабатываемые блоки обеих матриц помещаются целиком, причём
+    размеры этих уровней знать не требуется.
+    */
+    template <class T>
+    void transpose(size_type m, size_type n, T const * a, size_type lda, T * b, size_type ldb)
+    {
+        detail::transpose_copy(m, n, a, lda, b, ldb);
+    }
+
+    /** @brief Транспонирование квадратной матрицы на месте
+    @param n порядок матрицы
+    @param a, lda указатель на первый элемент изменяемой матрицы и расстояние
+    между началами соседних строк
+
+    Диагональные блоки транспонируются рекурсивно, а внедиагональные
+    обмениваются с транспонированием так же, как в @c transpose.
+    */
+    template <class T>
+    void transpose(size_type n, T * a, size_type lda)
+    {
+        if(n <= detail::transpose_leaf_size)
+        {
+            using std::swap;
+
+            for(auto i = size_type(0); i != n; ++ i)
+            for(auto j = size_type(0); j != i; ++ j)
+            {
+                swap(a[i * lda + j], a[j * lda + i]);
+            }
+
+            return;
+        }
+
+        auto const half = n / 2;
+
+        kernels::transpose(half, a, lda);
+        kernels::transpose(n - half, a + half * lda + half, lda);
+        detail::transpose_swap(half, n - half, a + half, a + half * lda, lda);
+    }
+
+    //@{
+    /// @brief Деление на скаляр как умножение на обратную величину
+    inline void divide(size_type n, double const & a, double * x)
+    {
+        kernels::scale(n, 1 / a, x);
+    }
+
+    inline void divide(size_type n, float const & a, float * x)
+    {
+        kernels::scale(n, 1 / a, x);
+    }
+    //@}
+
+    /// @cond false
+    namespace detail
+    {
+        // Количество столбцов в блоке LU-разложения
+        constexpr size_type getrf_block_size = 64;
+
+        /* LU-разложение блока столбцов [k0; k0 + kb) с выбором ведущего
+        элемента по столбцу. Строки переставляются целиком, а элементы правее
+        блока не обновляются: это делается для всего блока сразу
+        */
+        template <class T>
+        bool getrf_panel(size_type n, size_type k0, size_type kb, T * a,
+                         size_type rs, size_type cs, size_type * ipiv)
+        {
+            using std::abs;
+
+            auto const k_end = k0 + kb;
+            auto nonsingular = true;
+
+            for(auto k = k0; k != k_end; ++ k)
+            {
+                auto p = k;
+
+                for(auto i = k + 1; i < n; ++ i)
+                {
+                    if(abs(a[i*rs + k*cs]) > abs(a[p*rs + k*cs]))
+                    {
+                        p = i;
+                    }
+                }
+
+                ipiv[k] = p;
+
+                if(p != k)
+                {
+                    for(auto j = size_type(0); j != n; ++ j)
+                    {
+                        std::swap(a[k*rs + j*cs], a[p*rs + j*cs]);
+                    }
+                }
+
+                auto const pivot = a[k*rs + k*cs];
+
+                if(pivot == T(0))
+                {
+                    nonsingular = false;
+                    continue;
+                }
+
+                for(auto i = k + 1; i < n; ++ i)
+                {
+                    auto const l_ik = (a[i*rs + k*cs] /= pivot);
+
+                    for(auto j = k + 1; j < k_end; ++ j)
+                    {
+                        a[i*rs + j*cs] -= l_ik * a[k*rs + j*cs];
+                    }
+                }
+            }
+
+            return nonsingular;
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief LU-разложение квадратной матрицы с выбором ведущего элемента по
+    столбцу: <tt>P*A == L*U</tt>
+    @param n порядок матрицы
+    @param a указатель на первый элемент матрицы
+    @param row_stride, col_stride расстояния между соседними элементами
+    столбца и строки матрицы
+    @param ipiv указатель на начало массива из @c n элементов, в который
+    записываются перестановки: на шаге @c k строка @c k была переставлена со
+    строкой <tt>ipiv[k] >= k</tt>
+    @pre <tt>row_stride == 1 || col_stride == 1</tt>
+    @return @b false, если найден нулевой ведущий элемент (матрица вырождена),
+    иначе -- @b true
+    @post Под главной диагональю хранятся элементы @c L (кроме единичной
+    диагонали), на главной диагонали и над ней -- элементы @c U
+
+    Блочный правосторонний алгоритм: блок из нескольких столбцов
+    раскладывается без обращения к остальной матрице, затем вычисляются
+    соответствующие строки @c U, а оставшаяся часть матрицы обновляется
+    одним вызовом ядра @c gemm, на которое приходится почти вся работа.
+    */
+    template <class T>
+    bool getrf(size_type n, T * a, size_type row_stride, size_type col_stride, size_type * ipiv)
+    {
+        auto const rs = row_stride;
+        auto const cs = col_stride;
+
+        auto nonsingular = true;
+
+        for(auto k0 = size_type(0); k0 < n; k0 += detail::getrf_block_size)
+        {
+            auto const kb = std::min(detail::getrf_block_size, n - k0);
+            auto const k1 = k0 + kb;
+            auto const rest = n - k1;
+
+            nonsingular = detail::getrf_panel(n, k0, kb, a, rs, cs, ipiv) && nonsingular;
+
+            if(rest == 0)
+            {
+                break;
+            }
+
+            // U12 = L11^(-1) * A12
+            for(auto i = k0 + 1; i < k1; ++ i)
+            {
+                for(auto j = k0; j < i; ++ j)
+                {
+                    auto const l_ij = a[i*rs + j*cs];
+
+                    for(auto c = k1; c < n; ++ c)
+                    {
+                        a[i*rs + c*cs] -= l_ij * a[j*rs + c*cs];
+                    }
+                }
+            }
+
+            // A22 -= L21 * U12
+            auto const l21 = a + k1*rs + k0*cs;
+            auto const u12 = a + k0*rs + k1*cs;
+            auto const a22 = a + k1*rs + k1*cs;
+
+            if(cs == 1)
+            {
+                kernels::gemm(rest, rest, kb, T(-1), l21, rs, cs, u12, rs, cs, T(1), a22, rs);
+            }
+            else
+            {
+                // Хранение по столбцам: A22^T -= U12^T * L21^T
+                kernels::gemm(rest, rest, kb, T(-1), u12, cs, rs, l21, cs, rs, T(1), a22, cs);
+            }
+        }
+
+        return nonsingular;
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        /* Обновление нижнего треугольника квадратной матрицы порядка m:
+        C -= X * Y^T. Матрица разбивается на блоки столбцов, и для каждого из
+        них ядром gemm обновляются только строки, начиная с диагонального
+        блока, то есть элементы над диагональю вычисляются лишь внутри
+        диагональных блоков
+        */
+        template <class T>
+        void lower_rank_k_update(size_type m, size_type k,
+                                 T const * x, size_type x_rs, size_type x_cs,
+                                 T const * y, size_type y_rs, size_type y_cs,
+                                 T * c, size_type rs, size_type cs)
+        {
+            for(auto j0 = size_type(0); j0 < m; j0 += detail::getrf_block_size)
+            {
+                auto const cols = std::min(detail::getrf_block_size, m - j0);
+                auto const rows = m - j0;
+                auto const c0 = c + j0*rs + j0*cs;
+
+                if(cs == 1)
+                {
+                    kernels::gemm(rows, cols, k, T(-1), x + j0*x_rs, x_rs, x_cs,
+                                  y + j0*y_rs, y_cs, y_rs, T(1), c0, rs);
+                }
+                else
+                {
+                    // Хранение по столбцам: C^T -= Y * X^T
+                    kernels::gemm(cols, rows, k, T(-1), y + j0*y_rs, y_rs, y_cs,
+                                  x + j0*x_rs, x_cs, x_rs, T(1), c0, cs);
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Разложение Холецкого симметричной положительно определённой
+    матрицы: <tt>A == L*L^T</tt>
+    @param n порядок матрицы
+    @param a указатель на первый элемент матрицы
+    @param row_stride, col_stride расстояния между соседними элементами
+    столбца и строки матрицы
+    @pre <tt>row_stride == 1 || col_stride == 1</tt>
+    @return @b false, если матрица не является положительно определённой
+    (встретился неположительный диагональный элемент), иначе -- @b true
+    @post На главной диагонали и под ней хранятся элементы @c L. Элементы над
+    главной диагональю используются как рабочая память, их значения не
+    определены
+
+    Используются только элементы на главной диагонали и под ней. Алгоритм
+    устроен так же, как в @c getrf, но требует вдвое меньше операций.
+    */
+    template <class T>
+    bool potrf(size_type n, T * a, size_type row_stride, size_type col_stride)
+    {
+        using std::sqrt;
+
+        auto const rs = row_stride;
+        auto const cs = col_stride;
+
+        auto const at = [=](size_type i, size_type j) -> T & { return a[i*rs + j*cs]; };
+
+        for(auto k0 = size_type(0); k0 < n; k0 += detail::getrf_block_size)
+        {
+            auto const kb = std::min(detail::getrf_block_size, n - k0);
+            auto const k1 = k0 + kb;
+
+            // L11 * L11^T = A11
+            for(auto k = k0; k != k1; ++ k)
+            {
+                if(!(at(k, k) > T(0)))
+                {
+                    return false;
+                }
+
+                auto const l_kk = (at(k, k) = sqrt(at(k, k)));
+
+                for(auto i = k + 1; i < k1; ++ i)
+                {
+                    at(i, k) /= l_kk;
+                }
+
+                for(auto j = k + 1; j < k1; ++ j)
+                for(auto i = j; i < k1; ++ i)
+                {
+                    at(i, j) -= at(i, k) * at(j, k);
+                }
+            }
+
+            if(k1 == n)
+            {
+                break;
+            }
+
+            // L21 = A21 * L11^(-T)
+            for(auto i = k1; i < n; ++ i)
+            {
+                for(auto j = k0; j != k1; ++ j)
+                {
+                    auto sum = at(i, j);
+
+                    for(auto p = k0; p != j; ++ p)
+                    {
+                        sum -= at(i, p) * at(j, p);
+                    }
+
+                    at(i, j) = sum / at(j, j);
+                }
+            }
+
+            // A22 -= L21 * L21^T
+            auto const l21 = a + k1*rs + k0*cs;
+
+            detail::lower_rank_k_update(n - k1, kb, l21, rs, cs, l21, rs, cs,
+                                        a + k1*rs + k1*cs, rs, cs);
+        }
+
+        return true;
+    }
+
+    /** @brief Разложение симметричной матрицы вида <tt>A == L*D*L^T</tt> без
+    перестановок
+    @param n порядок матрицы
+    @param a указатель на первый элемент матрицы
+    @param row_stride, col_stride расстояния между соседними элементами
+    столбца и строки матрицы
+    @param tolerance порог: диагональный элемент @c D, модуль которого не
+    превосходит @c tolerance, считается нулевым
+    @pre <tt>row_stride == 1 || col_stride == 1</tt>
+    @return Количество ненулевых элементов @c D
+    @post Под главной диагональю хранятся элементы @c L (кроме единичной
+    диагонали), на главной диагонали -- элементы @c D. Элементы над главной
+    диагональю используются как рабочая память, их значения не определены
+
+    Используются только элементы на главной диагонали и под ней. Если
+    элемент @c D считается нулевым, то соответствующий столбец @c L
+    обнуляется: для положительно полуопределённой матрицы он равен нулю в
+    точной арифметике. Поэтому разложение применимо к вырожденным
+    ковариационным матрицам.
+    */
+    template <class T>
+    size_type ldlt(size_type n, T * a, size_type row_stride, size_type col_stride,
+                   T const & tolerance)
+    {
+        using std::abs;
+
+        auto const rs = row_stride;
+        auto const cs = col_stride;
+
+        auto const at = [=](size_type i, size_type j) -> T & { return a[i*rs + j*cs]; };
+
+        auto rank = size_type(0);
+
+        // Произведения L21 * D11, нужные для обновления A22
+        std::vector<T> w;
+
+        for(auto k0 = size_type(0); k0 < n; k0 += detail::getrf_block_size)
+        {
+            auto const kb = std::min(detail::getrf_block_size, n - k0);
+            auto const k1 = k0 + kb;
+
+            // L11 * D11 * L11^T = A11
+            for(auto k = k0; k != k1; ++ k)
+            {
+                auto const d_k = at(k, k);
+
+                if(abs(d_k) <= tolerance)
+                {
+                    at(k, k) = T(0);
+
+                    for(auto i = k + 1; i < k1; ++ i)
+                    {
+                        at(i, k) = T(0);
+                    }
+
+                    continue;
+                }
+
+                ++ rank;
+
+                for(auto j = k + 1; j < k1; ++ j)
+                {
+                    auto const w_j = at(j, k);
+
+                    for(auto i = j; i < k1; ++ i)
+                    {
+                        at(i, j) -= at(i, k) * w_j / d_k;
+                    }
+                }
+
+                for(auto i = k + 1; i < k1; ++ i)
+                {
+                    at(i, k) /= d_k;
+                }
+            }
+
+            if(k1 == n)
+            {
+                break;
+            }
+
+            // W = A21 * L11^(-T) = L21 * D11, L21 = W * D11^(-1)
+            auto const rest = n - k1;
+
+            w.resize(rest * kb);
+
+            for(auto i = k1; i < n; ++ i)
+            {
+                auto const w_i = w.data() + (i - k1) * kb;
+
+                for(auto j = k0; j != k1; ++ j)
+                {
+                    auto sum = at(i, j);
+
+                    for(auto p = k0; p != j; ++ p)
+                    {
+                        sum -= w_i[p - k0] * at(j, p);
+                    }
+
+                    w_i[j - k0] = sum;
+                    at(i, j) = (at(j, j) == T(0)) ? T(0) : sum / at(j, j);
+                }
+            }
+
+            // A22 -= L21 * W^T
+            detail::lower_rank_k_update(rest, kb, a + k1*rs + k0*cs, rs, cs,
+                                        w.data(), kb, size_type(1),
+                                        a + k1*rs + k1*cs, rs, cs);
+        }
+
+        return rank;
+    }
+}
+// namespace kernels
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_KERNELS_HPP_INCLUDED
@@ -24,12 +24,20 @@ Grabin -- это свободной программное обеспечени
 */
 
 #include <grabin/math/average_type.hpp>
+#include <grabin/math/evaluated_type.hpp>
+#include <grabin/math/kernels.hpp>
+#include <grabin/memory.hpp>
 #include <grabin/operators.hpp>
 #include <grabin/utility/as_const.hpp>
+#include <grabin/utility/no_init.hpp>
 
 #include <cassert>
 #include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace grabin
@@ -46,8 +54,8 @@ inline namespace v1
         @throw std::logic_error, если равенство <tt>x.dim() == y.dim()</tt> не
         выполняется
         */
-        template <class T>
-        static void ensure_equal_dimensions(T const & x, T const & y)
+        template <class T1, class T2>
+        static void ensure_equal_dimensions(T1 const & x, T2 const & y)
         {
             if(x.dim() != y.dim())
             {
@@ -107,8 +115,8 @@ inline namespace v1
         /** @brief Обеспечение совпадения размерностей
         @param x, y векторы, размерности которых должны совпадать
         */
-        template <class T>
-        static void ensure_equal_dimensions(T const &, T const &)
+        template <class T1, class T2>
+        static void ensure_equal_dimensions(T1 const &, T2 const &)
         {}
 
         /** @brief Обеспечение корректности индекса
@@ -128,9 +136,241 @@ inline namespace v1
         static void check_division_by_zero(Scalar const & value);
     };
 
+    template <class T, class CheckPolicy, class Allocator>
+    class math_vector;
+
+    /** @brief Класс-характеристика, определяющий, является ли тип выражением,
+    результатом вычисления которого является математический вектор
+    @tparam T тип
+
+    Такие выражения предоставляют функцию-член @c dim(), индексированный доступ
+    к элементам на чтение, а также типы @c value_type, @c size_type и
+    @c check_policy.
+    */
+    template <class T>
+    struct is_math_vector_expression
+     : std::false_type
+    {};
+
+    template <class T, class Check, class A>
+    struct is_math_vector_expression<math_vector<T, Check, A>>
+     : std::true_type
+    {};
+
+    /// @cond false
+    namespace detail
+    {
+        /* Доступ к элементам выражений без проверки индексов: используется
+        циклами, вычисляющими выражения, так как допустимость всех индексов в
+        них следует из совпадения размерностей, проверенного при построении
+        выражения.
+        */
+        struct math_vector_access
+        {
+            template <class Expression>
+            static auto element(Expression const & x,
+                                typename Expression::size_type index)
+            -> decltype(x.element(index))
+            {
+                return x.element(index);
+            }
+        };
+
+        /* Константный итератор произвольного доступа по элементам выражения:
+        хранит указатель на выражение и индекс, элементы вычисляются при
+        разыменовании и возвращаются по значению.
+        */
+        template <class Expression>
+        class math_vector_expression_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename Expression::value_type;
+            using difference_type = typename Expression::difference_type;
+            using pointer = void;
+            using reference = value_type;
+
+            math_vector_expression_iterator() = default;
+
+            math_vector_expression_iterator(Expression const & expr, difference_type index)
+             : expr_(std::addressof(expr))
+             , index_(index)
+            {}
+
+            reference operator*() const
+            {
+                return math_vector_access::element(*this->expr_, this->index_);
+            }
+
+            reference operator[](difference_type n) const
+            {
+                return math_vector_access::element(*this->expr_, this->index_ + n);
+            }
+
+            math_vector_expression_iterator & operator++()
+            {
+                ++ this->index_;
+                return *this;
+            }
+
+            math_vector_expression_iterator operator++(int)
+            {
+                auto result = *this;
+                ++ *this;
+                return result;
+            }
+
+            math_vector_expression_iterator & operator--()
+            {
+                -- this->index_;
+                return *this;
+            }
+
+            math_vector_expression_iterator operator--(int)
+            {
+                auto result = *this;
+                -- *this;
+                return result;
+            }
+
+            math_vector_expression_iterator & operator+=(difference_type n)
+            {
+                this->index_ += n;
+                return *this;
+            }
+
+            math_vector_expression_iterator & operator-=(difference_type n)
+            {
+                this->index_ -= n;
+                return *this;
+            }
+
+            friend math_vector_expression_iterator
+            operator+(math_vector_expression_iterator x, difference_type n)
+            {
+                x += n;
+                return x;
+            }
+
+            friend math_vector_expression_iterator
+            operator+(difference_type n, math_vector_expression_iterator x)
+            {
+                x += n;
+                return x;
+            }
+
+            friend math_vector_expression_iterator
+            operator-(math_vector_expression_iterator x, difference_type n)
+            {
+                x -= n;
+                return x;
+            }
+
+            friend difference_type operator-(math_vector_expression_iterator const & x,
+                                             math_vector_expression_iterator const & y)
+            {
+                return x.index_ - y.index_;
+            }
+
+            friend bool operator==(math_vector_expression_iterator const & x,
+                                   math_vector_expression_iterator const & y)
+            {
+                return x.index_ == y.index_;
+            }
+
+            friend bool operator!=(math_vector_expression_iterator const & x,
+                                   math_vector_expression_iterator const & y)
+            {
+                return !(x == y);
+            }
+
+            friend bool operator<(math_vector_expression_iterator const & x,
+                                  math_vector_expression_iterator const & y)
+            {
+                return x.index_ < y.index_;
+            }
+
+            friend bool operator>(math_vector_expression_iterator const & x,
+                                  math_vector_expression_iterator const & y)
+            {
+                return y < x;
+            }
+
+            friend bool operator<=(math_vector_expression_iterator const & x,
+                                   math_vector_expression_iterator const & y)
+            {
+                return !(y < x);
+            }
+
+            friend bool operator>=(math_vector_expression_iterator const & x,
+                                   math_vector_expression_iterator const & y)
+            {
+                return !(x < y);
+            }
+
+        private:
+            Expression const * expr_ = nullptr;
+            difference_type index_ = 0;
+        };
+
+        /* Вложенные выражения хранятся по значению, а векторы-lvalue -- по
+        ссылке. Это позволяет безопасно сохранять выражение, построенное из
+        временных объектов, в переменной, объявленной с помощью auto.
+        */
+        template <class E>
+        using expression_operand_t
+            = std::conditional_t<std::is_lvalue_reference<E>::value,
+                                 std::decay_t<E> const &, std::decay_t<E>>;
+
+        template <class E>
+        using enable_if_vector_expression_t
+            = std::enable_if_t<is_math_vector_expression<std::decay_t<E>>::value>;
+
+        template <class E1, class E2>
+        using enable_if_vector_expressions_t
+            = std::enable_if_t<is_math_vector_expression<std::decay_t<E1>>::value
+                               && is_math_vector_expression<std::decay_t<E2>>::value
+                               && std::is_same<typename std::decay_t<E1>::check_policy,
+                                               typename std::decay_t<E2>::check_policy>::value>;
+
+        /* Неявно в вектор преобразуются только ленивые выражения (результат
+        арифметических операций) и векторы с тем же типом элементов: векторы с
+        элементами другого типа преобразуются только явно.
+        */
+        template <class E>
+        struct is_math_vector_operation
+         : std::false_type
+        {};
+
+        template <class E, class T, class = void>
+        struct is_implicit_vector_conversion
+         : std::false_type
+        {};
+
+        template <class E, class T>
+        struct is_implicit_vector_conversion<E, T, std::enable_if_t<is_math_vector_expression<E>::value>>
+         : std::integral_constant<bool, is_math_vector_operation<E>::value
+                                        || std::is_same<typename E::value_type, T>::value>
+        {};
+
+        struct reversed_multiplies
+        {
+            template <class T, class Scalar>
+            auto operator()(T const & x, Scalar const & a) const
+            -> decltype(a * x)
+            {
+                return a * x;
+            }
+        };
+    }
+    // namespace detail
+    /// @endcond
+
     /** @brief Математический вектор
     @tparam T тип элементов
     @tparam CheckPolicy стратегия проверок и обработки ошибок
+    @tparam Allocator тип распределителя памяти, например,
+    <tt>grabin::aligned_allocator<T></tt> для выравнивания данных по строке кэша
 
     Первоночально была идея запретить конструктор без аргументов и вообще
     векторы нулевой размерности. Но тогда возникает вопрос: в каком состоянии
@@ -139,11 +379,13 @@ inline namespace v1
     целесообразно. Поэтому было решено добавить конструктор без аругментов,
     создающий вектор нулевой размерности.
     */
-    template <class T, class CheckPolicy = math_vector_throws_check_policy>
+    template <class T, class CheckPolicy = math_vector_throws_check_policy,
+              class Allocator = std::allocator<T>>
     class math_vector
      : grabin::operators::container_equality::enable_adl
     {
-        using Container = std::vector<T>;
+        // Адаптер позволяет создавать элементы без заполнения нулями
+        using Container = std::vector<T, grabin::default_init_allocator<Allocator>>;
 
     public:
         // Типы
@@ -165,29 +407,59 @@ inline namespace v1
         /// @brief Стратегия проверок и обработки ошибок
         using check_policy = CheckPolicy;
 
+        /// @brief Тип распределителя памяти
+        using allocator_type = Allocator;
+
         // Создание, копирование, уничтожение
         /** @brief Конструктор по-умолчанию
         @brief <tt>this->dim() == 0</tt>
         */
         math_vector() = default;
 
+        /** @brief Конструктор с явным указанием распределителя памяти
+        @param alloc распределитель памяти
+        @post <tt>this->dim() == 0</tt>
+        */
+        explicit math_vector(allocator_type const & alloc)
+         : data_(alloc)
+        {}
+
         /** @brief Конструктор с явным указанием размерности
         @param dim размерность вектора
+        @param alloc распределитель памяти
         @post <tt> this->dim() == dim </tt>
         @post Все элементы <tt>*this</tt> равны <tt>value_type()</tt>
         */
-        explicit math_vector(size_type dim)
-         : data_(dim)
+        explicit math_vector(size_type dim, allocator_type const & alloc = allocator_type())
+         : data_(dim, value_type(), alloc)
+        {}
+
+        /** @brief Конструктор с явным указанием размерности без инициализации
+        элементов
+        @param dim размерность вектора
+        @param alloc распределитель памяти
+        @post <tt> this->dim() == dim </tt>
+        @post Элементы <tt>*this</tt> инициализированы по умолчанию, то есть
+        для встроенных типов их значения не определены
+
+        Используется, когда всем элементам сразу после создания будут присвоены
+        значения: исключает лишнее заполнение памяти нулями.
+        */
+        math_vector(size_type dim, no_init_t, allocator_type const & alloc = allocator_type())
+         : data_(dim, alloc)
         {}
 
         /** @brief Конструктор с явным указанием размерности и значения
         элементов
         @param dim размерность вектора
+        @param value значение элементов
+        @param alloc распределитель памяти
         @post <tt> this->dim() == dim </tt>
         @post Все элементы <tt>*this</tt> равны @c value
         */
-        math_vector(size_type dim, value_type const & value)
-         : data_(dim, value)
+        math_vector(size_type dim, value_type const & value,
+                    allocator_type const & alloc = allocator_type())
+         : data_(dim, value, alloc)
         {}
 
         /** @brief Конструктор на основе интервала значений
@@ -195,11 +467,48 @@ inline namespace v1
         @post <tt> this->dim() == (values.end() - values.begin())</tt>
         @post Элементы <tt>*this</tt> равны соответствующим элементам @c values
         */
-        template <class Range, class = decltype(std::declval<Range&>().begin())>
+        template <class Range, class = decltype(std::declval<Range&>().begin()),
+                  class = std::enable_if_t<!is_math_vector_expression<Range>::value>>
         explicit math_vector(Range const & values)
          : data_(values.begin(), values.end())
         {}
 
+        /** @brief Конструктор на основе выражения
+        @param expr выражение, результатом которого является вектор
+        @post <tt> this->dim() == expr.dim() </tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c expr
+
+        Выражение вычисляется за один проход, без создания промежуточных
+        векторов и без предварительного заполнения элементов нулями.
+        */
+        template <class Expression,
+                  std::enable_if_t<detail::is_implicit_vector_conversion<Expression, T>::value, int> = 0>
+        math_vector(Expression const & expr)
+         : data_(expr.dim())
+        {
+            this->assign_elementwise(expr, [](value_type & x, auto const & y) { x = y; });
+        }
+
+        /** @brief Явное преобразование вектора с элементами другого типа
+        @param expr вектор, элементы которого преобразуются к типу @c value_type
+        @post <tt> this->dim() == expr.dim() </tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c expr,
+        преобразованным к типу @c value_type
+
+        В отличие от выражений, векторы с элементами другого типа (например,
+        <tt>math_vector<int></tt> для <tt>math_vector<double></tt>) не
+        преобразуются неявно, чтобы такое преобразование не выполнялось
+        незаметно при передаче аргументов функциям.
+        */
+        template <class Expression,
+                  std::enable_if_t<is_math_vector_expression<Expression>::value
+                                   && !detail::is_implicit_vector_conversion<Expression, T>::value, int> = 0>
+        explicit math_vector(Expression const & expr)
+         : data_(expr.dim())
+        {
+            this->assign_elementwise(expr, [](value_type & x, auto const & y) { x = y; });
+        }
+
         /// @brief Конструктор копий
         math_vector(math_vector const &) = default;
         math_vector(math_vector &&) = default;
@@ -219,6 +528,33 @@ inline namespace v1
         /// @brief Оператор присваивания с перемещением
         math_vector & operator=(math_vector &&) = default;
 
+        /// @brief Распределитель памяти
+        allocator_type get_allocator() const
+        {
+            return this->data_.get_allocator();
+        }
+
+        /** @brief Присваивание выражения
+        @param expr выражение, результатом которого является вектор
+        @post <tt> this->dim() == expr.dim() </tt>
+        @post Элементы <tt>*this</tt> равны соответствующим элементам @c expr
+        @return <tt>*this</tt>
+
+        Если размерность не изменяется, то выражение вычисляется "на месте", без
+        выделения памяти. Выражение может содержать ссылки на <tt>*this</tt>,
+        так как каждый элемент результата зависит только от элементов
+        операндов с тем же индексом. Вектор с элементами другого типа
+        необходимо предварительно явно преобразовать.
+        */
+        template <class Expression,
+                  class = std::enable_if_t<detail::is_implicit_vector_conversion<Expression, T>::value>>
+        math_vector & operator=(Expression const & expr)
+        {
+            this->data_.resize(expr.dim());
+            this->assign_elementwise(expr, [](value_type & x, auto const & y) { x = y; });
+            return *this;
+        }
+
         // Размер
         //@{
         /** @brief Размерность вектора
@@ -279,6 +615,21 @@ inline namespace v1
         }
         //@}
 
+        //@{
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент вектора
+        */
+        value_type * data()
+        {
+            return this->data_.data();
+        }
+
+        value_type const * data() const
+        {
+            return this->data_.data();
+        }
+        //@}
+
         // Итераторы
         //@{
         /// @brief Итератор начала последовательности элементов
@@ -324,10 +675,7 @@ inline namespace v1
         */
         math_vector & operator*=(value_type const & a)
         {
-            for(auto & elem : *this)
-            {
-                elem *= a;
-            }
+            grabin::kernels::scale(this->dim(), a, this->data());
             return *this;
         }
 
@@ -340,10 +688,7 @@ inline namespace v1
         {
             check_policy::check_division_by_zero(a);
 
-            for(auto & elem : *this)
-            {
-                elem /= a;
-            }
+            grabin::kernels::divide(this->dim(), a, this->data());
             return *this;
         }
 
@@ -361,10 +706,7 @@ inline namespace v1
 
             assert(x.dim() == this->dim());
 
-            for(auto i = this->begin(); i != this->end(); ++ i)
-            {
-                *i += *(x.begin() + (i - this->begin()));
-            }
+            grabin::kernels::add(this->dim(), x.data(), this->data());
 
             return *this;
         }
@@ -383,41 +725,410 @@ inline namespace v1
 
             assert(x.dim() == this->dim());
 
-            for(auto i = this->begin(); i != this->end(); ++ i)
-            {
-                *i -= *(x.begin() + (i - this->begin()));
-            }
+            grabin::kernels::subtract(this->dim(), x.data(), this->data());
+
+            return *this;
+        }
+
+        /** @brief Прибавление выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        math_vector & operator+=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            assert(x.dim() == this->dim());
+
+            this->assign_elementwise(x, [](value_type & a, auto const & b) { a += b; });
+
+            return *this;
+        }
+
+        /** @brief Вычитание выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Из каждого элемента <tt>*this</tt> вычитаются соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        math_vector & operator-=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            assert(x.dim() == this->dim());
+
+            this->assign_elementwise(x, [](value_type & a, auto const & b) { a -= b; });
 
             return *this;
         }
 
     private:
+        friend struct detail::math_vector_access;
+
+        value_type const & element(size_type index) const
+        {
+            return this->data_[index];
+        }
+
+        template <class Expression, class Assign>
+        void assign_elementwise(Expression const & expr, Assign assign)
+        {
+            assert(expr.dim() == this->dim());
+
+            auto const n = this->dim();
+
+            for(auto index = size_type(0); index != n; ++ index)
+            {
+                assign(this->data_[index], detail::math_vector_access::element(expr, index));
+            }
+        }
+
         Container data_;
     };
 
+    // Выражения
+    /** @brief Выражение, представляющее поэлементное применение бинарной
+    операции к двум векторам
+    @tparam BinaryOperation тип бинарной операции
+    @tparam E1, E2 типы операндов: константные ссылки на векторы (и выражения),
+    являющиеся lvalue, или сами вложенные выражения
+
+    Элементы вычисляются только при обращении к ним, поэтому выражение вида
+    <tt>a*x + y - z</tt> вычисляется при присваивании за один проход, без
+    создания промежуточных векторов.
+    */
+    template <class BinaryOperation, class E1, class E2>
+    class math_vector_binary_expression
+    {
+        using Arg1 = std::decay_t<E1>;
+        using Arg2 = std::decay_t<E2>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type
+            = std::decay_t<decltype(std::declval<BinaryOperation const &>()
+                                        (std::declval<typename Arg1::value_type const &>(),
+                                         std::declval<typename Arg2::value_type const &>()))>;
+
+        /// @brief Тип для представления размера и индексов
+        using size_type = typename Arg1::size_type;
+
+        /// @brief Тип для представления разности индексов
+        using difference_type = typename Arg1::difference_type;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = typename Arg1::check_policy;
+
+        /// @brief Тип константного итератора
+        using const_iterator = detail::math_vector_expression_iterator<math_vector_binary_expression>;
+
+        /// @brief Тип итератора: элементы выражения доступны только для чтения
+        using iterator = const_iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param x, y операнды
+        @param op бинарная операция
+        @pre <tt>x.dim() == y.dim()</tt>
+        */
+        template <class T1, class T2>
+        math_vector_binary_expression(T1 && x, T2 && y,
+                                      BinaryOperation op = BinaryOperation())
+         : x_(std::forward<T1>(x))
+         , y_(std::forward<T2>(y))
+         , op_(std::move(op))
+        {}
+
+        // Размер
+        //@{
+        /// @brief Размерность вектора, являющегося результатом выражения
+        size_type dim() const
+        {
+            return this->x_.dim();
+        }
+
+        size_type size() const
+        {
+            return this->dim();
+        }
+        //@}
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов выражения
+        const_iterator begin() const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        /// @brief Итератор конца последовательности элементов выражения
+        const_iterator end() const
+        {
+            return const_iterator(*this, this->dim());
+        }
+        //@}
+
+        // Доступ к данным
+        /** @brief Индексированный доступ к данным
+        @param index индекс элемента
+        @return Значение элемента с индексом @c index
+        @throw То же, что <tt>check_policy::check_index(*this, index)</tt>
+        */
+        value_type operator[](size_type index) const
+        {
+            check_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+    private:
+        friend struct detail::math_vector_access;
+
+        value_type element(size_type index) const
+        {
+            return this->op_(detail::math_vector_access::element(this->x_, index),
+                             detail::math_vector_access::element(this->y_, index));
+        }
+
+        E1 x_;
+        E2 y_;
+        BinaryOperation op_;
+    };
+
+    /** @brief Выражение, представляющее поэлементное применение бинарной
+    операции к вектору и скаляру
+    @tparam BinaryOperation тип бинарной операции, первым аргументом которой
+    является элемент вектора, а вторым -- скаляр
+    @tparam E тип операнда-вектора: константная ссылка на вектор (или выражение),
+    являющийся lvalue, или само вложенное выражение
+    @tparam Scalar тип скаляра
+    */
+    template <class BinaryOperation, class E, class Scalar>
+    class math_vector_scalar_expression
+    {
+        using Arg = std::decay_t<E>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type
+            = std::decay_t<decltype(std::declval<BinaryOperation const &>()
+                                        (std::declval<typename Arg::value_type const &>(),
+                                         std::declval<Scalar const &>()))>;
+
+        /// @brief Тип для представления размера и индексов
+        using size_type = typename Arg::size_type;
+
+        /// @brief Тип для представления разности индексов
+        using difference_type = typename Arg::difference_type;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = typename Arg::check_policy;
+
+        /// @brief Тип константного итератора
+        using const_iterator = detail::math_vector_expression_iterator<math_vector_scalar_expression>;
+
+        /// @brief Тип итератора: элементы выражения доступны только для чтения
+        using iterator = const_iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param x вектор
+        @param a скаляр
+        @param op бинарная операция
+        */
+        template <class T>
+        math_vector_scalar_expression(T && x, Scalar a,
+                                      BinaryOperation op = BinaryOperation())
+         : x_(std::forward<T>(x))
+         , a_(std::move(a))
+         , op_(std::move(op))
+        {}
+
+        // Размер
+        //@{
+        /// @brief Размерность вектора, являющегося результатом выражения
+        size_type dim() const
+        {
+            return this->x_.dim();
+        }
+
+        size_type size() const
+        {
+            return this->dim();
+        }
+        //@}
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов выражения
+        const_iterator begin() const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        /// @brief Итератор конца последовательности элементов выражения
+        const_iterator end() const
+        {
+            return const_iterator(*this, this->dim());
+        }
+        //@}
+
+        // Доступ к данным
+        /** @brief Индексированный доступ к данным
+        @param index индекс элемента
+        @return Значение элемента с индексом @c index
+        @throw То же, что <tt>check_policy::check_index(*this, index)</tt>
+        */
+        value_type operator[](size_type index) const
+        {
+            check_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+    private:
+        friend struct detail::math_vector_access;
+
+        value_type element(size_type index) const
+        {
+            return this->op_(detail::math_vector_access::element(this->x_, index), this->a_);
+        }
+
+        E x_;
+        Scalar a_;
+        BinaryOperation op_;
+    };
+
+    template <class BinaryOperation, class E1, class E2>
+    struct is_math_vector_expression<math_vector_binary_expression<BinaryOperation, E1, E2>>
+     : std::true_type
+    {};
+
+    template <class BinaryOperation, class E, class Scalar>
+    struct is_math_vector_expression<math_vector_scalar_expression<BinaryOperation, E, Scalar>>
+     : std::true_type
+    {};
+
+    /// @cond false
+    namespace detail
+    {
+        template <class BinaryOperation, class E1, class E2>
+        struct is_math_vector_operation<math_vector_binary_expression<BinaryOperation, E1, E2>>
+         : std::true_type
+        {};
+
+        template <class BinaryOperation, class E, class Scalar>
+        struct is_math_vector_operation<math_vector_scalar_expression<BinaryOperation, E, Scalar>>
+         : std::true_type
+        {};
+    }
+    // namespace detail
+    /// @endcond
+
+    /// @cond false
+    namespace detail
+    {
+        /* Вектор того же вида, что и Vector (с той же стратегией проверок,
+        способом хранения и т.д.), но с элементами типа Value
+        */
+        template <class Vector, class Value>
+        struct rebind_math_vector;
+
+        template <class T, class Check, class A, class Value>
+        struct rebind_math_vector<math_vector<T, Check, A>, Value>
+        {
+            using type = math_vector<Value, Check,
+                                     typename std::allocator_traits<A>::template rebind_alloc<Value>>;
+        };
+
+        /* Вид вектора, в котором следует хранить результат выражения с двумя
+        операндами, вычисляемыми в Vector1 и Vector2. По умолчанию -- вид первого
+        операнда, специализации могут отдавать предпочтение второму (например,
+        если его размерность известна на этапе компиляции).
+        */
+        template <class Vector1, class Vector2>
+        struct common_math_vector
+        {
+            using type = Vector1;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Специализация класса-характеристики для определения типа значения,
+    в котором следует хранить результат вычисления выражения
+    @tparam BinaryOperation тип бинарной операции
+    @tparam E1, E2 типы операндов
+
+    Вид результата (распределитель памяти, способ хранения) определяется
+    операндами выражения.
+    */
+    template <class BinaryOperation, class E1, class E2>
+    struct evaluated_type<math_vector_binary_expression<BinaryOperation, E1, E2>>
+    {
+    private:
+        using Expression = math_vector_binary_expression<BinaryOperation, E1, E2>;
+        using Common = typename detail::common_math_vector<evaluated_type_t<E1>,
+                                                           evaluated_type_t<E2>>::type;
+
+    public:
+        /// @brief Тип-результат
+        using type = typename detail::rebind_math_vector<Common,
+                                                         typename Expression::value_type>::type;
+    };
+
+    /** @brief Специализация класса-характеристики для определения типа значения,
+    в котором следует хранить результат вычисления выражения
+    @tparam BinaryOperation тип бинарной операции
+    @tparam E тип операнда-вектора
+    @tparam Scalar тип скаляра
+    */
+    template <class BinaryOperation, class E, class Scalar>
+    struct evaluated_type<math_vector_scalar_expression<BinaryOperation, E, Scalar>>
+    {
+    private:
+        using Expression = math_vector_scalar_expression<BinaryOperation, E, Scalar>;
+
+    public:
+        /// @brief Тип-результат
+        using type = typename detail::rebind_math_vector<evaluated_type_t<E>,
+                                                         typename Expression::value_type>::type;
+    };
+
     // Линейные операции
     //@{
     /** @brief Умножение вектора на скаляр
     @param x вектор
     @param a скаляр
-    @return Вектор, размерность которого равна размерности @c x, а элементы
+    @return Выражение, размерность которого равна размерности @c x, а элементы
     равны соответствующим элементам вектора @c x, умноженным на скаляр @c a
     */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator*(math_vector<T, Check> x,
-              typename math_vector<T, Check>::value_type const & a)
+    template <class E, class = detail::enable_if_vector_expression_t<E>>
+    math_vector_scalar_expression<std::multiplies<>, detail::expression_operand_t<E>,
+                                  typename std::decay_t<E>::value_type>
+    operator*(E && x, typename std::decay_t<E>::value_type const & a)
     {
-        x *= a;
-        return x;
+        return {std::forward<E>(x), a};
     }
 
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator*(typename math_vector<T, Check>::value_type const & a,
-              math_vector<T, Check> const & x)
+    template <class E, class = detail::enable_if_vector_expression_t<E>>
+    math_vector_scalar_expression<detail::reversed_multiplies, detail::expression_operand_t<E>,
+                                  typename std::decay_t<E>::value_type>
+    operator*(typename std::decay_t<E>::value_type const & a, E && x)
     {
-        return x * a;
+        return {std::forward<E>(x), a};
     }
     //@}
 
@@ -425,99 +1136,113 @@ inline namespace v1
     @param x вектор
     @param a скаляр
     @pre <tt>a != 0</tt>
-    @return Вектор, размерность которого равна размерности @c x, а элементы
+    @return Выражение, размерность которого равна размерности @c x, а элементы
     равны соответствующим элементам вектора @c x, делённого на скаляр @c a
+    @throw То же, что <tt> Check::check_division_by_zero(a) </tt>
     */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator/(math_vector<T, Check> x,
-               typename math_vector<T, Check>::value_type const & a)
+    template <class E, class = detail::enable_if_vector_expression_t<E>>
+    math_vector_scalar_expression<std::divides<>, detail::expression_operand_t<E>,
+                                  typename std::decay_t<E>::value_type>
+    operator/(E && x, typename std::decay_t<E>::value_type const & a)
     {
-        x /= a;
-        return x;
+        using Check = typename std::decay_t<E>::check_policy;
+        Check::check_division_by_zero(a);
+
+        return {std::forward<E>(x), a};
     }
 
     /** @brief Оператор сложения двух векторов
     @param x, y слагаемые
     @pre <tt>x.dim() == y.dim()</tt>
-    @return Вектор, размерность которого равна размерности слагаемых, а элементы
-    равны сумме соответствующих элементов слагаемых.
-    @throw То же, что <tt> Check::ensure_equal_dimensions(*this, x) </tt>
-    */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator+(math_vector<T, Check> x, math_vector<T, Check> const & y)
-    {
-        x += y;
-        return x;
-    }
+    @return Выражение, размерность которого равна размерности слагаемых, а
+    элементы равны сумме соответствующих элементов слагаемых.
+    @throw То же, что <tt> Check::ensure_equal_dimensions(x, y) </tt>
 
-    /** @brief Оператор сложения двух векторов с разными типами элементов
-    @param x, y слагаемые
-    @pre <tt>x.dim() == y.dim()</tt>
-    @return Вектор, размерность которого равна размерности операндов, а элементы
-    равны сумме соответствующих элементов @c x и @c y.
-    @throw То же, что <tt> Check::ensure_equal_dimensions(*this, x) </tt>
+    Типы элементов слагаемых могут различаться, но стратегии проверок должны
+    совпадать.
     */
-    template <class T1, class T2, class Check>
-    auto operator+(math_vector<T1, Check> const & x,
-                   math_vector<T2, Check> const & y)
-    -> math_vector<decltype(x[0] + y[0]), Check>
+    template <class E1, class E2, class = detail::enable_if_vector_expressions_t<E1, E2>>
+    math_vector_binary_expression<std::plus<>, detail::expression_operand_t<E1>,
+                                  detail::expression_operand_t<E2>>
+    operator+(E1 && x, E2 && y)
     {
-        math_vector<decltype(x[0] + y[0]), Check> result(x);
-
-        result += y;
+        using Check = typename std::decay_t<E1>::check_policy;
+        Check::ensure_equal_dimensions(x, y);
 
-        return result;
+        return {std::forward<E1>(x), std::forward<E2>(y)};
     }
 
     /** @brief Оператор вычитания двух векторов
     @param x уменьшаемое
     @param y вычитаемое
     @pre <tt>x.dim() == y.dim()</tt>
-    @return Вектор, размерность которого равна размерности операндов, а элементы
-    равны разности соответствующих элементов @c x и @c y.
-    @throw То же, что <tt> Check::ensure_equal_dimensions(*this, x) </tt>
+    @return Выражение, размерность которого равна размерности операндов, а
+    элементы равны разности соответствующих элементов @c x и @c y.
+    @throw То же, что <tt> Check::ensure_equal_dimensions(x, y) </tt>
+
+    Типы элементов операндов могут различаться, но стратегии проверок должны
+    совпадать.
     */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator-(math_vector<T, Check> x, math_vector<T, Check> const & y)
+    template <class E1, class E2, class = detail::enable_if_vector_expressions_t<E1, E2>>
+    math_vector_binary_expression<std::minus<>, detail::expression_operand_t<E1>,
+                                  detail::expression_operand_t<E2>>
+    operator-(E1 && x, E2 && y)
     {
-        x -= y;
-        return x;
+        using Check = typename std::decay_t<E1>::check_policy;
+        Check::ensure_equal_dimensions(x, y);
+
+        return {std::forward<E1>(x), std::forward<E2>(y)};
     }
 
-    /** @brief Оператор вычитания двух векторов с разными типами элементов
-    @param x уменьшаемое
-    @param y вычитаемое
-    @pre <tt>x.dim() == y.dim()</tt>
-    @return Вектор, размерность которого равна размерности операндов, а элементы
-    равны разности соответствующих элементов @c x и @c y.
-    @throw То же, что <tt> Check::ensure_equal_dimensions(*this, x) </tt>
+    // Равенство
+    /** @brief Оператор "равно" для выражений разных типов
+    @param x, y аргументы
+    @return @b true, если размерности @c x и @c y совпадают, а их соответствующие
+    элементы равны, иначе -- @b false.
     */
-    template <class T1, class T2, class Check>
-    auto operator-(math_vector<T1, Check> const & x,
-                   math_vector<T2, Check> const & y)
-    -> math_vector<decltype(x[0] - y[0]), Check>
+    template <class E1, class E2, class = detail::enable_if_vector_expressions_t<E1, E2>>
+    bool operator==(E1 const & x, E2 const & y)
     {
-        math_vector<decltype(x[0] - y[0]), Check> result(x);
+        if(x.dim() != y.dim())
+        {
+            return false;
+        }
+
+        for(auto index = decltype(x.dim())(0); index != x.dim(); ++ index)
+        {
+            if(!(detail::math_vector_access::element(x, index)
+                 == detail::math_vector_access::element(y, index)))
+            {
+                return false;
+            }
+        }
 
-        result -= y;
+        return true;
+    }
 
-        return result;
+    /** @brief Оператор "не равно" для выражений разных типов
+    @param x, y аргументы
+    @return <tt>!(x == y)</tt>
+    */
+    template <class E1, class E2, class = detail::enable_if_vector_expressions_t<E1, E2>>
+    bool operator!=(E1 const & x, E2 const & y)
+    {
+        return !(x == y);
     }
 
     /** @brief Специализация класса-характеристики для определения типа среднего
     для векторов
     @tparam T тип элементов
     @tparam Check тип стратегии проверок
+    @tparam A тип распределителя памяти
     @tparam W тип весов
     */
-    template <class T, class Check, class W>
-    struct average_type<math_vector<T, Check>, W>
+    template <class T, class Check, class A, class W>
+    struct average_type<math_vector<T, Check, A>, W>
     {
         /// @brief Тип-результат
-        using type = math_vector<grabin::average_type_t<T, W>, Check>;
+        using type = typename detail::rebind_math_vector<math_vector<T, Check, A>,
+                                                         grabin::average_type_t<T, W>>::type;
     };
 }
 // namespace v1
@@ -0,0 +1,341 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_MATH_VECTOR_VIEW_HPP_INCLUDED
+#define Z_GRABIN_MATH_MATH_VECTOR_VIEW_HPP_INCLUDED
+
+/** @file grabin/math/math_vector_view.hpp
+ @brief Математический вектор, не владеющий своими элементами
+*/
+
+#include <grabin/math/math_vector.hpp>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Математический вектор, не владеющий своими элементами
+    @tparam T тип элементов, может быть константным
+    @tparam CheckPolicy стратегия проверок и обработки ошибок
+
+    Представление ссылается на непрерывный массив элементов, которым владеет
+    другой объект (например, буфер, полученный из отображённого в память файла
+    или из сети). Это позволяет применять к таким данным линейные операции и
+    алгоритмы линейной алгебры без копирования. Пользователь должен
+    гарантировать, что массив существует, пока используется представление.
+
+    Представление является выражением, поэтому может участвовать в линейных
+    операциях вместе с другими векторами. Копирование представления не
+    копирует элементы, но присваивание (в том числе составное) изменяет
+    элементы, на которые оно ссылается, как это делает присваивание ссылке.
+    */
+    template <class T, class CheckPolicy = math_vector_throws_check_policy>
+    class math_vector_view
+     : grabin::operators::container_equality::enable_adl
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::remove_cv_t<T>;
+
+        /// @brief Тип элементов с учётом константности
+        using element_type = T;
+
+        /// @brief Тип для представления размера и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Тип для представления разности итераторов
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = T *;
+
+        /// @brief Тип константного итератора
+        using const_iterator = T const *;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = CheckPolicy;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param data указатель на первый элемент массива
+        @param dim количество элементов массива
+        @pre <tt>[data; data + dim)</tt> является допустимым интервалом
+        @post <tt>this->data() == data</tt>
+        @post <tt>this->dim() == dim</tt>
+        */
+        math_vector_view(T * data, size_type dim)
+         : data_(data)
+         , dim_(dim)
+        {
+            assert(dim >= 0);
+        }
+
+        /** @brief Конструктор на основе вектора с непрерывным хранением
+        элементов
+        @param x вектор, например, @c math_vector или @c fixed_math_vector
+        @post <tt>this->data() == x.data()</tt>
+        @post <tt>this->dim() == x.dim()</tt>
+        */
+        template <class Vector,
+                  class = std::enable_if_t<std::is_convertible<decltype(std::declval<Vector&>().data()), T*>::value>,
+                  class = decltype(std::declval<Vector&>().dim())>
+        math_vector_view(Vector & x)
+         : math_vector_view(x.data(), x.dim())
+        {}
+
+        /// @brief Конструктор копий
+        math_vector_view(math_vector_view const &) = default;
+
+        /** @brief Присваивание элементов
+        @param x вектор той же размерности
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Элементы, на которые ссылается <tt>*this</tt>, равны
+        соответствующим элементам @c x
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        math_vector_view & operator=(math_vector_view const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](T & a, T const & b) { a = b; });
+            return *this;
+        }
+
+        /** @brief Присваивание выражения
+        @param expr выражение, результатом которого является вектор
+        @pre <tt>expr.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Элементы, на которые ссылается <tt>*this</tt>, равны
+        соответствующим элементам @c expr
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, expr)</tt>
+
+        Выражение может содержать ссылки на те же элементы.
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        math_vector_view & operator=(Expression const & expr)
+        {
+            check_policy::ensure_equal_dimensions(*this, expr);
+
+            this->assign_elementwise(expr, [](T & x, auto const & y) { x = y; });
+            return *this;
+        }
+
+        // Размер
+        //@{
+        /// @brief Размерность вектора
+        size_type dim() const
+        {
+            return this->dim_;
+        }
+
+        size_type size() const
+        {
+            return this->dim();
+        }
+        //@}
+
+        // Доступ к данным
+        /** @brief Индексированный доступ к данным
+        @param index индекс элемента
+        @return Ссылка на элемент с индексом @c index
+        @throw То же, что <tt>check_policy::check_index(*this, index)</tt>
+        */
+        T & operator[](size_type index) const
+        {
+            check_policy::check_index(*this, index);
+
+            return this->data_[index];
+        }
+
+        /** @brief Индексированный доступ к данным c проверкой индекса
+        @param index индекс элемента
+        @return Ссылка на элемент с индексом @c index
+        std::out_of_range, если @c index не принадлежит интервалу
+        <tt>[0;x.dim())</tt>
+        */
+        T & at(size_type index) const
+        {
+            if(index < 0 || this->dim() <= index)
+            {
+                throw std::out_of_range("math_vector_view::at - Invalid index");
+            }
+
+            return this->data_[index];
+        }
+
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент вектора
+        */
+        T * data() const
+        {
+            return this->data_;
+        }
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов
+        iterator begin() const
+        {
+            return this->data_;
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+        //@}
+
+        //@{
+        /// @brief Итератор конца последовательности элементов
+        iterator end() const
+        {
+            return this->data_ + this->dim_;
+        }
+
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+        //@}
+
+        // Линейные операции
+        /** @brief Умножение вектора на скаляр
+        @param a скаляр
+        @return <tt> *this </tt>
+        @post Каждый элемент <tt>*this</tt> умножается на @c a
+        */
+        math_vector_view & operator*=(value_type const & a)
+        {
+            grabin::kernels::scale(this->dim(), a, this->data());
+            return *this;
+        }
+
+        /** @brief Деление вектора на скаляр
+        @param a скаляр
+        @return <tt> *this </tt>
+        @post Каждый элемент <tt>*this</tt> делится на @c a
+        */
+        math_vector_view & operator/=(value_type const & a)
+        {
+            check_policy::check_division_by_zero(a);
+
+            grabin::kernels::divide(this->dim(), a, this->data());
+            return *this;
+        }
+
+        /** @brief Прибавление выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        math_vector_view & operator+=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](T & a, auto const & b) { a += b; });
+
+            return *this;
+        }
+
+        /** @brief Вычитание выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Из каждого элемента <tt>*this</tt> вычитаются соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        math_vector_view & operator-=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](T & a, auto const & b) { a -= b; });
+
+            return *this;
+        }
+
+    private:
+        friend struct detail::math_vector_access;
+
+        T & element(size_type index) const
+        {
+            return this->data_[index];
+        }
+
+        template <class Expression, class Assign>
+        void assign_elementwise(Expression const & expr, Assign assign)
+        {
+            assert(expr.dim() == this->dim());
+
+            for(auto index = size_type(0); index != this->dim_; ++ index)
+            {
+                assign(this->data_[index], detail::math_vector_access::element(expr, index));
+            }
+        }
+
+        T * data_;
+        size_type dim_;
+    };
+
+    template <class T, class Check>
+    struct is_math_vector_expression<math_vector_view<T, Check>>
+     : std::true_type
+    {};
+
+    /** @brief Специализация класса-характеристики для определения типа значения,
+    в котором следует хранить результат вычисления выражения
+    @tparam T тип элементов
+    @tparam Check стратегия проверок
+
+    Значения представлений хранятся в векторах, владеющих своими элементами.
+    */
+    template <class T, class Check>
+    struct evaluated_type<math_vector_view<T, Check>>
+    {
+        /// @brief Тип-результат
+        using type = math_vector<std::remove_cv_t<T>, Check>;
+    };
+
+    /** @brief Создание представления для вектора с непрерывным хранением
+    элементов
+    @param x вектор
+    @return <tt>math_vector_view<T, Check>(x)</tt>, где @c T -- тип элементов
+    @c x с учётом константности, а @c Check -- стратегия проверок @c x
+    */
+    template <class Vector>
+    auto make_math_vector_view(Vector & x)
+    {
+        using T = std::remove_pointer_t<decltype(x.data())>;
+        return math_vector_view<T, typename std::remove_const_t<Vector>::check_policy>(x);
+    }
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_MATH_VECTOR_VIEW_HPP_INCLUDED
@@ -23,22 +23,33 @@ Grabin -- это свободной программное обеспечени
 */
 
 #include <grabin/math/math_vector.hpp>
+#include <grabin/math/matrix_layout.hpp>
 #include <grabin/view/indices.hpp>
 
 namespace grabin
 {
 inline namespace v1
 {
+    template <class T, class Check, class Layout>
+    class matrix_view;
+
     /** @brief Шаблон класса матрицы
     @tparam T тип элементов
     @tparam Check стратегия проверок и обработки ошибок
+    @tparam Allocator тип распределителя памяти
+    @tparam Layout стратегия размещения элементов в памяти: @c row_major (по
+    строкам) или @c column_major (по столбцам)
+
+    Итераторы и функция-член @c data() предоставляют доступ к элементам в
+    порядке их размещения в памяти.
     */
-    template <class T, class Check = grabin::math_vector_throws_check_policy>
+    template <class T, class Check = grabin::math_vector_throws_check_policy,
+              class Allocator = std::allocator<T>, class Layout = grabin::row_major>
     class matrix
      : grabin::operators::container_equality::enable_adl
     {
         // @todo Может быть использовать менее жёсткую стратегию проверок здесь?
-        using Data = grabin::math_vector<T, Check>;
+        using Data = grabin::math_vector<T, Check, Allocator>;
 
     public:
         // Типы
@@ -57,6 +68,12 @@ inline namespace v1
         /// @brief Стратегия проверок и обработки ошибок
         using check_policy = Check;
 
+        /// @brief Тип распределителя памяти
+        using allocator_type = Allocator;
+
+        /// @brief Стратегия размещения элементов в памяти
+        using layout_type = Layout;
+
         // Создание, копирование, уничтожение
         /** @brief Конструктор без параметров
         @post <tt>this->dim1() == 0</tt>
@@ -68,18 +85,43 @@ inline namespace v1
         /** @brief Конструктор с указанием размерностей
         @param rows количество строк
         @param cols количество столбцов
+        @param alloc распределитель памяти
         @post <tt> this->dim1() == rows</tt>
         @post <tt> this->dim2() == cols</tt>
         @post <tt> this->size() == rows*cols</tt>
         @post Для @c i из интервала <tt>[0;rows)</tt> и @c j из интервала <tt>[0;cols)</tt>
         выполняется <tt>(*this)(i, j) == 0</tt>
         */
-        matrix(size_type rows, size_type cols)
-         : data_(rows*cols)
+        matrix(size_type rows, size_type cols,
+               allocator_type const & alloc = allocator_type())
+         : data_(rows*cols, alloc)
          , rows_(rows)
          , cols_(cols)
         {}
 
+        /** @brief Конструктор с указанием размерностей без инициализации
+        элементов
+        @param rows количество строк
+        @param cols количество столбцов
+        @param alloc распределитель памяти
+        @post <tt> this->dim1() == rows</tt>
+        @post <tt> this->dim2() == cols</tt>
+        @post Элементы <tt>*this</tt> инициализированы по умолчанию, то есть
+        для встроенных типов их значения не определены
+        */
+        matrix(size_type rows, size_type cols, no_init_t,
+               allocator_type const & alloc = allocator_type())
+         : data_(rows*cols, grabin::no_init, alloc)
+         , rows_(rows)
+         , cols_(cols)
+        {}
+
+        /// @brief Распределитель памяти
+        allocator_type get_allocator() const
+        {
+            return this->data_.get_allocator();
+        }
+
         // Размерность
         /// @brief Количество строк матрицы
         size_type dim1() const
@@ -118,7 +160,7 @@ inline namespace v1
         value_type const & operator()(size_type row, size_type col) const
         {
             check_policy::check_index(*this, row, col);
-            return this->data_[row*this->cols_ + col];
+            return this->data_[layout_type::offset(row, col, this->rows_, this->cols_)];
         }
 
         value_type & operator()(size_type row, size_type col)
@@ -127,6 +169,121 @@ inline namespace v1
         }
         //@}
 
+        //@{
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент матрицы, элементы хранятся в
+        порядке, определяемом @c layout_type
+        */
+        value_type * data()
+        {
+            return this->data_.data();
+        }
+
+        value_type const * data() const
+        {
+            return this->data_.data();
+        }
+        //@}
+
+        // Представления частей матрицы
+        //@{
+        /** @brief Строка матрицы
+        @param index номер строки
+        @return <tt>this->view().row(index)</tt>
+        */
+        auto row(size_type index)
+        {
+            return this->view().row(index);
+        }
+
+        auto row(size_type index) const
+        {
+            return this->view().row(index);
+        }
+        //@}
+
+        //@{
+        /** @brief Столбец матрицы
+        @param index номер столбца
+        @return <tt>this->view().col(index)</tt>
+        */
+        auto col(size_type index)
+        {
+            return this->view().col(index);
+        }
+
+        auto col(size_type index) const
+        {
+            return this->view().col(index);
+        }
+        //@}
+
+        //@{
+        /** @brief Главная диагональ матрицы
+        @return <tt>this->view().diagonal()</tt>
+        */
+        auto diagonal()
+        {
+            return this->view().diagonal();
+        }
+
+        auto diagonal() const
+        {
+            return this->view().diagonal();
+        }
+        //@}
+
+        //@{
+        /** @brief Подматрица
+        @param row первая строка подматрицы
+        @param col первый столбец подматрицы
+        @param rows количество строк подматрицы
+        @param cols количество столбцов подматрицы
+        @return <tt>this->view().block(row, col, rows, cols)</tt>
+        @throw std::out_of_range, если подматрица не содержится в <tt>*this</tt>
+        */
+        auto block(size_type row, size_type col, size_type rows, size_type cols)
+        {
+            return this->view().block(row, col, rows, cols);
+        }
+
+        auto block(size_type row, size_type col, size_type rows, size_type cols) const
+        {
+            return this->view().block(row, col, rows, cols);
+        }
+        //@}
+
+        //@{
+        /** @brief Транспонированная матрица без копирования элементов
+        @return <tt>this->view().transposed()</tt>
+        */
+        auto transposed()
+        {
+            return this->view().transposed();
+        }
+
+        auto transposed() const
+        {
+            return this->view().transposed();
+        }
+        //@}
+
+        //@{
+        /** @brief Представление всей матрицы
+        @return @c matrix_view, ссылающееся на элементы <tt>*this</tt>, с той
+        же стратегией проверок и размещения элементов
+        */
+        matrix_view<value_type, check_policy, layout_type> view()
+        {
+            return {this->data(), this->rows_, this->cols_};
+        }
+
+        matrix_view<value_type const, check_policy, layout_type> view() const
+        {
+            return {this->data(), this->rows_, this->cols_};
+        }
+        //@}
+
         // Итераторы
         //@{
         /// @brief Итератор начала последовательности элементов
@@ -199,14 +356,7 @@ inline namespace v1
         {
             check_policy::ensure_equal_dimensions(*this, x);
 
-            auto dest = this->begin();
-            auto src = x.begin();
-            auto const src_last = x.end();
-
-            for(; src != src_last; ++src, ++ dest)
-            {
-                *dest += *src;
-            }
+            this->data_ += x.data_;
 
             return *this;
         }
@@ -225,19 +375,19 @@ inline namespace v1
     @return Матрица, размерности которой равны размерностям @c x, а элементы
     равны соответствующим элементам @c x, умноженным на скаляр @c a.
     */
-    template <class T, class Check>
-    matrix<T, Check>
-    operator*(matrix<T, Check> x,
-              typename matrix<T, Check>::value_type const & a)
+    template <class T, class Check, class A, class L>
+    matrix<T, Check, A, L>
+    operator*(matrix<T, Check, A, L> x,
+              typename matrix<T, Check, A, L>::value_type const & a)
     {
         x *= a;
         return x;
     }
 
-    template <class T, class Check>
-    matrix<T, Check>
-    operator*(typename matrix<T, Check>::value_type const & a,
-              matrix<T, Check> const & x)
+    template <class T, class Check, class A, class L>
+    matrix<T, Check, A, L>
+    operator*(typename matrix<T, Check, A, L>::value_type const & a,
+              matrix<T, Check, A, L> const & x)
     {
         return x * a;
     }
@@ -249,10 +399,10 @@ inline namespace v1
     @return Матрица, размерности которой равны размерностям @c x, а элементы
     равны соответствующим элементам @c x, делённым на скаляр @c a.
     */
-    template <class T, class Check>
-    matrix<T, Check>
-    operator/(matrix<T, Check> x,
-              typename matrix<T, Check>::value_type const & a)
+    template <class T, class Check, class A, class L>
+    matrix<T, Check, A, L>
+    operator/(matrix<T, Check, A, L> x,
+              typename matrix<T, Check, A, L>::value_type const & a)
     {
         x /= a;
         return x;
@@ -266,44 +416,390 @@ inline namespace v1
     элементы равны сумме соответствующих элементов слагаемых.
     @throw То же, что <tt> Check::ensure_equal_dimensions(*this, x) </tt>
     */
-    template <class T, class Check>
-    matrix<T, Check>
-    operator+(matrix<T, Check> x, matrix<T, Check> const & y)
+    template <class T, class Check, class A, class L>
+    matrix<T, Check, A, L>
+    operator+(matrix<T, Check, A, L> x, matrix<T, Check, A, L> const & y)
     {
         x += y;
         return x;
     }
 
+    /// @cond false
+    namespace detail
+    {
+        /* Расстояние между началами соседних строк (при хранении по строкам)
+        или столбцов (при хранении по столбцам)
+        */
+        template <class Matrix>
+        auto leading_dimension(Matrix const & A, int)
+        -> decltype(A.stride())
+        {
+            return A.stride();
+        }
+
+        template <class Matrix>
+        std::ptrdiff_t leading_dimension(Matrix const & A, long)
+        {
+            return grabin::matrix_layout_t<Matrix>::leading_dimension(A.dim1(), A.dim2());
+        }
+
+        // Шаги между соседними строками и столбцами в массиве элементов
+        inline std::pair<std::ptrdiff_t, std::ptrdiff_t>
+        element_strides(grabin::row_major, std::ptrdiff_t ld)
+        {
+            return {ld, 1};
+        }
+
+        inline std::pair<std::ptrdiff_t, std::ptrdiff_t>
+        element_strides(grabin::column_major, std::ptrdiff_t ld)
+        {
+            return {1, ld};
+        }
+
+        /* y = alpha*A*x + beta*y и y = alpha*A^T*x + beta*y: матрица, хранящаяся
+        по столбцам, -- это транспонированная матрица, хранящаяся по строкам,
+        поэтому выбирается ядро, которое читает массив элементов подряд
+        */
+        template <class T>
+        void layout_gemv(grabin::row_major, std::ptrdiff_t m, std::ptrdiff_t n, T const & alpha,
+                         T const * a, std::ptrdiff_t lda, T const * x, T const & beta, T * y)
+        {
+            grabin::kernels::gemv(m, n, alpha, a, lda, x, beta, y);
+        }
+
+        template <class T>
+        void layout_gemv(grabin::column_major, std::ptrdiff_t m, std::ptrdiff_t n, T const & alpha,
+                         T const * a, std::ptrdiff_t lda, T const * x, T const & beta, T * y)
+        {
+            grabin::kernels::gemv_t(n, m, alpha, a, lda, x, beta, y);
+        }
+
+        template <class T>
+        void layout_gemv_t(grabin::row_major, std::ptrdiff_t m, std::ptrdiff_t n, T const & alpha,
+                           T const * a, std::ptrdiff_t lda, T const * x, T const & beta, T * y)
+        {
+            grabin::kernels::gemv_t(m, n, alpha, a, lda, x, beta, y);
+        }
+
+        template <class T>
+        void layout_gemv_t(grabin::column_major, std::ptrdiff_t m, std::ptrdiff_t n, T const & alpha,
+                           T const * a, std::ptrdiff_t lda, T const * x, T const & beta, T * y)
+        {
+            grabin::kernels::gemv(n, m, alpha, a, lda, x, beta, y);
+        }
+
+        template <class T>
+        void layout_ger(grabin::row_major, std::ptrdiff_t m, std::ptrdiff_t n, T const & alpha,
+                        T const * x, T const * y, T * a, std::ptrdiff_t lda)
+        {
+            grabin::kernels::ger(m, n, alpha, x, y, a, lda);
+        }
+
+        template <class T>
+        void layout_ger(grabin::column_major, std::ptrdiff_t m, std::ptrdiff_t n, T const & alpha,
+                        T const * x, T const * y, T * a, std::ptrdiff_t lda)
+        {
+            grabin::kernels::ger(n, m, alpha, y, x, a, lda);
+        }
+
+        // Непрерывно хранящиеся данные обрабатываются ядром без проверок индексов
+        template <class Matrix, class Expression, class Vector>
+        auto matrix_vector_product_impl(Matrix const & A, Expression const & x, Vector & result, int)
+        -> decltype(detail::layout_gemv(grabin::matrix_layout_t<Matrix>{}, A.dim1(), A.dim2(),
+                                        typename Vector::value_type(1), A.data(),
+                                        detail::leading_dimension(A, 0), x.data(),
+                                        typename Vector::value_type(0), result.data()))
+        {
+            using Value = typename Vector::value_type;
+
+            return detail::layout_gemv(grabin::matrix_layout_t<Matrix>{}, A.dim1(), A.dim2(),
+                                       Value(1), A.data(), detail::leading_dimension(A, 0),
+                                       x.data(), Value(0), result.data());
+        }
+
+        template <class Matrix, class Expression, class Vector>
+        void matrix_vector_product_impl(Matrix const & A, Expression const & x, Vector & result, long)
+        {
+            for(auto const & i : grabin::view::indices(A.dim1()))
+            {
+                auto sum = typename Vector::value_type(0);
+
+                for(auto const & j : grabin::view::indices(A.dim2()))
+                {
+                    sum += A(i, j) * x[j];
+                }
+
+                result[i] = sum;
+            }
+        }
+
+        /* Выражения, элементы которых не хранятся непрерывно, вычисляются
+        заранее: это требует O(n) операций, а умножение на матрицу -- O(m*n)
+        */
+        template <class Expression>
+        auto vector_operand(Expression const & x, int)
+        -> decltype(x.data(), x)
+        {
+            return x;
+        }
+
+        template <class Expression>
+        grabin::evaluated_type_t<Expression>
+        vector_operand(Expression const & x, long)
+        {
+            return x;
+        }
+
+        // Элементы result не обязаны быть инициализированы
+        template <class Matrix, class Expression, class Vector>
+        void matrix_vector_product(Matrix const & A, Expression const & x, Vector & result)
+        {
+            detail::matrix_vector_product_impl(A, x, result, 0);
+        }
+
+        template <class Matrix, class Expression>
+        void check_matrix_vector_product(Matrix const & A, Expression const & x)
+        {
+            // @todo Как проверять это через стратегию?
+            if(A.dim2() != x.dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+        }
+
+        template <class Matrix1, class Matrix2>
+        void check_matrix_matrix_product(Matrix1 const & A, Matrix2 const & B)
+        {
+            if(A.dim2() != B.dim1())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+        }
+
+        /* C = alpha*A*B + beta*C. Размещение A и B передаётся ядру через шаги,
+        а если C хранится по столбцам, то вычисляется C^T = B^T * A^T
+        */
+        template <class T, class Matrix1, class Matrix2, class Matrix3>
+        void layout_gemm(grabin::row_major, T const & alpha, Matrix1 const & A, Matrix2 const & B,
+                         T const & beta, Matrix3 & C)
+        {
+            auto const a = detail::element_strides(grabin::matrix_layout_t<Matrix1>{},
+                                                   detail::leading_dimension(A, 0));
+            auto const b = detail::element_strides(grabin::matrix_layout_t<Matrix2>{},
+                                                   detail::leading_dimension(B, 0));
+
+            grabin::kernels::gemm(C.dim1(), C.dim2(), A.dim2(), alpha,
+                                  A.data(), a.first, a.second, B.data(), b.first, b.second,
+                                  beta, C.data(), detail::leading_dimension(C, 0));
+        }
+
+        template <class T, class Matrix1, class Matrix2, class Matrix3>
+        void layout_gemm(grabin::column_major, T const & alpha, Matrix1 const & A, Matrix2 const & B,
+                         T const & beta, Matrix3 & C)
+        {
+            auto const a = detail::element_strides(grabin::matrix_layout_t<Matrix1>{},
+                                                   detail::leading_dimension(A, 0));
+            auto const b = detail::element_strides(grabin::matrix_layout_t<Matrix2>{},
+                                                   detail::leading_dimension(B, 0));
+
+            grabin::kernels::gemm(C.dim2(), C.dim1(), A.dim2(), alpha,
+                                  B.data(), b.second, b.first, A.data(), a.second, a.first,
+                                  beta, C.data(), detail::leading_dimension(C, 0));
+        }
+
+        template <class T, class Matrix1, class Matrix2, class Matrix3>
+        auto matrix_gemm(T const & alpha, Matrix1 const & A, Matrix2 const & B,
+                         T const & beta, Matrix3 & C)
+        -> decltype(grabin::kernels::gemm(C.dim1(), C.dim2(), A.dim2(), alpha,
+                                          A.data(), std::ptrdiff_t(1), std::ptrdiff_t(1),
+                                          B.data(), std::ptrdiff_t(1), std::ptrdiff_t(1),
+                                          beta, C.data(), std::ptrdiff_t(1)))
+        {
+            return detail::layout_gemm(grabin::matrix_layout_t<Matrix3>{}, alpha, A, B, beta, C);
+        }
+
+        /* Количество строк (при хранении по столбцам -- столбцов), элементы
+        которых хранятся подряд, и их длина
+        */
+        template <class Matrix>
+        std::ptrdiff_t storage_lines(Matrix const & A)
+        {
+            return grabin::matrix_layout_t<Matrix>::leading_dimension(A.dim2(), A.dim1());
+        }
+
+        template <class Matrix>
+        std::ptrdiff_t storage_line_length(Matrix const & A)
+        {
+            return grabin::matrix_layout_t<Matrix>::leading_dimension(A.dim1(), A.dim2());
+        }
+
+        // Элементы C не обязаны быть инициализированы
+        template <class Matrix1, class Matrix2, class Matrix3>
+        void matrix_matrix_product(Matrix1 const & A, Matrix2 const & B, Matrix3 & C)
+        {
+            using Value = typename Matrix3::value_type;
+
+            detail::matrix_gemm(Value(1), A, B, Value(0), C);
+        }
+    }
+    // namespace detail
+    /// @endcond
+
     // Умножение матрицы на вектор
+    //@{
     /** @brief Умножение матрицы не вектор
     @param A матрица
-    @param x вектор
+    @param x вектор или выражение, результатом которого является вектор
     @pre <tt>A.dim2() == x.dim()</tt>
     @return Вектор размерности <tt>A.dim1()</tt>, равный произведению матрицы @c A на вектор @c x
     */
-    template <class T, class Check>
+    template <class T, class Check, class A1, class L, class A2>
+    math_vector<T, Check, A2>
+    operator*(matrix<T, Check, A1, L> const & A, math_vector<T, Check, A2> const & x)
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        math_vector<T, Check, A2> result(A.dim1(), grabin::no_init, x.get_allocator());
+
+        detail::matrix_vector_product(A, x, result);
+
+        return result;
+    }
+
+    template <class T, class Check, class A1, class L, class E,
+              class = detail::enable_if_vector_expression_t<E>>
     math_vector<T, Check>
-    operator*(matrix<T, Check> const & A, math_vector<T, Check> const & x)
+    operator*(matrix<T, Check, A1, L> const & A, E const & x)
     {
-        // @todo Как проверять это через стратегию?
-        if(A.dim2() != x.dim())
-        {
-            throw std::logic_error("Incompatible dimensions");
-        }
+        detail::check_matrix_vector_product(A, x);
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        math_vector<T, Check> result(A.dim1(), grabin::no_init);
 
-        math_vector<T, Check> result(A.dim1());
+        detail::matrix_vector_product(A, x_value, result);
+
+        return result;
+    }
+    //@}
+
+    /** @brief Умножение матриц
+    @param A, B матрицы
+    @pre <tt>A.dim2() == B.dim1()</tt>
+    @return Матрица размера <tt>A.dim1() x B.dim2()</tt>, равная произведению
+    @c A на @c B, с тем же размещением элементов, что и у @c A
+    @throw std::logic_error, если <tt>A.dim2() != B.dim1()</tt>
+
+    Для @c float и @c double используется блочный алгоритм с упаковкой панелей
+    и векторизованным микроядром (см. <tt>kernels::gemm</tt>).
+    */
+    template <class T, class Check, class A1, class L1, class A2, class L2>
+    matrix<T, Check, A1, L1>
+    operator*(matrix<T, Check, A1, L1> const & A, matrix<T, Check, A2, L2> const & B)
+    {
+        detail::check_matrix_matrix_product(A, B);
+
+        matrix<T, Check, A1, L1> result(A.dim1(), B.dim2(), grabin::no_init, A.get_allocator());
+
+        detail::matrix_matrix_product(A, B, result);
+
+        return result;
+    }
+
+    // Транспонирование
+    /** @brief Транспонирование матрицы
+    @param A матрица с непрерывным хранением элементов, например, @c matrix
+    или @c matrix_view
+    @return Матрица @c B размера <tt>A.dim2() x A.dim1()</tt> с тем же
+    размещением элементов, что и у @c A, такая, что <tt>B(j, i) == A(i, j)</tt>
+
+    Элементы копируются кэш-независимым рекурсивным алгоритмом (см.
+    <tt>kernels::transpose</tt>). Если копия не нужна, следует использовать
+    функцию-член @c transposed, возвращающую представление.
+    */
+    template <class Matrix,
+              class = decltype(std::declval<Matrix const &>().data())>
+    grabin::evaluated_type_t<Matrix>
+    transpose(Matrix const & A)
+    {
+        auto result = grabin::make_no_init<grabin::evaluated_type_t<Matrix>>(A.dim2(), A.dim1());
+
+        kernels::transpose(detail::storage_lines(A), detail::storage_line_length(A),
+                           A.data(), detail::leading_dimension(A, 0),
+                           result.data(), detail::leading_dimension(result, 0));
+
+        return result;
+    }
 
-        for(auto const & i : grabin::view::indices(A.dim1()))
-        for(auto const & j : grabin::view::indices(A.dim2()))
+    /** @brief Транспонирование квадратной матрицы на месте
+    @param A матрица или представление матрицы с непрерывным хранением
+    элементов
+    @pre <tt>A.dim1() == A.dim2()</tt>
+    @post Элементы @c A, симметричные относительно главной диагонали,
+    обменены значениями
+    @throw std::logic_error, если матрица не является квадратной
+    */
+    template <class Matrix>
+    void transpose_in_place(Matrix && A)
+    {
+        if(A.dim1() != A.dim2())
         {
-            result[i] += A(i, j) * x[j];
+            throw std::logic_error("Matrix must be square");
         }
 
-        return result;
+        kernels::transpose(A.dim1(), A.data(), detail::leading_dimension(A, 0));
     }
 
 namespace linear_algebra
 {
+    /** @brief Класс-характеристика для определения типа матрицы, являющейся
+    внешним произведением векторов
+    @tparam Vector тип векторов (не выражений)
+
+    Специализации позволяют сохранять вид векторов в результате, например,
+    получать матрицы фиксированных размерностей для векторов фиксированной
+    размерности.
+    */
+    template <class Vector>
+    struct outer_product_type
+    {
+        /// @brief Тип-результат
+        using type = matrix<typename Vector::value_type>;
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        template <class Matrix, class T, class Vector1, class Vector2>
+        auto outer_product_accumulate(Matrix & A, T const & alpha,
+                                      Vector1 const & x, Vector2 const & y, int)
+        -> decltype(grabin::detail::layout_ger(grabin::matrix_layout_t<Matrix>{},
+                                               A.dim1(), A.dim2(), alpha, x.data(), y.data(),
+                                               A.data(), grabin::detail::leading_dimension(A, 0)))
+        {
+            return grabin::detail::layout_ger(grabin::matrix_layout_t<Matrix>{},
+                                              A.dim1(), A.dim2(), alpha, x.data(), y.data(),
+                                              A.data(), grabin::detail::leading_dimension(A, 0));
+        }
+
+        template <class Matrix, class T, class Vector1, class Vector2>
+        void outer_product_accumulate(Matrix & A, T const & alpha,
+                                      Vector1 const & x, Vector2 const & y, long)
+        {
+            for(auto const & i : grabin::view::indices_of(x))
+            {
+                auto const a_xi = alpha * x[i];
+
+                for(auto const & j : grabin::view::indices_of(y))
+                {
+                    A(i, j) += a_xi * y[j];
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
     /** @brief Тип функционального объекта для вычисления внешнего произведения
     векторов
     */
@@ -317,10 +813,11 @@ namespace linear_algebra
         <tt>(i, j)</tt> равен <tt>x[i]*y[j]</tt>.
         */
         template <class Vector>
-        matrix<typename Vector::value_type>
+        typename outer_product_type<grabin::evaluated_type_t<Vector>>::type
         operator()(Vector const & x, Vector const & y) const
         {
-            matrix<typename Vector::value_type> result(x.dim(), y.dim());
+            using Result = typename outer_product_type<grabin::evaluated_type_t<Vector>>::type;
+            auto result = grabin::make_no_init<Result>(x.dim(), y.dim());
 
             for(auto const & i : grabin::view::indices_of(x))
             for(auto const & j : grabin::view::indices_of(y))
@@ -330,6 +827,34 @@ namespace linear_algebra
 
             return result;
         }
+
+        /** @brief Прибавление внешнего произведения векторов к матрице "на
+        месте": <tt>A += alpha*x*y^T</tt>
+        @param A изменяемая матрица
+        @param alpha скаляр
+        @param x,y векторы
+        @pre @c A не пересекается с @c x и @c y
+        @throw std::logic_error, если <tt>A.dim1() != x.dim()</tt> или
+        <tt>A.dim2() != y.dim()</tt>
+
+        Не выделяет память. Если элементы всех аргументов хранятся
+        непрерывно, то строки (или столбцы) @c A обновляются векторизованным
+        ядром @c axpy. Этой функцией пользуется
+        @c statistics::variance_accumulator, чтобы не создавать новую матрицу
+        для каждого обрабатываемого значения.
+        */
+        template <class Matrix, class Scalar, class Vector1, class Vector2>
+        void accumulate(Matrix & A, Scalar const & alpha,
+                        Vector1 const & x, Vector2 const & y) const
+        {
+            if(A.dim1() != x.dim() || A.dim2() != y.dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            using Value = typename Matrix::value_type;
+            detail::outer_product_accumulate(A, static_cast<Value>(alpha), x, y, 0);
+        }
     };
 }
 // namespace linear_algebra
@@ -338,5 +863,8 @@ namespace linear_algebra
 }
 // namespace grabin
 
+// Представления строк, столбцов и подматриц, возвращаемые функциями-членами
+#include <grabin/math/matrix_view.hpp>
+
 #endif
 // Z_GRABIN_MATH_MATRIX_HPP_INCLUDED
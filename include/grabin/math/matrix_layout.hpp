@@ -0,0 +1,167 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_MATRIX_LAYOUT_HPP_INCLUDED
+#define Z_GRABIN_MATH_MATRIX_LAYOUT_HPP_INCLUDED
+
+/** @file grabin/math/matrix_layout.hpp
+ @brief Стратегии размещения элементов матрицы в памяти
+*/
+
+#include <cstddef>
+#include <type_traits>
+
+namespace grabin
+{
+inline namespace v1
+{
+    struct column_major;
+
+    /** @brief Стратегия размещения элементов матрицы по строкам
+
+    Соседние элементы одной строки расположены в памяти рядом, начала соседних
+    строк отстоят друг от друга на количество столбцов.
+    */
+    struct row_major
+    {
+        /** @brief Стратегия размещения, при которой тот же массив представляет
+        транспонированную матрицу
+        */
+        using transposed = column_major;
+
+        /** @brief Смещение элемента от начала массива
+        @param row номер строки
+        @param col номер столбца
+        @param rows количество строк
+        @param cols количество столбцов
+        */
+        static constexpr std::ptrdiff_t
+        offset(std::ptrdiff_t row, std::ptrdiff_t col, std::ptrdiff_t, std::ptrdiff_t cols)
+        {
+            return row * cols + col;
+        }
+
+        /** @brief Смещение элемента от начала массива, в котором начала
+        соседних строк отстоят друг от друга на заданное расстояние
+        @param row номер строки
+        @param col номер столбца
+        @param ld расстояние между началами соседних строк
+        */
+        static constexpr std::ptrdiff_t
+        offset(std::ptrdiff_t row, std::ptrdiff_t col, std::ptrdiff_t ld)
+        {
+            return row * ld + col;
+        }
+
+        /** @brief Расстояние между началами соседних строк
+        @param rows количество строк
+        @param cols количество столбцов
+        */
+        static constexpr std::ptrdiff_t
+        leading_dimension(std::ptrdiff_t, std::ptrdiff_t cols)
+        {
+            return cols;
+        }
+    };
+
+    /** @brief Стратегия размещения элементов матрицы по столбцам
+
+    Соседние элементы одного столбца расположены в памяти рядом, начала
+    соседних столбцов отстоят друг от друга на количество строк.
+    */
+    struct column_major
+    {
+        /** @brief Стратегия размещения, при которой тот же массив представляет
+        транспонированную матрицу
+        */
+        using transposed = row_major;
+
+        /** @brief Смещение элемента от начала массива
+        @param row номер строки
+        @param col номер столбца
+        @param rows количество строк
+        @param cols количество столбцов
+        */
+        static constexpr std::ptrdiff_t
+        offset(std::ptrdiff_t row, std::ptrdiff_t col, std::ptrdiff_t rows, std::ptrdiff_t)
+        {
+            return col * rows + row;
+        }
+
+        /** @brief Смещение элемента от начала массива, в котором начала
+        соседних столбцов отстоят друг от друга на заданное расстояние
+        @param row номер строки
+        @param col номер столбца
+        @param ld расстояние между началами соседних столбцов
+        */
+        static constexpr std::ptrdiff_t
+        offset(std::ptrdiff_t row, std::ptrdiff_t col, std::ptrdiff_t ld)
+        {
+            return col * ld + row;
+        }
+
+        /** @brief Расстояние между началами соседних столбцов
+        @param rows количество строк
+        @param cols количество столбцов
+        */
+        static constexpr std::ptrdiff_t
+        leading_dimension(std::ptrdiff_t rows, std::ptrdiff_t)
+        {
+            return rows;
+        }
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        template <class Matrix, class = void>
+        struct matrix_layout_impl
+        {
+            using type = row_major;
+        };
+
+        template <class Matrix>
+        struct matrix_layout_impl<Matrix, std::conditional_t<true, void, typename Matrix::layout_type>>
+        {
+            using type = typename Matrix::layout_type;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Класс-характеристика для определения стратегии размещения
+    элементов матрицы
+    @tparam Matrix тип матрицы
+
+    Если в @c Matrix определён тип @c layout_type, то результатом является
+    он, иначе -- @c row_major.
+    */
+    template <class Matrix>
+    struct matrix_layout
+     : detail::matrix_layout_impl<std::decay_t<Matrix>>
+    {};
+
+    /// @brief Тип-синоним для стратегии размещения элементов матрицы
+    template <class Matrix>
+    using matrix_layout_t = typename matrix_layout<Matrix>::type;
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_MATRIX_LAYOUT_HPP_INCLUDED
@@ -0,0 +1,577 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_MATRIX_VIEW_HPP_INCLUDED
+#define Z_GRABIN_MATH_MATRIX_VIEW_HPP_INCLUDED
+
+/** @file grabin/math/matrix_view.hpp
+ @brief Матрица, не владеющая своими элементами
+*/
+
+#include <grabin/math/matrix.hpp>
+#include <grabin/math/math_vector_view.hpp>
+#include <grabin/math/strided_vector_view.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace detail
+    {
+        /* Итератор элементов матрицы, хранящейся по строкам или по столбцам,
+        в порядке их размещения в памяти. Элементы хранятся "линиями" (строками
+        или столбцами) одинаковой длины, начала соседних линий отстоят друг от
+        друга на stride элементов, которое может превышать длину линии
+        */
+        template <class T>
+        class matrix_view_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_cv_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            matrix_view_iterator() = default;
+
+            matrix_view_iterator(T * data, difference_type length, difference_type stride,
+                                 difference_type line, difference_type pos)
+             : data_(data)
+             , length_(length)
+             , stride_(stride)
+             , line_(line)
+             , pos_(pos)
+            {}
+
+            reference operator*() const
+            {
+                return this->data_[this->line_ * this->stride_ + this->pos_];
+            }
+
+            pointer operator->() const
+            {
+                return std::addressof(**this);
+            }
+
+            matrix_view_iterator & operator++()
+            {
+                if(++ this->pos_ == this->length_)
+                {
+                    this->pos_ = 0;
+                    ++ this->line_;
+                }
+
+                return *this;
+            }
+
+            matrix_view_iterator operator++(int)
+            {
+                auto result = *this;
+                ++ *this;
+                return result;
+            }
+
+            friend bool operator==(matrix_view_iterator const & x, matrix_view_iterator const & y)
+            {
+                return x.line_ == y.line_ && x.pos_ == y.pos_;
+            }
+
+            friend bool operator!=(matrix_view_iterator const & x, matrix_view_iterator const & y)
+            {
+                return !(x == y);
+            }
+
+        private:
+            T * data_ = nullptr;
+            difference_type length_ = 0;
+            difference_type stride_ = 0;
+            difference_type line_ = 0;
+            difference_type pos_ = 0;
+        };
+
+        /* Типы представлений строк и столбцов матрицы: линии, вдоль которых
+        элементы хранятся подряд, представляются math_vector_view, остальные --
+        strided_vector_view
+        */
+        template <class T, class Check, class Layout>
+        struct matrix_slices;
+
+        template <class T, class Check>
+        struct matrix_slices<T, Check, grabin::row_major>
+        {
+            using row_type = math_vector_view<T, Check>;
+            using column_type = strided_vector_view<T, Check>;
+
+            static row_type row(T * first, std::ptrdiff_t cols, std::ptrdiff_t)
+            {
+                return {first, cols};
+            }
+
+            static column_type column(T * first, std::ptrdiff_t rows, std::ptrdiff_t ld)
+            {
+                return {first, rows, ld};
+            }
+        };
+
+        template <class T, class Check>
+        struct matrix_slices<T, Check, grabin::column_major>
+        {
+            using row_type = strided_vector_view<T, Check>;
+            using column_type = math_vector_view<T, Check>;
+
+            static row_type row(T * first, std::ptrdiff_t cols, std::ptrdiff_t ld)
+            {
+                return {first, cols, ld};
+            }
+
+            static column_type column(T * first, std::ptrdiff_t rows, std::ptrdiff_t)
+            {
+                return {first, rows};
+            }
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Матрица, не владеющая своими элементами
+    @tparam T тип элементов, может быть константным
+    @tparam Check стратегия проверок и обработки ошибок
+    @tparam Layout стратегия размещения элементов в памяти: @c row_major (по
+    строкам) или @c column_major (по столбцам)
+
+    Представление ссылается на массив, в котором элементы матрицы хранятся по
+    строкам (по столбцам), причём начала соседних строк (столбцов) отстоят друг
+    от друга на @c stride элементов. Шаг, больший длины строки (столбца),
+    позволяет ссылаться на подматрицу или на данные с выравниванием строк.
+    Пользователь должен гарантировать, что массив существует, пока используется
+    представление.
+
+    Как и для @c math_vector_view, копирование представления не копирует
+    элементы, а составное присваивание изменяет элементы, на которые
+    ссылается представление.
+
+    Функции-члены @c row, @c col, @c diagonal и @c block возвращают
+    представления строк, столбцов, диагонали и подматриц, что позволяет
+    записывать блочные алгоритмы без копирования элементов во временные
+    массивы.
+    */
+    template <class T, class Check = grabin::math_vector_throws_check_policy,
+              class Layout = grabin::row_major>
+    class matrix_view
+     : grabin::operators::container_equality::enable_adl
+    {
+        using Slices = detail::matrix_slices<T, Check, Layout>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::remove_cv_t<T>;
+
+        /// @brief Тип элементов с учётом константности
+        using element_type = T;
+
+        /// @brief Тип для представления количества элементов и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = detail::matrix_view_iterator<T>;
+
+        /// @brief Тип констатного итератора
+        using const_iterator = detail::matrix_view_iterator<T const>;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = Check;
+
+        /// @brief Стратегия размещения элементов в памяти
+        using layout_type = Layout;
+
+        /// @brief Тип представления строки
+        using row_type = typename Slices::row_type;
+
+        /// @brief Тип представления столбца
+        using column_type = typename Slices::column_type;
+
+        /// @brief Тип представления диагонали
+        using diagonal_type = strided_vector_view<T, Check>;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param data указатель на первый элемент массива
+        @param rows количество строк
+        @param cols количество столбцов
+        @param stride расстояние (в элементах) между началами соседних строк
+        (столбцов при хранении по столбцам)
+        @pre <tt>rows >= 0 && cols >= 0</tt>
+        @pre @c stride не меньше количества столбцов (строк при хранении по
+        столбцам)
+        @pre Для любых @c i из <tt>[0; rows)</tt>, @c j из <tt>[0; cols)</tt>
+        указатель <tt>data + layout_type::offset(i, j, stride)</tt> ссылается
+        на элемент массива
+        @post <tt>this->data() == data</tt>
+        @post <tt>this->dim1() == rows</tt>
+        @post <tt>this->dim2() == cols</tt>
+        @post <tt>this->stride() == stride</tt>
+        */
+        matrix_view(T * data, size_type rows, size_type cols, size_type stride)
+         : data_(data)
+         , rows_(rows)
+         , cols_(cols)
+         , stride_(stride)
+        {
+            assert(rows >= 0 && cols >= 0);
+            assert(stride >= layout_type::leading_dimension(rows, cols));
+        }
+
+        /** @brief Конструктор для массива без промежутков между строками
+        (столбцами при хранении по столбцам)
+        @param data указатель на первый элемент массива
+        @param rows количество строк
+        @param cols количество столбцов
+        @post <tt>this->stride() == layout_type::leading_dimension(rows, cols)</tt>
+        */
+        matrix_view(T * data, size_type rows, size_type cols)
+         : matrix_view(data, rows, cols, layout_type::leading_dimension(rows, cols))
+        {}
+
+        /** @brief Конструктор на основе матрицы с непрерывным хранением
+        элементов
+        @param A матрица, например, @c matrix или @c fixed_matrix
+        @post <tt>this->data() == A.data()</tt>
+        @post <tt>this->dim() == A.dim()</tt>
+
+        Стратегия размещения элементов @c A должна совпадать с @c Layout.
+        */
+        template <class Matrix,
+                  class = std::enable_if_t<std::is_convertible<decltype(std::declval<Matrix&>().data()), T*>::value>,
+                  class = decltype(std::declval<Matrix&>().dim2()),
+                  class = std::enable_if_t<std::is_same<grabin::matrix_layout_t<Matrix>, Layout>::value>>
+        matrix_view(Matrix & A)
+         : matrix_view(A.data(), A.dim1(), A.dim2())
+        {}
+
+        // Размерность
+        /// @brief Количество строк матрицы
+        size_type dim1() const
+        {
+            return this->rows_;
+        }
+
+        /// @brief Количество столбцов матрицы
+        size_type dim2() const
+        {
+            return this->cols_;
+        }
+
+        /** @brief Размерности матрицы
+        @return <tt>make_pair(this->dim1(), this->dim2())</tt>
+        */
+        std::pair<size_type, size_type> dim() const
+        {
+            return {this->dim1(), this->dim2()};
+        }
+
+        /// @brief Количество элементов матрицы
+        size_type size() const
+        {
+            return this->rows_ * this->cols_;
+        }
+
+        /** @brief Расстояние (в элементах) между началами соседних строк (или
+        столбцов при хранении по столбцам)
+        */
+        size_type stride() const
+        {
+            return this->stride_;
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементам
+        @param rows номер строки
+        @param cols номер столбца
+        @return Ссылка на элемент, расположенный в строке @c row и столбце @c col
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+        */
+        T & operator()(size_type row, size_type col) const
+        {
+            check_policy::check_index(*this, row, col);
+            return this->data_[layout_type::offset(row, col, this->stride_)];
+        }
+
+        /** @brief Доступ к массиву элементов
+        @return Указатель на первый элемент матрицы
+        */
+        T * data() const
+        {
+            return this->data_;
+        }
+
+        /** @brief Строка матрицы
+        @param index номер строки
+        @return Представление строки с номером @c index: @c math_vector_view
+        при хранении по строкам и @c strided_vector_view при хранении по
+        столбцам
+        @throw То же, что <tt>check_policy::check_index(*this, index, 0)</tt>,
+        если матрица содержит хотя бы один столбец
+        */
+        row_type row(size_type index) const
+        {
+            if(this->cols_ > 0)
+            {
+                check_policy::check_index(*this, index, 0);
+            }
+
+            return Slices::row(this->data_ + layout_type::offset(index, 0, this->stride_),
+                               this->cols_, this->stride_);
+        }
+
+        /** @brief Столбец матрицы
+        @param index номер столбца
+        @return Представление столбца с номером @c index: @c strided_vector_view
+        при хранении по строкам и @c math_vector_view при хранении по столбцам
+        @throw То же, что <tt>check_policy::check_index(*this, 0, index)</tt>,
+        если матрица содержит хотя бы одну строку
+        */
+        column_type col(size_type index) const
+        {
+            if(this->rows_ > 0)
+            {
+                check_policy::check_index(*this, 0, index);
+            }
+
+            return Slices::column(this->data_ + layout_type::offset(0, index, this->stride_),
+                                  this->rows_, this->stride_);
+        }
+
+        /** @brief Главная диагональ матрицы
+        @return Представление элементов <tt>(i, i)</tt> для @c i из
+        <tt>[0; min(this->dim1(), this->dim2()))</tt>
+        */
+        diagonal_type diagonal() const
+        {
+            return {this->data_, std::min(this->rows_, this->cols_), this->stride_ + 1};
+        }
+
+        /** @brief Подматрица
+        @param row первая строка подматрицы
+        @param col первый столбец подматрицы
+        @param rows количество строк подматрицы
+        @param cols количество столбцов подматрицы
+        @return Представление подматрицы, левый верхний элемент которой
+        находится в строке @c row и столбце @c col. Представление ссылается на
+        те же элементы, что и <tt>*this</tt>, и имеет тот же шаг.
+        @throw std::out_of_range, если подматрица не содержится в <tt>*this</tt>
+        */
+        matrix_view block(size_type row, size_type col, size_type rows, size_type cols) const
+        {
+            if(row < 0 || col < 0 || rows < 0 || cols < 0
+               || this->rows_ - row < rows || this->cols_ - col < cols)
+            {
+                throw std::out_of_range("matrix_view::block - Invalid block");
+            }
+
+            return matrix_view(this->data_ + layout_type::offset(row, col, this->stride_),
+                               rows, cols, this->stride_);
+        }
+
+        /** @brief Транспонированная матрица
+        @return Представление, ссылающееся на те же элементы, в котором строки
+        и столбцы поменялись местами. Элементы не копируются: изменяется только
+        стратегия размещения, поэтому ядра умножения матрицы на вектор и на
+        матрицу обрабатывают его без промежуточных копий.
+        */
+        matrix_view<T, check_policy, typename layout_type::transposed>
+        transposed() const
+        {
+            return {this->data_, this->cols_, this->rows_, this->stride_};
+        }
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов (в порядке хранения)
+        iterator begin() const
+        {
+            return this->template make_iterator<T>(this->size() == 0 ? this->lines() : 0);
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->template make_iterator<T const>(this->size() == 0 ? this->lines() : 0);
+        }
+        //@}
+
+        //@{
+        /// @brief Итератор конца последовательности элементов
+        iterator end() const
+        {
+            return this->template make_iterator<T>(this->lines());
+        }
+
+        const_iterator cend() const
+        {
+            return this->template make_iterator<T const>(this->lines());
+        }
+        //@}
+
+        // Линейные операции
+        /** @brief Умножение матрицы на скаляр
+        @param a скаляр
+        @post Каждый элементы <tt>*this</tt> умножается на @c y
+        @return <tt>*this</tt>
+        */
+        matrix_view & operator*=(value_type const & a)
+        {
+            for(auto const & i : grabin::view::indices(this->lines()))
+            {
+                this->line(i) *= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Деление матрицы на скаляр
+        @param a скаляр
+        @post Каждый элементы <tt>*this</tt> делится на @c y
+        @return <tt>*this</tt>
+        */
+        matrix_view & operator/=(value_type const & a)
+        {
+            check_policy::check_division_by_zero(a);
+
+            for(auto const & i : grabin::view::indices(this->lines()))
+            {
+                this->line(i) /= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Прибавление матрицы
+        @param x матрица или представление матрицы
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Matrix>
+        matrix_view & operator+=(Matrix const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            for(auto const & i : grabin::view::indices(this->rows_))
+            for(auto const & j : grabin::view::indices(this->cols_))
+            {
+                this->data_[layout_type::offset(i, j, this->stride_)] += x(i, j);
+            }
+
+            return *this;
+        }
+
+    private:
+        // Строки (столбцы при хранении по столбцам), элементы которых хранятся подряд
+        size_type lines() const
+        {
+            return detail::storage_lines(*this);
+        }
+
+        size_type line_length() const
+        {
+            return detail::storage_line_length(*this);
+        }
+
+        math_vector_view<T, check_policy> line(size_type index) const
+        {
+            return {this->data_ + index * this->stride_, this->line_length()};
+        }
+
+        template <class U>
+        detail::matrix_view_iterator<U> make_iterator(size_type line) const
+        {
+            return {this->data_, this->line_length(), this->stride_, line, 0};
+        }
+
+        T * data_;
+        size_type rows_;
+        size_type cols_;
+        size_type stride_;
+    };
+
+    /** @brief Специализация класса-характеристики для определения типа значения,
+    в котором следует хранить результат вычисления выражения
+    @tparam T тип элементов
+    @tparam Check стратегия проверок
+    @tparam Layout стратегия размещения элементов
+
+    Значения представлений матриц хранятся в матрицах, владеющих своими
+    элементами, с той же стратегией размещения элементов.
+    */
+    template <class T, class Check, class Layout>
+    struct evaluated_type<matrix_view<T, Check, Layout>>
+    {
+        /// @brief Тип-результат
+        using type = matrix<std::remove_cv_t<T>, Check, std::allocator<std::remove_cv_t<T>>, Layout>;
+    };
+
+    /** @brief Умножение представления матрицы не вектор
+    @param A матрица
+    @param x вектор или выражение, результатом которого является вектор
+    @pre <tt>A.dim2() == x.dim()</tt>
+    @return Вектор размерности <tt>A.dim1()</tt>, равный произведению матрицы @c A на вектор @c x
+    */
+    template <class T, class Check, class L, class E,
+              class = detail::enable_if_vector_expression_t<E>>
+    math_vector<std::remove_cv_t<T>, Check>
+    operator*(matrix_view<T, Check, L> const & A, E const & x)
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        math_vector<std::remove_cv_t<T>, Check> result(A.dim1(), grabin::no_init);
+
+        detail::matrix_vector_product(A, x_value, result);
+
+        return result;
+    }
+
+    /** @brief Создание представления для матрицы с непрерывным хранением
+    элементов
+    @param A матрица
+    @return <tt>matrix_view<T, Check, Layout>(A)</tt>, где @c T -- тип
+    элементов @c A с учётом константности, @c Check -- стратегия проверок, а
+    @c Layout -- стратегия размещения элементов @c A
+    */
+    template <class Matrix>
+    auto make_matrix_view(Matrix & A)
+    {
+        using T = std::remove_pointer_t<decltype(A.data())>;
+        return matrix_view<T, typename std::remove_const_t<Matrix>::check_policy,
+                           grabin::matrix_layout_t<Matrix>>(A);
+    }
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_MATRIX_VIEW_HPP_INCLUDED
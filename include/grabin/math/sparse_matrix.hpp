@@ -0,0 +1,654 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_SPARSE_MATRIX_HPP_INCLUDED
+#define Z_GRABIN_MATH_SPARSE_MATRIX_HPP_INCLUDED
+
+/** @file grabin/math/sparse_matrix.hpp
+ @brief Разреженные матрицы в сжатом строчном формате (CSR)
+*/
+
+#include <grabin/execution.hpp>
+#include <grabin/math/matrix.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Разреженная матрица в сжатом строчном формате (Compressed Sparse
+    Row)
+    @tparam T тип элементов
+    @tparam Check стратегия проверок и обработки ошибок
+
+    Хранятся только ненулевые (структурно) элементы: массив значений, массив
+    номеров их столбцов и массив из <tt>dim1() + 1</tt> смещений, такой что
+    элементы строки @c i занимают позиции <tt>[row_offsets()[i];
+    row_offsets()[i+1])</tt>. Внутри строки номера столбцов строго возрастают.
+    Объём памяти пропорционален количеству ненулевых элементов, а не
+    произведению размерностей.
+
+    Матрица неизменяема после создания: для построения по набору троек
+    "строка, столбец, значение" служит @c csr_matrix_builder. Умножение на
+    вектор (<tt>operator*</tt>) позволяет использовать матрицу в итерационных
+    методах, например, @c minimal_residue. Сжатый столбцовый формат (CSC)
+    матрицы @c A совпадает с CSR-форматом матрицы <tt>transpose(A)</tt>.
+    */
+    template <class T, class Check = grabin::math_vector_throws_check_policy>
+    class csr_matrix
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления количества элементов и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = Check;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор без параметров
+        @post <tt>this->dim1() == 0</tt>
+        @post <tt>this->dim2() == 0</tt>
+        */
+        csr_matrix()
+         : csr_matrix(0, 0)
+        {}
+
+        /** @brief Создание нулевой матрицы
+        @param rows количество строк
+        @param cols количество столбцов
+        @pre <tt>rows >= 0 && cols >= 0</tt>
+        @post <tt>this->dim1() == rows</tt>
+        @post <tt>this->dim2() == cols</tt>
+        @post <tt>this->nnz() == 0</tt>
+        */
+        csr_matrix(size_type rows, size_type cols)
+         : rows_(rows)
+         , cols_(cols)
+         , row_offsets_(rows + 1, 0)
+        {
+            assert(rows >= 0 && cols >= 0);
+        }
+
+        /** @brief Создание матрицы из массивов сжатого строчного формата
+        @param rows количество строк
+        @param cols количество столбцов
+        @param row_offsets смещения начал строк
+        @param column_indices номера столбцов элементов
+        @param values значения элементов
+        @post <tt>this->dim1() == rows</tt>
+        @post <tt>this->dim2() == cols</tt>
+        @throw std::logic_error, если массивы не описывают матрицу размера
+        <tt>rows x cols</tt> в сжатом строчном формате
+        */
+        csr_matrix(size_type rows, size_type cols,
+                   std::vector<size_type> row_offsets,
+                   std::vector<size_type> column_indices,
+                   std::vector<value_type> values)
+         : rows_(rows)
+         , cols_(cols)
+         , row_offsets_(std::move(row_offsets))
+         , column_indices_(std::move(column_indices))
+         , values_(std::move(values))
+        {
+            if(!this->is_valid())
+            {
+                throw std::logic_error("csr_matrix: invalid compressed row structure");
+            }
+        }
+
+        // Размерность
+        /// @brief Количество строк матрицы
+        size_type dim1() const
+        {
+            return this->rows_;
+        }
+
+        /// @brief Количество столбцов матрицы
+        size_type dim2() const
+        {
+            return this->cols_;
+        }
+
+        /** @brief Размерности матрицы
+        @return <tt>make_pair(this->dim1(), this->dim2())</tt>
+        */
+        std::pair<size_type, size_type> dim() const
+        {
+            return {this->dim1(), this->dim2()};
+        }
+
+        /// @brief Количество хранимых элементов
+        size_type nnz() const
+        {
+            return static_cast<size_type>(this->values_.size());
+        }
+
+        // Доступ к элементам
+        /** @brief Значение элемента
+        @param row номер строки
+        @param col номер столбца
+        @return Значение элемента, расположенного в строке @c row и столбце
+        @c col, или <tt>value_type(0)</tt>, если этот элемент не хранится
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+
+        Элемент ищется двоичным поиском в строке @c row.
+        */
+        value_type operator()(size_type row, size_type col) const
+        {
+            check_policy::check_index(*this, row, col);
+
+            auto const first = this->column_indices_.begin() + this->row_offsets_[row];
+            auto const last = this->column_indices_.begin() + this->row_offsets_[row + 1];
+
+            auto const pos = std::lower_bound(first, last, col);
+
+            if(pos == last || *pos != col)
+            {
+                return value_type(0);
+            }
+
+            return this->values_[pos - this->column_indices_.begin()];
+        }
+
+        /// @brief Смещения начал строк в массивах номеров столбцов и значений
+        std::vector<size_type> const & row_offsets() const
+        {
+            return this->row_offsets_;
+        }
+
+        /// @brief Номера столбцов хранимых элементов
+        std::vector<size_type> const & column_indices() const
+        {
+            return this->column_indices_;
+        }
+
+        /// @brief Значения хранимых элементов
+        std::vector<value_type> const & values() const
+        {
+            return this->values_;
+        }
+
+        // Линейные операции
+        /** @brief Умножение матрицы на скаляр
+        @param a скаляр
+        @post Каждый хранимый элемент <tt>*this</tt> умножается на @c a
+        @return <tt>*this</tt>
+        */
+        csr_matrix & operator*=(value_type const & a)
+        {
+            for(auto & x : this->values_)
+            {
+                x *= a;
+            }
+
+            return *this;
+        }
+
+    private:
+        bool is_valid() const
+        {
+            if(this->rows_ < 0 || this->cols_ < 0
+               || static_cast<size_type>(this->row_offsets_.size()) != this->rows_ + 1
+               || this->column_indices_.size() != this->values_.size()
+               || this->row_offsets_.front() != 0
+               || this->row_offsets_.back() != this->nnz())
+            {
+                return false;
+            }
+
+            // Смещения проверяются до обращения к номерам столбцов по ним
+            for(auto const & i : grabin::view::indices(this->rows_))
+            {
+                if(this->row_offsets_[i + 1] < this->row_offsets_[i]
+                   || this->row_offsets_[i + 1] > this->nnz())
+                {
+                    return false;
+                }
+            }
+
+            for(auto const & i : grabin::view::indices(this->rows_))
+            {
+                auto const first = this->row_offsets_[i];
+                auto const last = this->row_offsets_[i + 1];
+
+                for(auto k = first; k != last; ++ k)
+                {
+                    auto const j = this->column_indices_[k];
+
+                    if(j < 0 || j >= this->cols_ || (k != first && j <= this->column_indices_[k - 1]))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        size_type rows_;
+        size_type cols_;
+        std::vector<size_type> row_offsets_;
+        std::vector<size_type> column_indices_;
+        std::vector<value_type> values_;
+    };
+
+    /** @brief Построитель разреженной матрицы по набору троек "строка,
+    столбец, значение"
+    @tparam T тип элементов
+    @tparam Check стратегия проверок и обработки ошибок
+
+    Тройки могут добавляться в любом порядке, значения с одинаковыми индексами
+    складываются.
+    */
+    template <class T, class Check = grabin::math_vector_throws_check_policy>
+    class csr_matrix_builder
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления количества элементов и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = Check;
+
+        /// @brief Тип создаваемой матрицы
+        using matrix_type = csr_matrix<T, Check>;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param rows количество строк
+        @param cols количество столбцов
+        @pre <tt>rows >= 0 && cols >= 0</tt>
+        */
+        csr_matrix_builder(size_type rows, size_type cols)
+         : rows_(rows)
+         , cols_(cols)
+        {
+            assert(rows >= 0 && cols >= 0);
+        }
+
+        // Размерность
+        /// @brief Количество строк матрицы
+        size_type dim1() const
+        {
+            return this->rows_;
+        }
+
+        /// @brief Количество столбцов матрицы
+        size_type dim2() const
+        {
+            return this->cols_;
+        }
+
+        // Добавление элементов
+        /** @brief Резервирование памяти
+        @param n ожидаемое количество троек
+        */
+        void reserve(size_type n)
+        {
+            this->entries_.reserve(n);
+        }
+
+        /** @brief Добавление элемента
+        @param row номер строки
+        @param col номер столбца
+        @param value значение
+        @post Элемент <tt>(row, col)</tt> создаваемой матрицы увеличивается на
+        @c value
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+        */
+        void add(size_type row, size_type col, value_type const & value)
+        {
+            check_policy::check_index(*this, row, col);
+
+            this->entries_.push_back(Entry{row, col, value});
+        }
+
+        /** @brief Создание матрицы
+        @return Разреженная матрица, элементы которой равны суммам значений,
+        добавленных с соответствующими индексами
+
+        Тройки распределяются по строкам сортировкой подсчётом, после чего
+        сортируются элементы каждой строки, поэтому время работы близко к
+        линейному, если в строках немного элементов.
+        */
+        matrix_type build() const
+        {
+            std::vector<size_type> offsets(this->rows_ + 1, 0);
+
+            for(auto const & entry : this->entries_)
+            {
+                ++ offsets[entry.row + 1];
+            }
+
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            std::vector<std::pair<size_type, value_type>> sorted(this->entries_.size());
+            {
+                auto next = offsets;
+
+                for(auto const & entry : this->entries_)
+                {
+                    sorted[next[entry.row] ++] = std::make_pair(entry.col, entry.value);
+                }
+            }
+
+            std::vector<size_type> row_offsets(this->rows_ + 1, 0);
+            std::vector<size_type> column_indices;
+            std::vector<value_type> values;
+
+            column_indices.reserve(sorted.size());
+            values.reserve(sorted.size());
+
+            auto const by_column = [](std::pair<size_type, value_type> const & x,
+                                      std::pair<size_type, value_type> const & y)
+            {
+                return x.first < y.first;
+            };
+
+            for(auto const & i : grabin::view::indices(this->rows_))
+            {
+                auto const first = sorted.begin() + offsets[i];
+                auto const last = sorted.begin() + offsets[i + 1];
+
+                std::stable_sort(first, last, by_column);
+
+                for(auto pos = first; pos != last; ++ pos)
+                {
+                    if(pos != first && pos->first == column_indices.back())
+                    {
+                        values.back() += pos->second;
+                    }
+                    else
+                    {
+                        column_indices.push_back(pos->first);
+                        values.push_back(pos->second);
+                    }
+                }
+
+                row_offsets[i + 1] = static_cast<size_type>(values.size());
+            }
+
+            return matrix_type(this->rows_, this->cols_, std::move(row_offsets),
+                               std::move(column_indices), std::move(values));
+        }
+
+    private:
+        struct Entry
+        {
+            size_type row;
+            size_type col;
+            value_type value;
+        };
+
+        size_type rows_;
+        size_type cols_;
+        std::vector<Entry> entries_;
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        // y[i] = sum_j A(i, j) * x[j] для строк i из [first; last)
+        template <class T, class Check>
+        void csr_multiply_rows(csr_matrix<T, Check> const & A, T const * x, T * y,
+                               std::ptrdiff_t first, std::ptrdiff_t last)
+        {
+            auto const offsets = A.row_offsets().data();
+            auto const columns = A.column_indices().data();
+            auto const values = A.values().data();
+
+            for(auto i = first; i != last; ++ i)
+            {
+                auto sum = T(0);
+
+                for(auto k = offsets[i]; k != offsets[i + 1]; ++ k)
+                {
+                    sum += values[k] * x[columns[k]];
+                }
+
+                y[i] = sum;
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    // Умножение на вектор без выделения памяти
+    //@{
+    /** @brief Умножение разреженной матрицы на вектор с записью результата в
+    заданный вектор
+    @param policy политика выполнения: @c execution::seq или
+    @c execution::par
+    @param A разреженная матрица
+    @param x вектор
+    @param y вектор, в который записывается результат
+    @pre <tt>A.dim2() == x.dim() && A.dim1() == y.dim()</tt>
+    @pre @c x и @c y не перекрываются
+    @post <tt>y == A*x</tt>
+    @throw std::logic_error, если размерности не согласованы
+
+    Элементы обоих векторов должны храниться непрерывно. Память не
+    выделяется, поэтому эту функцию удобно использовать в итерационных
+    методах, где произведение вычисляется на каждом шаге.
+    */
+    template <class T, class Check, class Vector1, class Vector2>
+    auto multiply(execution::sequenced_policy, csr_matrix<T, Check> const & A,
+                  Vector1 const & x, Vector2 && y)
+    -> decltype(detail::csr_multiply_rows(A, x.data(), y.data(), 0, 0))
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        if(y.dim() != A.dim1())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        detail::csr_multiply_rows(A, x.data(), y.data(), 0, A.dim1());
+    }
+
+    template <class T, class Check, class Vector1, class Vector2>
+    auto multiply(execution::parallel_policy const & policy, csr_matrix<T, Check> const & A,
+                  Vector1 const & x, Vector2 && y)
+    -> decltype(detail::csr_multiply_rows(A, x.data(), y.data(), 0, 0))
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        if(y.dim() != A.dim1())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        auto const x_data = x.data();
+        auto const y_data = y.data();
+
+        execution::detail::blocked_for(policy, A.dim1(),
+                                       [&](std::ptrdiff_t first, std::ptrdiff_t last)
+        {
+            detail::csr_multiply_rows(A, x_data, y_data, first, last);
+        });
+    }
+    //@}
+
+    // Умножение на вектор
+    //@{
+    /** @brief Умножение разреженной матрицы на вектор
+    @param policy политика выполнения: @c execution::seq или
+    @c execution::par
+    @param A разреженная матрица
+    @param x вектор или выражение, результатом которого является вектор
+    @pre <tt>A.dim2() == x.dim()</tt>
+    @return Вектор размерности <tt>A.dim1()</tt>, равный <tt>A*x</tt>
+    @throw std::logic_error, если <tt>A.dim2() != x.dim()</tt>
+
+    При параллельном выполнении строки делятся на блоки размера
+    <tt>policy.grain_size()</tt>, каждая компонента результата вычисляется
+    одним потоком в том же порядке, что и при последовательном, поэтому
+    результаты совпадают в точности.
+    */
+    template <class T, class Check, class Vector>
+    math_vector<T, Check>
+    multiply(execution::sequenced_policy, csr_matrix<T, Check> const & A, Vector const & x)
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        math_vector<T, Check> result(A.dim1(), grabin::no_init);
+
+        grabin::multiply(execution::seq, A, x_value, result);
+
+        return result;
+    }
+
+    template <class T, class Check, class Vector>
+    math_vector<T, Check>
+    multiply(execution::parallel_policy const & policy, csr_matrix<T, Check> const & A,
+             Vector const & x)
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        math_vector<T, Check> result(A.dim1(), grabin::no_init);
+
+        grabin::multiply(policy, A, x_value, result);
+
+        return result;
+    }
+    //@}
+
+    /** @brief Умножение разреженной матрицы на вектор
+    @param A разреженная матрица
+    @param x вектор или выражение, результатом которого является вектор
+    @return <tt>multiply(execution::seq, A, x)</tt>
+    */
+    template <class T, class Check, class E,
+              class = detail::enable_if_vector_expression_t<E>>
+    math_vector<T, Check>
+    operator*(csr_matrix<T, Check> const & A, E const & x)
+    {
+        return grabin::multiply(execution::seq, A, x);
+    }
+
+    /** @brief Умножение транспонированной разреженной матрицы на вектор
+    @param A разреженная матрица
+    @param x вектор или выражение, результатом которого является вектор
+    @pre <tt>A.dim1() == x.dim()</tt>
+    @return Вектор размерности <tt>A.dim2()</tt>, равный <tt>A^T * x</tt>
+    @throw std::logic_error, если <tt>A.dim1() != x.dim()</tt>
+
+    Строки @c A, умноженные на соответствующие компоненты @c x, прибавляются
+    к результату, так что транспонированная матрица не строится. Если
+    произведение вычисляется многократно, быстрее один раз построить
+    <tt>transpose(A)</tt> и умножать её (в том числе параллельно).
+    */
+    template <class T, class Check, class Vector>
+    math_vector<T, Check>
+    multiply_transposed(csr_matrix<T, Check> const & A, Vector const & x)
+    {
+        if(A.dim1() != x.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        math_vector<T, Check> result(A.dim2(), T(0));
+
+        auto const offsets = A.row_offsets().data();
+        auto const columns = A.column_indices().data();
+        auto const values = A.values().data();
+        auto const x_data = x_value.data();
+        auto const y_data = result.data();
+
+        for(auto i = std::ptrdiff_t(0); i != A.dim1(); ++ i)
+        {
+            auto const x_i = x_data[i];
+
+            for(auto k = offsets[i]; k != offsets[i + 1]; ++ k)
+            {
+                y_data[columns[k]] += values[k] * x_i;
+            }
+        }
+
+        return result;
+    }
+
+    /** @brief Транспонирование разреженной матрицы
+    @param A разреженная матрица
+    @return Разреженная матрица <tt>A^T</tt>, то есть @c A в сжатом столбцовом
+    формате
+
+    Элементы распределяются по столбцам сортировкой подсчётом за время
+    <tt>O(A.nnz() + A.dim1() + A.dim2())</tt>. Номера столбцов результата
+    возрастают без дополнительной сортировки, так как строки @c A
+    просматриваются по порядку.
+    */
+    template <class T, class Check>
+    csr_matrix<T, Check>
+    transpose(csr_matrix<T, Check> const & A)
+    {
+        using size_type = typename csr_matrix<T, Check>::size_type;
+
+        std::vector<size_type> row_offsets(A.dim2() + 1, 0);
+
+        for(auto const & j : A.column_indices())
+        {
+            ++ row_offsets[j + 1];
+        }
+
+        std::partial_sum(row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+        std::vector<size_type> column_indices(A.nnz());
+        std::vector<T> values(A.nnz());
+
+        auto next = row_offsets;
+
+        for(auto const & i : grabin::view::indices(A.dim1()))
+        {
+            for(auto k = A.row_offsets()[i]; k != A.row_offsets()[i + 1]; ++ k)
+            {
+                auto const pos = next[A.column_indices()[k]] ++;
+
+                column_indices[pos] = i;
+                values[pos] = A.values()[k];
+            }
+        }
+
+        return csr_matrix<T, Check>(A.dim2(), A.dim1(), std::move(row_offsets),
+                                    std::move(column_indices), std::move(values));
+    }
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_SPARSE_MATRIX_HPP_INCLUDED
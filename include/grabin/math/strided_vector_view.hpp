@@ -0,0 +1,493 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_STRIDED_VECTOR_VIEW_HPP_INCLUDED
+#define Z_GRABIN_MATH_STRIDED_VECTOR_VIEW_HPP_INCLUDED
+
+/** @file grabin/math/strided_vector_view.hpp
+ @brief Математический вектор, элементы которого расположены в массиве с
+ постоянным шагом
+*/
+
+#include <grabin/math/math_vector.hpp>
+
+#include <iterator>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace detail
+    {
+        /* Итератор произвольного доступа, перемещающийся по массиву с заданным
+        шагом. Хранится указатель на первый элемент последовательности и номер
+        текущего элемента, а адрес элемента вычисляется только при
+        разыменовании: указатель за последний элемент при шаге больше единицы
+        вышел бы за пределы массива, что приводит к неопределённому поведению.
+        */
+        template <class T>
+        class strided_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_cv_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            strided_iterator() = default;
+
+            strided_iterator(T * data, difference_type stride, difference_type index = 0)
+             : data_(data)
+             , stride_(stride)
+             , index_(index)
+            {}
+
+            // Неконстантный итератор преобразуется в константный
+            template <class U,
+                      class = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+            strided_iterator(strided_iterator<U> const & other)
+             : data_(other.data())
+             , stride_(other.stride())
+             , index_(other.index())
+            {}
+
+            T * data() const
+            {
+                return this->data_;
+            }
+
+            difference_type stride() const
+            {
+                return this->stride_;
+            }
+
+            difference_type index() const
+            {
+                return this->index_;
+            }
+
+            reference operator*() const
+            {
+                return this->data_[this->index_ * this->stride_];
+            }
+
+            pointer operator->() const
+            {
+                return this->data_ + this->index_ * this->stride_;
+            }
+
+            reference operator[](difference_type n) const
+            {
+                return this->data_[(this->index_ + n) * this->stride_];
+            }
+
+            strided_iterator & operator++()
+            {
+                ++ this->index_;
+                return *this;
+            }
+
+            strided_iterator operator++(int)
+            {
+                auto result = *this;
+                ++ *this;
+                return result;
+            }
+
+            strided_iterator & operator--()
+            {
+                -- this->index_;
+                return *this;
+            }
+
+            strided_iterator operator--(int)
+            {
+                auto result = *this;
+                -- *this;
+                return result;
+            }
+
+            strided_iterator & operator+=(difference_type n)
+            {
+                this->index_ += n;
+                return *this;
+            }
+
+            strided_iterator & operator-=(difference_type n)
+            {
+                this->index_ -= n;
+                return *this;
+            }
+
+            friend strided_iterator operator+(strided_iterator x, difference_type n)
+            {
+                x += n;
+                return x;
+            }
+
+            friend strided_iterator operator+(difference_type n, strided_iterator x)
+            {
+                x += n;
+                return x;
+            }
+
+            friend strided_iterator operator-(strided_iterator x, difference_type n)
+            {
+                x -= n;
+                return x;
+            }
+
+            friend difference_type operator-(strided_iterator const & x, strided_iterator const & y)
+            {
+                return x.index_ - y.index_;
+            }
+
+            friend bool operator==(strided_iterator const & x, strided_iterator const & y)
+            {
+                return x.index_ == y.index_;
+            }
+
+            friend bool operator!=(strided_iterator const & x, strided_iterator const & y)
+            {
+                return !(x == y);
+            }
+
+            friend bool operator<(strided_iterator const & x, strided_iterator const & y)
+            {
+                return x.index_ < y.index_;
+            }
+
+            friend bool operator>(strided_iterator const & x, strided_iterator const & y)
+            {
+                return y < x;
+            }
+
+            friend bool operator<=(strided_iterator const & x, strided_iterator const & y)
+            {
+                return !(y < x);
+            }
+
+            friend bool operator>=(strided_iterator const & x, strided_iterator const & y)
+            {
+                return !(x < y);
+            }
+
+        private:
+            T * data_ = nullptr;
+            difference_type stride_ = 1;
+            difference_type index_ = 0;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Математический вектор, элементы которого расположены в массиве
+    с постоянным шагом
+    @tparam T тип элементов, может быть константным
+    @tparam CheckPolicy стратегия проверок и обработки ошибок
+
+    Такие представления возвращают функции-члены матриц, дающие доступ к
+    столбцам матрицы, хранящейся по строкам (и к строкам матрицы, хранящейся по
+    столбцам), а также к диагонали. Как и @c math_vector_view, представление
+    не владеет элементами, является выражением, а присваивание (в том числе
+    составное) изменяет элементы, на которые оно ссылается.
+
+    В отличие от @c math_vector_view, элементы хранятся не подряд, поэтому
+    функция-член @c data() не предоставляется и векторизованные ядра к таким
+    представлениям не применяются.
+    */
+    template <class T, class CheckPolicy = math_vector_throws_check_policy>
+    class strided_vector_view
+     : grabin::operators::container_equality::enable_adl
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::remove_cv_t<T>;
+
+        /// @brief Тип элементов с учётом константности
+        using element_type = T;
+
+        /// @brief Тип для представления размера и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Тип для представления разности итераторов
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = detail::strided_iterator<T>;
+
+        /// @brief Тип константного итератора
+        using const_iterator = detail::strided_iterator<T const>;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = CheckPolicy;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param data указатель на первый элемент
+        @param dim количество элементов
+        @param stride расстояние (в элементах массива) между соседними
+        элементами вектора
+        @pre <tt>dim >= 0 && stride > 0</tt>
+        @pre Для всех @c i из <tt>[0; dim)</tt> указатель <tt>data + i*stride</tt>
+        ссылается на элемент массива
+        @post <tt>this->dim() == dim</tt>
+        @post <tt>this->stride() == stride</tt>
+        */
+        strided_vector_view(T * data, size_type dim, size_type stride)
+         : data_(data)
+         , dim_(dim)
+         , stride_(stride)
+        {
+            assert(dim >= 0);
+            assert(stride > 0);
+        }
+
+        /// @brief Конструктор копий
+        strided_vector_view(strided_vector_view const &) = default;
+
+        /** @brief Присваивание элементов
+        @param x вектор той же размерности
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Элементы, на которые ссылается <tt>*this</tt>, равны
+        соответствующим элементам @c x
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        strided_vector_view & operator=(strided_vector_view const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](T & a, T const & b) { a = b; });
+            return *this;
+        }
+
+        /** @brief Присваивание выражения
+        @param expr выражение, результатом которого является вектор
+        @pre <tt>expr.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Элементы, на которые ссылается <tt>*this</tt>, равны
+        соответствующим элементам @c expr
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, expr)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        strided_vector_view & operator=(Expression const & expr)
+        {
+            check_policy::ensure_equal_dimensions(*this, expr);
+
+            this->assign_elementwise(expr, [](T & x, auto const & y) { x = y; });
+            return *this;
+        }
+
+        // Размер
+        //@{
+        /// @brief Размерность вектора
+        size_type dim() const
+        {
+            return this->dim_;
+        }
+
+        size_type size() const
+        {
+            return this->dim();
+        }
+        //@}
+
+        /// @brief Расстояние (в элементах массива) между соседними элементами
+        size_type stride() const
+        {
+            return this->stride_;
+        }
+
+        // Доступ к данным
+        /** @brief Индексированный доступ к данным
+        @param index индекс элемента
+        @return Ссылка на элемент с индексом @c index
+        @throw То же, что <tt>check_policy::check_index(*this, index)</tt>
+        */
+        T & operator[](size_type index) const
+        {
+            check_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+        /** @brief Индексированный доступ к данным c проверкой индекса
+        @param index индекс элемента
+        @return Ссылка на элемент с индексом @c index
+        std::out_of_range, если @c index не принадлежит интервалу
+        <tt>[0;x.dim())</tt>
+        */
+        T & at(size_type index) const
+        {
+            if(index < 0 || this->dim() <= index)
+            {
+                throw std::out_of_range("strided_vector_view::at - Invalid index");
+            }
+
+            return this->element(index);
+        }
+
+        // Итераторы
+        //@{
+        /// @brief Итератор начала последовательности элементов
+        iterator begin() const
+        {
+            return iterator(this->data_, this->stride_);
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+        //@}
+
+        //@{
+        /// @brief Итератор конца последовательности элементов
+        iterator end() const
+        {
+            return iterator(this->data_, this->stride_, this->dim_);
+        }
+
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+        //@}
+
+        // Линейные операции
+        /** @brief Умножение вектора на скаляр
+        @param a скаляр
+        @return <tt> *this </tt>
+        @post Каждый элемент <tt>*this</tt> умножается на @c a
+        */
+        strided_vector_view & operator*=(value_type const & a)
+        {
+            for(auto index = size_type(0); index != this->dim_; ++ index)
+            {
+                this->element(index) *= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Деление вектора на скаляр
+        @param a скаляр
+        @return <tt> *this </tt>
+        @post Каждый элемент <tt>*this</tt> делится на @c a
+        */
+        strided_vector_view & operator/=(value_type const & a)
+        {
+            check_policy::check_division_by_zero(a);
+
+            for(auto index = size_type(0); index != this->dim_; ++ index)
+            {
+                this->element(index) /= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Прибавление выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        strided_vector_view & operator+=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](T & a, auto const & b) { a += b; });
+
+            return *this;
+        }
+
+        /** @brief Вычитание выражения
+        @param x вектор или выражение, результатом которого является вектор
+        @pre <tt>x.dim() == this->dim()</tt>
+        @return <tt>*this</tt>
+        @post Из каждого элемента <tt>*this</tt> вычитаются соответствующий
+        элемент @c x
+        @throws То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        template <class Expression,
+                  class = std::enable_if_t<is_math_vector_expression<Expression>::value>>
+        strided_vector_view & operator-=(Expression const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            this->assign_elementwise(x, [](T & a, auto const & b) { a -= b; });
+
+            return *this;
+        }
+
+    private:
+        friend struct detail::math_vector_access;
+
+        T & element(size_type index) const
+        {
+            return this->data_[index * this->stride_];
+        }
+
+        template <class Expression, class Assign>
+        void assign_elementwise(Expression const & expr, Assign assign)
+        {
+            assert(expr.dim() == this->dim());
+
+            for(auto index = size_type(0); index != this->dim_; ++ index)
+            {
+                assign(this->element(index), detail::math_vector_access::element(expr, index));
+            }
+        }
+
+        T * data_;
+        size_type dim_;
+        size_type stride_;
+    };
+
+    template <class T, class Check>
+    struct is_math_vector_expression<strided_vector_view<T, Check>>
+     : std::true_type
+    {};
+
+    /** @brief Специализация класса-характеристики для определения типа значения,
+    в котором следует хранить результат вычисления выражения
+    @tparam T тип элементов
+    @tparam Check стратегия проверок
+    */
+    template <class T, class Check>
+    struct evaluated_type<strided_vector_view<T, Check>>
+    {
+        /// @brief Тип-результат
+        using type = math_vector<std::remove_cv_t<T>, Check>;
+    };
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_STRIDED_VECTOR_VIEW_HPP_INCLUDED
@@ -0,0 +1,455 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MATH_SYMMETRIC_MATRIX_HPP_INCLUDED
+#define Z_GRABIN_MATH_SYMMETRIC_MATRIX_HPP_INCLUDED
+
+/** @file grabin/math/symmetric_matrix.hpp
+ @brief Симметричные матрицы, хранящиеся в упакованном виде
+*/
+
+#include <grabin/math/kernels.hpp>
+#include <grabin/math/matrix.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Симметричная матрица, хранящая только верхний треугольник
+    @tparam T тип элементов
+    @tparam Check стратегия проверок и обработки ошибок
+
+    Элементы <tt>(i, j)</tt> и <tt>(j, i)</tt> матрицы порядка @c n -- это
+    один и тот же объект. Верхний треугольник хранится по столбцам в
+    непрерывном массиве из <tt>n*(n+1)/2</tt> элементов (упакованный формат
+    BLAS/LAPACK с параметром @c 'U'), то есть требуется примерно вдвое меньше
+    памяти, чем для @c matrix. Линейные операции, симметричное обновление
+    ранга один и умножение на вектор также обрабатывают только хранимые
+    элементы.
+
+    Функция-член @c data() намеренно отсутствует, так как элементы не
+    хранятся в виде плотной матрицы, вместо неё есть @c packed_data().
+    */
+    template <class T, class Check = grabin::math_vector_throws_check_policy>
+    class symmetric_matrix
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления количества элементов и индексов
+        using size_type = std::ptrdiff_t;
+
+        /// @brief Стратегия проверок и обработки ошибок
+        using check_policy = Check;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор без аргументов
+        @post <tt>this->dim1() == 0 && this->dim2() == 0</tt>
+        */
+        symmetric_matrix()
+         : symmetric_matrix(0)
+        {}
+
+        /** @brief Создание нулевой матрицы
+        @param n порядок матрицы
+        @pre <tt>n >= 0</tt>
+        @post <tt>this->dim1() == n && this->dim2() == n</tt>
+        @post Все элементы равны нулю
+        */
+        explicit symmetric_matrix(size_type n)
+         : n_(n)
+         , data_(n * (n + 1) / 2, value_type(0))
+        {
+            assert(n >= 0);
+        }
+
+        // Размерность
+        /// @brief Количество строк матрицы
+        size_type dim1() const
+        {
+            return this->n_;
+        }
+
+        /// @brief Количество столбцов матрицы
+        size_type dim2() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Размерности матрицы
+        @return <tt>make_pair(this->dim1(), this->dim2())</tt>
+        */
+        std::pair<size_type, size_type> dim() const
+        {
+            return {this->dim1(), this->dim2()};
+        }
+
+        /// @brief Количество хранимых элементов, равное <tt>n*(n+1)/2</tt>
+        size_type packed_size() const
+        {
+            return static_cast<size_type>(this->data_.size());
+        }
+
+        // Доступ к элементам
+        //@{
+        /** @brief Доступ к элементам
+        @param row номер строки
+        @param col номер столбца
+        @return Ссылка на элемент, расположенный в строке @c row и столбце
+        @c col. Ссылки, возвращаемые для <tt>(row, col)</tt> и
+        <tt>(col, row)</tt>, указывают на один и тот же объект.
+        @throw То же, что <tt>check_policy::check_index(*this, row, col)</tt>
+        */
+        value_type const & operator()(size_type row, size_type col) const
+        {
+            check_policy::check_index(*this, row, col);
+
+            if(row > col)
+            {
+                std::swap(row, col);
+            }
+
+            return this->data_[col * (col + 1) / 2 + row];
+        }
+
+        value_type & operator()(size_type row, size_type col)
+        {
+            return const_cast<value_type&>(grabin::as_const(*this)(row, col));
+        }
+        //@}
+
+        //@{
+        /** @brief Доступ к массиву хранимых элементов
+        @return Указатель на начало массива из <tt>this->packed_size()</tt>
+        элементов, в котором по столбцам хранится верхний треугольник: элемент
+        <tt>(i, j)</tt>, где <tt>i <= j</tt>, имеет индекс <tt>j*(j+1)/2 + i</tt>
+        */
+        value_type * packed_data()
+        {
+            return this->data_.data();
+        }
+
+        value_type const * packed_data() const
+        {
+            return this->data_.data();
+        }
+        //@}
+
+        /** @brief Преобразование в плотную матрицу
+        @return Матрица @c A того же порядка, такая что <tt>A(i, j) == (*this)(i, j)</tt>
+        для всех допустимых @c i и @c j
+        */
+        matrix<value_type, check_policy> dense() const
+        {
+            auto result = grabin::make_no_init<matrix<value_type, check_policy>>(this->dim1(), this->dim2());
+
+            auto column = this->data_.data();
+
+            for(auto j = size_type(0); j != this->n_; ++ j, column += j)
+            {
+                for(auto i = size_type(0); i <= j; ++ i)
+                {
+                    result(i, j) = column[i];
+                    result(j, i) = column[i];
+                }
+            }
+
+            return result;
+        }
+
+        // Линейные операции
+        /** @brief Умножение матрицы на скаляр
+        @param a скаляр
+        @post Каждый элемент <tt>*this</tt> умножается на @c a
+        @return <tt>*this</tt>
+        */
+        symmetric_matrix & operator*=(value_type const & a)
+        {
+            kernels::scale(this->packed_size(), a, this->packed_data());
+            return *this;
+        }
+
+        /** @brief Деление матрицы на скаляр
+        @param a скаляр
+        @post Каждый элемент <tt>*this</tt> делится на @c a
+        @return <tt>*this</tt>
+        @throw То же, что <tt>check_policy::check_division_by_zero(a)</tt>
+        */
+        symmetric_matrix & operator/=(value_type const & a)
+        {
+            check_policy::check_division_by_zero(a);
+
+            kernels::divide(this->packed_size(), a, this->packed_data());
+            return *this;
+        }
+
+        /** @brief Прибавление симметричной матрицы
+        @param x матрица
+        @return <tt>*this</tt>
+        @post К каждому элементу <tt>*this</tt> прибавляется соответствующий
+        элемент @c x
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        symmetric_matrix & operator+=(symmetric_matrix const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            kernels::add(this->packed_size(), x.packed_data(), this->packed_data());
+            return *this;
+        }
+
+        /** @brief Вычитание симметричной матрицы
+        @param x матрица
+        @return <tt>*this</tt>
+        @post Из каждого элемента <tt>*this</tt> вычитается соответствующий
+        элемент @c x
+        @throw То же, что <tt>check_policy::ensure_equal_dimensions(*this, x)</tt>
+        */
+        symmetric_matrix & operator-=(symmetric_matrix const & x)
+        {
+            check_policy::ensure_equal_dimensions(*this, x);
+
+            kernels::subtract(this->packed_size(), x.packed_data(), this->packed_data());
+            return *this;
+        }
+
+        /** @brief Симметричное обновление ранга один: <tt>*this += alpha*x*x^T</tt>
+        @param alpha скаляр
+        @param x вектор или выражение, результатом которого является вектор
+        @return <tt>*this</tt>
+        @throw std::logic_error, если <tt>x.dim() != this->dim1()</tt>
+
+        Вычисляются только элементы верхнего треугольника, то есть требуется
+        примерно вдвое меньше операций, чем для плотной матрицы.
+        */
+        template <class Vector>
+        symmetric_matrix & rank_one_update(value_type const & alpha, Vector const & x)
+        {
+            detail::check_matrix_vector_product(*this, x);
+
+            auto const & x_value = detail::vector_operand(x, 0);
+
+            kernels::spr(this->n_, alpha, x_value.data(), this->packed_data());
+            return *this;
+        }
+
+    private:
+        size_type n_;
+        std::vector<value_type> data_;
+    };
+
+    /** @brief Оператор "равно"
+    @param x, y симметричные матрицы
+    @return @b true, если матрицы имеют одинаковые размерности и равные
+    соответствующие элементы
+    */
+    template <class T, class Check>
+    bool operator==(symmetric_matrix<T, Check> const & x,
+                    symmetric_matrix<T, Check> const & y)
+    {
+        return x.dim() == y.dim()
+            && std::equal(x.packed_data(), x.packed_data() + x.packed_size(), y.packed_data());
+    }
+
+    /** @brief Оператор "не равно"
+    @param x, y симметричные матрицы
+    @return <tt>!(x == y)</tt>
+    */
+    template <class T, class Check>
+    bool operator!=(symmetric_matrix<T, Check> const & x,
+                    symmetric_matrix<T, Check> const & y)
+    {
+        return !(x == y);
+    }
+
+    // Линейные операции
+    /** @brief Сложение симметричных матриц
+    @param x, y слагаемые
+    @return Симметричная матрица, элементы которой равны сумме соответствующих
+    элементов слагаемых
+    */
+    template <class T, class Check>
+    symmetric_matrix<T, Check>
+    operator+(symmetric_matrix<T, Check> x, symmetric_matrix<T, Check> const & y)
+    {
+        x += y;
+        return x;
+    }
+
+    /** @brief Вычитание симметричных матриц
+    @param x уменьшаемое
+    @param y вычитаемое
+    @return Симметричная матрица, элементы которой равны разности
+    соответствующих элементов аргументов
+    */
+    template <class T, class Check>
+    symmetric_matrix<T, Check>
+    operator-(symmetric_matrix<T, Check> x, symmetric_matrix<T, Check> const & y)
+    {
+        x -= y;
+        return x;
+    }
+
+    //@{
+    /** @brief Умножение симметричной матрицы на скаляр
+    @param x матрица
+    @param a скаляр
+    @return Симметричная матрица, элементы которой равны соответствующим
+    элементам @c x, умноженным на @c a
+    */
+    template <class T, class Check>
+    symmetric_matrix<T, Check>
+    operator*(symmetric_matrix<T, Check> x,
+              typename symmetric_matrix<T, Check>::value_type const & a)
+    {
+        x *= a;
+        return x;
+    }
+
+    template <class T, class Check>
+    symmetric_matrix<T, Check>
+    operator*(typename symmetric_matrix<T, Check>::value_type const & a,
+              symmetric_matrix<T, Check> x)
+    {
+        x *= a;
+        return x;
+    }
+    //@}
+
+    /** @brief Деление симметричной матрицы на скаляр
+    @param x матрица
+    @param a скаляр
+    @return Симметричная матрица, элементы которой равны соответствующим
+    элементам @c x, делённым на @c a
+    */
+    template <class T, class Check>
+    symmetric_matrix<T, Check>
+    operator/(symmetric_matrix<T, Check> x,
+              typename symmetric_matrix<T, Check>::value_type const & a)
+    {
+        x /= a;
+        return x;
+    }
+
+    /** @brief Умножение симметричной матрицы на вектор
+    @param A симметричная матрица
+    @param x вектор или выражение, результатом которого является вектор
+    @pre <tt>A.dim2() == x.dim()</tt>
+    @return Вектор размерности <tt>A.dim1()</tt>, равный <tt>A*x</tt>
+    @throw std::logic_error, если <tt>A.dim2() != x.dim()</tt>
+
+    Каждый хранимый элемент @c A читается один раз.
+    */
+    template <class T, class Check, class E,
+              class = detail::enable_if_vector_expression_t<E>>
+    math_vector<T, Check>
+    operator*(symmetric_matrix<T, Check> const & A, E const & x)
+    {
+        detail::check_matrix_vector_product(A, x);
+
+        auto const & x_value = detail::vector_operand(x, 0);
+
+        math_vector<T, Check> result(A.dim1(), grabin::no_init);
+
+        kernels::spmv(A.dim1(), T(1), A.packed_data(), x_value.data(), T(0), result.data());
+
+        return result;
+    }
+
+namespace linear_algebra
+{
+    /** @brief Тип функционального объекта для вычисления внешнего произведения
+    векторов, являющегося симметричной матрицей
+
+    Предназначен для накопления ковариационных матриц, например, в
+    @c statistics::variance_accumulator: в отличие от @c outer_product
+    результат занимает примерно вдвое меньше памяти и вычисляется примерно
+    вдвое быстрее.
+    */
+    class symmetric_outer_product
+    {
+    public:
+        /** @brief Вычисление значения функции
+        @param x,y аргументы
+        @pre <tt>x.dim() == y.dim()</tt>
+        @pre Матрица <tt>x*y^T</tt> симметрична, то есть векторы @c x и @c y
+        коллинеарны (в частности, совпадают)
+        @return Симметричная матрица порядка <tt>x.dim()</tt>, элемент
+        <tt>(i, j)</tt> которой для <tt>i <= j</tt> равен <tt>x[i]*y[j]</tt>
+        @throw std::logic_error, если <tt>x.dim() != y.dim()</tt>
+        */
+        template <class Vector>
+        symmetric_matrix<typename grabin::evaluated_type_t<Vector>::value_type,
+                         typename grabin::evaluated_type_t<Vector>::check_policy>
+        operator()(Vector const & x, Vector const & y) const
+        {
+            using Result = symmetric_matrix<typename grabin::evaluated_type_t<Vector>::value_type,
+                                            typename grabin::evaluated_type_t<Vector>::check_policy>;
+
+            Result result(x.dim());
+
+            this->accumulate(result, 1, x, y);
+
+            return result;
+        }
+
+        /** @brief Прибавление внешнего произведения векторов к симметричной
+        матрице "на месте": <tt>A += alpha*x*y^T</tt>
+        @param A изменяемая симметричная матрица
+        @param alpha скаляр
+        @param x,y векторы
+        @pre Матрица <tt>x*y^T</tt> симметрична
+        @throw std::logic_error, если <tt>A.dim1() != x.dim()</tt> или
+        <tt>A.dim2() != y.dim()</tt>
+
+        Не выделяет память, если элементы @c x и @c y хранятся непрерывно.
+        Обновляется только верхний треугольник @c A, каждый столбец --
+        векторизованным ядром @c axpy.
+        */
+        template <class T, class Check, class Scalar, class Vector1, class Vector2>
+        void accumulate(symmetric_matrix<T, Check> & A, Scalar const & alpha,
+                        Vector1 const & x, Vector2 const & y) const
+        {
+            grabin::detail::check_matrix_vector_product(A, x);
+            grabin::detail::check_matrix_vector_product(A, y);
+
+            auto const & x_value = grabin::detail::vector_operand(x, 0);
+            auto const & y_value = grabin::detail::vector_operand(y, 0);
+
+            auto column = A.packed_data();
+
+            for(auto j = 0*A.dim1(); j != A.dim1(); ++ j, column += j)
+            {
+                grabin::kernels::axpy(j + 1, T(alpha * y_value[j]), x_value.data(), column);
+            }
+        }
+    };
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MATH_SYMMETRIC_MATRIX_HPP_INCLUDED
@@ -0,0 +1,211 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_MEMORY_HPP_INCLUDED
+#define Z_GRABIN_MEMORY_HPP_INCLUDED
+
+/** @file grabin/memory.hpp
+ @brief Функциональность, связанная с управлением памятью
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Распределитель памяти, выделяющий блоки, выровненные по заданной
+    границе
+    @tparam T тип элементов
+    @tparam Alignment граница выравнивания в байтах, по умолчанию -- размер
+    типичной строки кэша
+
+    Выравнивание по строке кэша позволяет использовать выровненные векторные
+    загрузки и исключает ложное разделение данных между потоками, работающими с
+    разными массивами.
+    */
+    template <class T, std::size_t Alignment = 64>
+    class aligned_allocator
+    {
+        static_assert(Alignment >= alignof(void*), "Alignment is too small");
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления размера
+        using size_type = std::size_t;
+
+        /// @brief Тип для представления разности указателей
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief Граница выравнивания в байтах
+        static constexpr std::size_t alignment = Alignment;
+
+        /// @brief Тип распределителя для другого типа элементов
+        template <class U>
+        struct rebind
+        {
+            /// @brief Тип-результат
+            using other = aligned_allocator<U, Alignment>;
+        };
+
+        // Создание, копирование, уничтожение
+        /// @brief Конструктор без аргументов
+        aligned_allocator() = default;
+
+        /// @brief Конструктор на основе распределителя для другого типа элементов
+        template <class U>
+        aligned_allocator(aligned_allocator<U, Alignment> const &)
+        {}
+
+        // Выделение и освобождение памяти
+        /** @brief Выделение памяти
+        @param n количество элементов
+        @return Указатель на блок памяти для @c n элементов, адрес которого кратен
+        @c Alignment
+        @throw std::bad_alloc, если память не может быть выделена
+        */
+        T * allocate(std::size_t n)
+        {
+            auto const max_n = (std::numeric_limits<std::size_t>::max() - header_size) / sizeof(T);
+
+            if(n > max_n)
+            {
+                throw std::bad_alloc();
+            }
+
+            // Перед выровненным блоком сохраняется адрес исходного блока
+            auto const raw = ::operator new(n * sizeof(T) + header_size);
+            auto const raw_address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+            auto const address = (raw_address + Alignment - 1) & ~std::uintptr_t(Alignment - 1);
+
+            reinterpret_cast<void**>(address)[-1] = raw;
+
+            return reinterpret_cast<T*>(address);
+        }
+
+        /** @brief Освобождение памяти
+        @param p указатель на блок памяти
+        @pre @c p был получен в результате вызова @c allocate
+        */
+        void deallocate(T * p, std::size_t)
+        {
+            ::operator delete(reinterpret_cast<void**>(p)[-1]);
+        }
+
+    private:
+        static constexpr std::size_t header_size = Alignment - 1 + sizeof(void*);
+    };
+
+    template <class T, std::size_t Alignment>
+    constexpr std::size_t aligned_allocator<T, Alignment>::alignment;
+
+    template <class T, std::size_t Alignment>
+    constexpr std::size_t aligned_allocator<T, Alignment>::header_size;
+
+    /** @brief Оператор "равно"
+    @return @b true, так как распределители не имеют состояния
+    */
+    template <class T, class U, std::size_t Alignment>
+    bool operator==(aligned_allocator<T, Alignment> const &,
+                    aligned_allocator<U, Alignment> const &)
+    {
+        return true;
+    }
+
+    /** @brief Оператор "не равно"
+    @return @b false, так как распределители не имеют состояния
+    */
+    template <class T, class U, std::size_t Alignment>
+    bool operator!=(aligned_allocator<T, Alignment> const &,
+                    aligned_allocator<U, Alignment> const &)
+    {
+        return false;
+    }
+
+    /** @brief Адаптер распределителя памяти, который создаёт элементы без
+    аргументов инициализацией по умолчанию, а не инициализацией значением
+    @tparam Allocator исходный распределитель памяти
+
+    Для встроенных типов это означает, что, например, <tt>std::vector(n)</tt>
+    и <tt>resize(n)</tt> не заполняют память нулями. Все остальные операции
+    выполняются исходным распределителем.
+    */
+    template <class Allocator>
+    class default_init_allocator
+     : public Allocator
+    {
+        using Traits = std::allocator_traits<Allocator>;
+
+    public:
+        /// @brief Тип распределителя для другого типа элементов
+        template <class U>
+        struct rebind
+        {
+            /// @brief Тип-результат
+            using other = default_init_allocator<typename Traits::template rebind_alloc<U>>;
+        };
+
+        // Создание, копирование, уничтожение
+        using Allocator::Allocator;
+
+        /// @brief Конструктор без аргументов
+        default_init_allocator() = default;
+
+        /** @brief Конструктор на основе исходного распределителя
+        @param alloc исходный распределитель памяти
+        */
+        default_init_allocator(Allocator const & alloc)
+         : Allocator(alloc)
+        {}
+
+        // Создание объектов
+        /** @brief Создание объекта инициализацией по умолчанию
+        @param p указатель на неинициализированную память
+        */
+        template <class U>
+        void construct(U * p)
+        {
+            ::new(static_cast<void*>(p)) U;
+        }
+
+        /** @brief Создание объекта с заданными аргументами конструктора
+        @param p указатель на неинициализированную память
+        @param args аргументы конструктора
+        */
+        template <class U, class Arg, class... Args>
+        void construct(U * p, Arg && arg, Args &&... args)
+        {
+            Traits::construct(static_cast<Allocator&>(*this), p,
+                              std::forward<Arg>(arg), std::forward<Args>(args)...);
+        }
+    };
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_MEMORY_HPP_INCLUDED
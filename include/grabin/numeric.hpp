@@ -22,8 +22,12 @@ Grabin -- это свободной программное обеспечени
  @brief Обобщённые численные операции
 */
 
+#include <grabin/execution.hpp>
 #include <grabin/iterator.hpp>
+#include <grabin/math/kernels.hpp>
+
 #include <numeric>
+#include <type_traits>
 
 namespace grabin
 {
@@ -75,12 +79,108 @@ inline namespace v1
     */
     template <class InputSequence,
               class T = typename std::decay_t<InputSequence>::value_type,
-              class BinaryOperation = std::plus<>>
+              class BinaryOperation = std::plus<>,
+              class = std::enable_if_t<!execution::is_execution_policy<std::decay_t<InputSequence>>::value>>
     T reduce(InputSequence && in, T const & init_value = T{},
              BinaryOperation op = BinaryOperation())
     {
         return grabin::accumulate(std::forward<InputSequence>(in), init_value, std::move(op));
     }
+
+    /** @brief Свёртка последовательности элементов с последовательной
+    стратегией выполнения
+    @return <tt>grabin::reduce(in, init_value, op)</tt>
+    */
+    template <class InputSequence,
+              class T = typename std::decay_t<InputSequence>::value_type,
+              class BinaryOperation = std::plus<>>
+    T reduce(execution::sequenced_policy, InputSequence && in, T const & init_value = T{},
+             BinaryOperation op = BinaryOperation())
+    {
+        return grabin::reduce(std::forward<InputSequence>(in), init_value, std::move(op));
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        template <class BinaryOperation, class Pointer>
+        struct is_floating_point_sum
+        {
+        private:
+            using Value = std::remove_cv_t<std::remove_pointer_t<Pointer>>;
+
+        public:
+            static constexpr bool value
+                = std::is_floating_point<Value>::value
+                && (std::is_same<BinaryOperation, std::plus<>>::value
+                    || std::is_same<BinaryOperation, std::plus<Value>>::value);
+        };
+
+        // Сумма непрерывно хранящихся чисел с плавающей точкой вычисляется ядром
+        template <class Sequence, class T, class BinaryOperation>
+        auto parallel_reduce_impl(execution::parallel_policy const & policy, Sequence & in,
+                                  T const & init_value, BinaryOperation op, int)
+        -> std::enable_if_t<is_floating_point_sum<BinaryOperation, decltype(in.data())>::value, T>
+        {
+            auto const first = in.data();
+            auto const n = static_cast<std::ptrdiff_t>(grabin::end(in) - grabin::begin(in));
+
+            auto reduce_block = [first](std::ptrdiff_t from, std::ptrdiff_t to)
+            {
+                return T(grabin::kernels::sum(to - from, first + from));
+            };
+
+            return execution::detail::blocked_reduce(policy, n, init_value,
+                                                     reduce_block, std::move(op));
+        }
+
+        template <class Sequence, class T, class BinaryOperation>
+        T parallel_reduce_impl(execution::parallel_policy const & policy, Sequence & in,
+                               T const & init_value, BinaryOperation op, long)
+        {
+            auto const first = grabin::begin(in);
+            auto const n = static_cast<std::ptrdiff_t>(grabin::end(in) - first);
+
+            auto reduce_block = [first, op](std::ptrdiff_t from, std::ptrdiff_t to)
+            {
+                auto const block_first = first + from;
+
+                return std::accumulate(std::next(block_first), first + to,
+                                       T(*block_first), op);
+            };
+
+            return execution::detail::blocked_reduce(policy, n, init_value,
+                                                     reduce_block, std::move(op));
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Параллельная свёртка последовательности элементов
+    @param policy стратегия параллельного выполнения
+    @param in последовательность с итераторами произвольного доступа
+    @param init_value начальное значение, если оно не задано явно, то используется <tt>T{}</tt>,
+    где @c T -- тип элементов последовательности @c in
+    @param op ассоциативная бинарная операция, если она не задана явно, то
+    используется бинарный плюс
+    @return Cвёртка элементов @c in, используя бинарную операцию @c op и начальное значение
+    @c init_value
+
+    Последовательность делится на блоки размера <tt>policy.grain_size()</tt>,
+    каждый блок сворачивается отдельно (сумма непрерывно хранящихся @c float и
+    @c double -- векторизованным ядром), а затем частичные результаты
+    объединяются слева направо. Поэтому результат не зависит ни от количества
+    потоков, ни от запуска, но для чисел с плавающей точкой может отличаться от
+    результата последовательной свёртки.
+    */
+    template <class RandomAccessSequence,
+              class T = typename std::decay_t<RandomAccessSequence>::value_type,
+              class BinaryOperation = std::plus<>>
+    T reduce(execution::parallel_policy const & policy, RandomAccessSequence && in,
+             T const & init_value = T{}, BinaryOperation op = BinaryOperation())
+    {
+        return detail::parallel_reduce_impl(policy, in, init_value, std::move(op), 0);
+    }
 }
 // namespace v1
 }
@@ -0,0 +1,215 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_NUMERIC_BAND_SOLVER_HPP_INCLUDED
+#define Z_GRABIN_NUMERIC_BAND_SOLVER_HPP_INCLUDED
+
+/** @file grabin/numeric/band_solver.hpp
+ @brief Решение систем линейных алгебраических уравнений с ленточными и
+ трёхдиагональными матрицами
+*/
+
+#include <grabin/math/evaluated_type.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace linear_algebra
+{
+    /** @brief Решение систем линейных алгебраических уравнений с ленточной
+    матрицей методом LU-разложения
+
+    Матрица должна предоставлять функции-члены @c lower_bandwidth и
+    @c upper_bandwidth, как @c band_matrix. В отличие от @c LU_solver,
+    ведущий элемент не выбирается, поэтому множители @c L и @c U занимают ту же ленту,
+    что и исходная матрица, а решение системы порядка @c n с шириной ленты
+    <tt>kl + ku + 1</tt> требует <tt>O(n * kl * ku)</tt> операций и
+    <tt>O(n * (kl + ku))</tt> памяти. Метод устойчив, например, для матриц
+    с диагональным преобладанием.
+    */
+    struct band_LU_solver
+    {
+        /** @brief Решение системы уравнений
+        @param A ленточная матрица
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        @throw std::logic_error, если матрица @c A не является квадратной или
+        <tt>b.dim() != A.dim1()</tt>
+        @throw std::domain_error, если на диагонали при исключении появляется
+        нулевой элемент, в частности, если матрица вырождена
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            auto const n = A.dim1();
+
+            if(A.dim2() != n)
+            {
+                throw std::logic_error("Matrix must be square");
+            }
+
+            if(b.dim() != n)
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            using Index = decltype(A.dim1());
+
+            auto const kl = A.lower_bandwidth();
+            auto const ku = A.upper_bandwidth();
+
+            grabin::evaluated_type_t<Matrix> LU(A);
+
+            for(auto const & k : grabin::view::indices(n))
+            {
+                if(LU(k, k) == 0)
+                {
+                    throw std::domain_error("Matrix is singular");
+                }
+
+                auto const last_row = std::min(k + kl + 1, n);
+                auto const last_col = std::min(k + ku + 1, n);
+
+                for(auto i = k + 1; i < last_row; ++ i)
+                {
+                    auto const l_ik = (LU(i, k) /= LU(k, k));
+
+                    for(auto j = k + 1; j < last_col; ++ j)
+                    {
+                        LU(i, j) -= l_ik * LU(k, j);
+                    }
+                }
+            }
+
+            grabin::evaluated_type_t<Vector> x(b);
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                for(auto j = std::max(i - kl, Index(0)); j < i; ++ j)
+                {
+                    x[i] -= LU(i, j) * x[j];
+                }
+            }
+
+            for(auto i = n; i > 0; -- i)
+            {
+                auto const row = i - 1;
+
+                for(auto j = i; j < std::min(row + ku + 1, n); ++ j)
+                {
+                    x[row] -= LU(row, j) * x[j];
+                }
+
+                x[row] /= LU(row, row);
+            }
+
+            return x;
+        }
+    };
+
+    /** @brief Решение систем линейных алгебраических уравнений с
+    трёхдиагональной матрицей методом прогонки (алгоритм Томаса)
+
+    Матрица должна предоставлять функции-члены @c lower_bandwidth и
+    @c upper_bandwidth, как @c band_matrix. Решение системы порядка @c n
+    требует <tt>O(n)</tt> операций и одного вспомогательного массива из @c n
+    элементов; сама матрица не копируется. Метод устойчив для матриц с
+    диагональным преобладанием, как и @c band_LU_solver, частным случаем
+    которого он является.
+    */
+    struct tridiagonal_solver
+    {
+        /** @brief Решение системы уравнений
+        @param A трёхдиагональная матрица
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        @throw std::logic_error, если матрица @c A не является квадратной или
+        <tt>b.dim() != A.dim1()</tt>
+        @throw std::logic_error, если матрица не является трёхдиагональной
+        @throw std::domain_error, если при прогонке появляется нулевой
+        знаменатель, в частности, если матрица вырождена
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            auto const n = A.dim1();
+
+            if(A.dim2() != n)
+            {
+                throw std::logic_error("Matrix must be square");
+            }
+
+            if(b.dim() != n)
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            if(A.lower_bandwidth() > 1 || A.upper_bandwidth() > 1)
+            {
+                throw std::logic_error("Matrix must be tridiagonal");
+            }
+
+            using Value = typename Matrix::value_type;
+
+            grabin::evaluated_type_t<Vector> x(b);
+
+            // Прямой ход: c -- наддиагональ после исключения поддиагонали
+            std::vector<Value> c(n);
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                auto const a_i = (i > 0) ? A(i, i - 1) : Value(0);
+                auto const c_prev = (i > 0) ? c[i - 1] : Value(0);
+                auto const x_prev = (i > 0) ? x[i - 1] : Value(0);
+
+                auto const denom = A(i, i) - a_i * c_prev;
+
+                if(denom == 0)
+                {
+                    throw std::domain_error("Matrix is singular");
+                }
+
+                c[i] = (i + 1 < n) ? A(i, i + 1) / denom : Value(0);
+                x[i] = (x[i] - a_i * x_prev) / denom;
+            }
+
+            // Обратный ход
+            for(auto i = n - 1; i > 0; -- i)
+            {
+                x[i - 1] -= c[i - 1] * x[i];
+            }
+
+            return x;
+        }
+    };
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_NUMERIC_BAND_SOLVER_HPP_INCLUDED
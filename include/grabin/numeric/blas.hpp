@@ -0,0 +1,746 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_NUMERIC_BLAS_HPP_INCLUDED
+#define Z_GRABIN_NUMERIC_BLAS_HPP_INCLUDED
+
+/** @file grabin/numeric/blas.hpp
+ @brief Операции над векторами и матрицами в стиле BLAS
+
+ Все операции выполняются "на месте", операции над векторами не выделяют
+ память. Если элементы аргументов хранятся непрерывно (есть функция-член
+ @c data()), то используются векторизованные ядра из
+ grabin/math/kernels.hpp, иначе -- обобщённые
+ реализации, использующие индексированный доступ. Изменяемые аргументы
+ принимаются по универсальной ссылке, что позволяет передавать временные
+ представления (например, строки матриц).
+*/
+
+#include <grabin/math/kernels.hpp>
+#include <grabin/math/matrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace linear_algebra
+{
+    /// @cond false
+    namespace detail
+    {
+        template <class Vector1, class Vector2>
+        void blas_ensure_equal_dimensions(Vector1 const & x, Vector2 const & y)
+        {
+            if(x.dim() != y.dim())
+            {
+                throw std::logic_error("Dimensions must be equal");
+            }
+        }
+
+        template <class SourceMatrix>
+        void ensure_square(SourceMatrix const & A)
+        {
+            if(A.dim1() != A.dim2())
+            {
+                throw std::logic_error("Matrix must be square");
+            }
+        }
+
+        // axpy
+        template <class T, class Vector1, class Vector2>
+        auto axpy_impl(T const & a, Vector1 const & x, Vector2 & y, int)
+        -> decltype(grabin::kernels::axpy(x.dim(), a, x.data(), y.data()))
+        {
+            return grabin::kernels::axpy(x.dim(), a, x.data(), y.data());
+        }
+
+        template <class T, class Vector1, class Vector2>
+        void axpy_impl(T const & a, Vector1 const & x, Vector2 & y, long)
+        {
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                y[i] += a * x[i];
+            }
+        }
+
+        // scal
+        template <class T, class Vector>
+        auto scal_impl(T const & a, Vector & x, int)
+        -> decltype(grabin::kernels::scale(x.dim(), a, x.data()))
+        {
+            return grabin::kernels::scale(x.dim(), a, x.data());
+        }
+
+        template <class T, class Vector>
+        void scal_impl(T const & a, Vector & x, long)
+        {
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                x[i] *= a;
+            }
+        }
+
+        // asum
+        template <class Vector>
+        auto asum_impl(Vector const & x, int)
+        -> decltype(grabin::kernels::asum(x.dim(), x.data()))
+        {
+            return grabin::kernels::asum(x.dim(), x.data());
+        }
+
+        template <class Vector>
+        typename Vector::value_type
+        asum_impl(Vector const & x, long)
+        {
+            using std::abs;
+
+            auto result = typename Vector::value_type(0);
+
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                result += abs(x[i]);
+            }
+
+            return result;
+        }
+
+        // nrm2
+        template <class Vector>
+        auto sum_of_squares(Vector const & x, int)
+        -> decltype(grabin::kernels::dot(x.dim(), x.data(), x.data()))
+        {
+            return grabin::kernels::dot(x.dim(), x.data(), x.data());
+        }
+
+        template <class Vector>
+        typename Vector::value_type
+        sum_of_squares(Vector const & x, long)
+        {
+            auto result = typename Vector::value_type(0);
+
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                result += x[i] * x[i];
+            }
+
+            return result;
+        }
+
+        /* Сумма квадратов накапливается в виде scale^2 * ssq, где scale --
+        наибольший из обработанных модулей, поэтому промежуточные значения не
+        переполняются и не исчезают.
+        */
+        template <class Vector>
+        typename Vector::value_type
+        scaled_nrm2(Vector const & x)
+        {
+            using T = typename Vector::value_type;
+            using std::abs;
+            using std::sqrt;
+
+            auto scale = T(0);
+            auto ssq = T(1);
+
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                if(x[i] == T(0))
+                {
+                    continue;
+                }
+
+                auto const a = abs(x[i]);
+
+                if(scale < a)
+                {
+                    auto const r = scale / a;
+                    ssq = T(1) + ssq * r * r;
+                    scale = a;
+                }
+                else
+                {
+                    auto const r = a / scale;
+                    ssq += r * r;
+                }
+            }
+
+            return scale * sqrt(ssq);
+        }
+
+        template <class Vector>
+        typename Vector::value_type
+        nrm2_impl(Vector const & x, std::true_type)
+        {
+            using T = typename Vector::value_type;
+            using std::sqrt;
+
+            auto const ss = detail::sum_of_squares(x, 0);
+
+            auto const tiny = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+
+            if(ss <= std::numeric_limits<T>::max() && ss >= tiny)
+            {
+                return sqrt(ss);
+            }
+            else
+            {
+                return detail::scaled_nrm2(x);
+            }
+        }
+
+        // Для целочисленных и прочих типов масштабирование не имеет смысла
+        template <class Vector>
+        typename Vector::value_type
+        nrm2_impl(Vector const & x, std::false_type)
+        {
+            using T = typename Vector::value_type;
+            using std::sqrt;
+
+            return static_cast<T>(sqrt(detail::sum_of_squares(x, 0)));
+        }
+
+        // swap
+        template <class Vector1, class Vector2>
+        auto swap_impl(Vector1 & x, Vector2 & y, int)
+        -> decltype(std::swap_ranges(x.data(), x.data() + x.dim(), y.data()), void())
+        {
+            std::swap_ranges(x.data(), x.data() + x.dim(), y.data());
+        }
+
+        template <class Vector1, class Vector2>
+        void swap_impl(Vector1 & x, Vector2 & y, long)
+        {
+            using std::swap;
+
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                swap(x[i], y[i]);
+            }
+        }
+
+        // copy
+        template <class Vector1, class Vector2>
+        auto copy_impl(Vector1 const & x, Vector2 & y, int)
+        -> decltype(std::copy(x.data(), x.data() + x.dim(), y.data()), void())
+        {
+            std::copy(x.data(), x.data() + x.dim(), y.data());
+        }
+
+        template <class Vector1, class Vector2>
+        void copy_impl(Vector1 const & x, Vector2 & y, long)
+        {
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                y[i] = x[i];
+            }
+        }
+
+        // rot
+        template <class T, class Vector1, class Vector2>
+        auto rot_impl(Vector1 & x, Vector2 & y, T const & c, T const & s, int)
+        -> decltype(grabin::kernels::rot(x.dim(), x.data(), y.data(), c, s))
+        {
+            return grabin::kernels::rot(x.dim(), x.data(), y.data(), c, s);
+        }
+
+        template <class T, class Vector1, class Vector2>
+        void rot_impl(Vector1 & x, Vector2 & y, T const & c, T const & s, long)
+        {
+            for(auto i = decltype(x.dim())(0); i != x.dim(); ++ i)
+            {
+                auto const xi = x[i];
+                auto const yi = y[i];
+
+                x[i] = c * xi + s * yi;
+                y[i] = c * yi - s * xi;
+            }
+        }
+
+        // gemv
+        template <class T, class Matrix, class Vector1, class Vector2>
+        auto gemv_impl(T const & alpha, Matrix const & A, Vector1 const & x,
+                       T const & beta, Vector2 & y, int)
+        -> decltype(grabin::detail::layout_gemv(grabin::matrix_layout_t<Matrix>{},
+                                                A.dim1(), A.dim2(), alpha, A.data(),
+                                                grabin::detail::leading_dimension(A, 0),
+                                                x.data(), beta, y.data()))
+        {
+            return grabin::detail::layout_gemv(grabin::matrix_layout_t<Matrix>{},
+                                               A.dim1(), A.dim2(), alpha, A.data(),
+                                               grabin::detail::leading_dimension(A, 0),
+                                               x.data(), beta, y.data());
+        }
+
+        template <class T, class Matrix, class Vector1, class Vector2>
+        void gemv_impl(T const & alpha, Matrix const & A, Vector1 const & x,
+                       T const & beta, Vector2 & y, long)
+        {
+            for(auto i = 0*A.dim1(); i != A.dim1(); ++ i)
+            {
+                auto sum = T(0);
+
+                for(auto j = 0*A.dim2(); j != A.dim2(); ++ j)
+                {
+                    sum += A(i, j) * x[j];
+                }
+
+                y[i] = (beta == T(0)) ? alpha * sum : alpha * sum + beta * y[i];
+            }
+        }
+
+        template <class T, class Matrix, class Vector1, class Vector2>
+        auto gemv_t_impl(T const & alpha, Matrix const & A, Vector1 const & x,
+                         T const & beta, Vector2 & y, int)
+        -> decltype(grabin::detail::layout_gemv_t(grabin::matrix_layout_t<Matrix>{},
+                                                  A.dim1(), A.dim2(), alpha, A.data(),
+                                                  grabin::detail::leading_dimension(A, 0),
+                                                  x.data(), beta, y.data()))
+        {
+            return grabin::detail::layout_gemv_t(grabin::matrix_layout_t<Matrix>{},
+                                                 A.dim1(), A.dim2(), alpha, A.data(),
+                                                 grabin::detail::leading_dimension(A, 0),
+                                                 x.data(), beta, y.data());
+        }
+
+        template <class T, class Matrix, class Vector1, class Vector2>
+        void gemv_t_impl(T const & alpha, Matrix const & A, Vector1 const & x,
+                         T const & beta, Vector2 & y, long)
+        {
+            for(auto j = 0*A.dim2(); j != A.dim2(); ++ j)
+            {
+                y[j] = (beta == T(0)) ? T(0) : beta * y[j];
+            }
+
+            for(auto i = 0*A.dim1(); i != A.dim1(); ++ i)
+            {
+                auto const a_xi = alpha * x[i];
+
+                for(auto j = 0*A.dim2(); j != A.dim2(); ++ j)
+                {
+                    y[j] += a_xi * A(i, j);
+                }
+            }
+        }
+
+        // spr
+        template <class T, class Vector, class Matrix>
+        auto spr_impl(T const & alpha, Vector const & x, Matrix & A, int)
+        -> decltype(grabin::kernels::spr(x.dim(), alpha, x.data(), A.packed_data()))
+        {
+            return grabin::kernels::spr(x.dim(), alpha, x.data(), A.packed_data());
+        }
+
+        template <class T, class Vector, class Matrix>
+        void spr_impl(T const & alpha, Vector const & x, Matrix & A, long)
+        {
+            for(auto j = 0*x.dim(); j != x.dim(); ++ j)
+            {
+                auto const a_xj = alpha * x[j];
+
+                for(auto i = 0*j; i <= j; ++ i)
+                {
+                    A(i, j) += a_xj * x[i];
+                }
+            }
+        }
+
+        // spmv
+        template <class T, class Matrix, class Vector1, class Vector2>
+        auto spmv_impl(T const & alpha, Matrix const & A, Vector1 const & x,
+                       T const & beta, Vector2 & y, int)
+        -> decltype(grabin::kernels::spmv(A.dim1(), alpha, A.packed_data(), x.data(),
+                                          beta, y.data()))
+        {
+            return grabin::kernels::spmv(A.dim1(), alpha, A.packed_data(), x.data(),
+                                         beta, y.data());
+        }
+
+        template <class T, class Matrix, class Vector1, class Vector2>
+        void spmv_impl(T const & alpha, Matrix const & A, Vector1 const & x,
+                       T const & beta, Vector2 & y, long)
+        {
+            detail::gemv_impl(alpha, A, x, beta, y, 0L);
+        }
+
+        // gemm
+        template <class T, class Matrix1, class Matrix2, class Matrix3>
+        auto gemm_impl(T const & alpha, Matrix1 const & A, Matrix2 const & B,
+                       T const & beta, Matrix3 & C, int)
+        -> decltype(grabin::detail::matrix_gemm(alpha, A, B, beta, C))
+        {
+            return grabin::detail::matrix_gemm(alpha, A, B, beta, C);
+        }
+
+        template <class T, class Matrix1, class Matrix2, class Matrix3>
+        void gemm_impl(T const & alpha, Matrix1 const & A, Matrix2 const & B,
+                       T const & beta, Matrix3 & C, long)
+        {
+            for(auto i = 0*C.dim1(); i != C.dim1(); ++ i)
+            {
+                for(auto j = 0*C.dim2(); j != C.dim2(); ++ j)
+                {
+                    C(i, j) = (beta == T(0)) ? T(0) : beta * C(i, j);
+                }
+
+                for(auto p = 0*A.dim2(); p != A.dim2(); ++ p)
+                {
+                    auto const a_ip = alpha * A(i, p);
+
+                    for(auto j = 0*C.dim2(); j != C.dim2(); ++ j)
+                    {
+                        C(i, j) += a_ip * B(p, j);
+                    }
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Прибавление вектора, умноженного на скаляр
+    @param a скаляр
+    @param x вектор-слагаемое
+    @param y изменяемый вектор
+    @pre <tt>x.dim() == y.dim()</tt>
+    @post <tt>y[i]</tt> увеличивается на <tt>a * x[i]</tt> для всех допустимых @c i
+    @throw std::logic_error, если размерности не совпадают
+    */
+    template <class Scalar, class Vector1, class Vector2>
+    void axpy(Scalar const & a, Vector1 const & x, Vector2 && y)
+    {
+        detail::blas_ensure_equal_dimensions(x, y);
+
+        using Value = typename std::decay_t<Vector2>::value_type;
+        detail::axpy_impl(static_cast<Value>(a), x, y, 0);
+    }
+
+    /** @brief Умножение вектора на скаляр
+    @param a скаляр
+    @param x изменяемый вектор
+    @post <tt>x[i]</tt> умножается на @c a для всех допустимых @c i
+    */
+    template <class Scalar, class Vector>
+    void scal(Scalar const & a, Vector && x)
+    {
+        using Value = typename std::decay_t<Vector>::value_type;
+        detail::scal_impl(static_cast<Value>(a), x, 0);
+    }
+
+    /** @brief Сумма модулей элементов вектора
+    @param x вектор
+    @return Сумма <tt>|x[i]|</tt> для всех допустимых @c i
+    */
+    template <class Vector>
+    typename Vector::value_type
+    asum(Vector const & x)
+    {
+        return detail::asum_impl(x, 0);
+    }
+
+    /** @brief Евклидова норма вектора
+    @param x вектор
+    @return <tt>sqrt(sum(x[i]^2))</tt>
+
+    Для элементов с плавающей точкой сумма квадратов сначала вычисляется за
+    один проход векторизованным ядром. Если она переполнилась или слишком мала
+    (квадраты малых элементов могли потерять точность), то норма вычисляется
+    повторно с масштабированием, как в процедуре @c nrm2 из LAPACK. Поэтому
+    результат не переполняется, даже если переполняется <tt>inner_prod(x, x)</tt>.
+
+    Для остальных типов (в том числе целочисленных) возвращается
+    <tt>sqrt(inner_prod(x, x))</tt>, приведённый к типу элементов.
+    */
+    template <class Vector>
+    typename Vector::value_type
+    nrm2(Vector const & x)
+    {
+        using T = typename Vector::value_type;
+
+        return detail::nrm2_impl(x, std::is_floating_point<T>{});
+    }
+
+    /** @brief Индекс элемента с наибольшим модулем
+    @param x вектор
+    @return Наименьший индекс @c i, для которого <tt>|x[i]|</tt> максимален,
+    или <tt>-1</tt>, если <tt>x.dim() == 0</tt>
+    */
+    template <class Vector>
+    auto iamax(Vector const & x)
+    -> decltype(x.dim())
+    {
+        using std::abs;
+        using Size = decltype(x.dim());
+
+        auto result = Size(-1);
+        auto max_value = typename Vector::value_type(0);
+
+        for(auto i = Size(0); i != x.dim(); ++ i)
+        {
+            auto const a = abs(x[i]);
+
+            if(result < 0 || max_value < a)
+            {
+                result = i;
+                max_value = a;
+            }
+        }
+
+        return result;
+    }
+
+    /** @brief Обмен значениями элементов векторов
+    @param x, y изменяемые векторы
+    @pre <tt>x.dim() == y.dim()</tt>
+    @post Значения соответствующих элементов @c x и @c y обменены
+    @throw std::logic_error, если размерности не совпадают
+    */
+    template <class Vector1, class Vector2,
+              class = grabin::detail::enable_if_vector_expression_t<Vector1>,
+              class = grabin::detail::enable_if_vector_expression_t<Vector2>>
+    void swap(Vector1 && x, Vector2 && y)
+    {
+        detail::blas_ensure_equal_dimensions(x, y);
+        detail::swap_impl(x, y, 0);
+    }
+
+    /** @brief Копирование элементов вектора в другой вектор той же
+    размерности
+    @param x исходный вектор
+    @param y изменяемый вектор
+    @pre <tt>x.dim() == y.dim()</tt>
+    @post <tt>y[i] == x[i]</tt> для всех допустимых @c i
+    @throw std::logic_error, если размерности не совпадают
+
+    В отличие от присваивания, никогда не изменяет размерность @c y и не
+    выделяет память.
+    */
+    template <class Vector1, class Vector2,
+              class = grabin::detail::enable_if_vector_expression_t<Vector1>,
+              class = grabin::detail::enable_if_vector_expression_t<Vector2>>
+    void copy(Vector1 const & x, Vector2 && y)
+    {
+        detail::blas_ensure_equal_dimensions(x, y);
+        detail::copy_impl(x, y, 0);
+    }
+
+    /** @brief Параметры вращения Гивенса
+    @tparam T тип элементов
+    */
+    template <class T>
+    struct givens_rotation
+    {
+        /// @brief Косинус угла поворота
+        T c;
+
+        /// @brief Синус угла поворота
+        T s;
+
+        /// @brief Длина вектора, переводимого поворотом в <tt>(r, 0)</tt>
+        T r;
+    };
+
+    /** @brief Построение вращения Гивенса
+    @param a, b координаты вектора на плоскости
+    @return Параметры вращения <tt>(c, s, r)</tt>, такие что
+    <tt>c*a + s*b == r</tt>, <tt>c*b - s*a == 0</tt> и <tt>c*c + s*s == 1</tt>
+    */
+    template <class T>
+    givens_rotation<T> rotg(T const & a, T const & b)
+    {
+        using std::hypot;
+
+        if(b == T(0))
+        {
+            return {T(1), T(0), a};
+        }
+
+        auto const r = hypot(a, b);
+
+        return {a / r, b / r, r};
+    }
+
+    /** @brief Применение вращения Гивенса к паре векторов
+    @param x, y изменяемые векторы
+    @param c, s косинус и синус угла поворота
+    @pre <tt>x.dim() == y.dim()</tt>
+    @post Для всех допустимых @c i пара <tt>(x[i], y[i])</tt> заменяется на
+    <tt>(c*x[i] + s*y[i], c*y[i] - s*x[i])</tt>
+    @throw std::logic_error, если размерности не совпадают
+    */
+    template <class Vector1, class Vector2, class Scalar1, class Scalar2>
+    void rot(Vector1 && x, Vector2 && y, Scalar1 const & c, Scalar2 const & s)
+    {
+        detail::blas_ensure_equal_dimensions(x, y);
+
+        using Value = typename std::decay_t<Vector1>::value_type;
+        detail::rot_impl(x, y, static_cast<Value>(c), static_cast<Value>(s), 0);
+    }
+
+    /** @brief Произведение матрицы на вектор: <tt>y = alpha*A*x + beta*y</tt>
+    @param alpha, beta скаляры (возможно, разных типов), приводимые к типу элементов результата
+    @param A матрица
+    @param x вектор
+    @param y изменяемый вектор
+    @pre <tt>A.dim2() == x.dim()</tt>
+    @pre <tt>A.dim1() == y.dim()</tt>
+    @pre @c y не пересекается с @c A и @c x
+    @throw std::logic_error, если размерности несовместимы
+
+    Размерности проверяются один раз, после чего, если элементы всех
+    аргументов хранятся непрерывно, каждая строка умножается на @c x
+    векторизованным ядром без проверки индексов. Если <tt>beta == 0</tt>, то
+    исходные значения элементов @c y не используются.
+    */
+    template <class Scalar1, class Scalar2, class Matrix, class Vector1, class Vector2>
+    void gemv(Scalar1 const & alpha, Matrix const & A, Vector1 const & x,
+              Scalar2 const & beta, Vector2 && y)
+    {
+        if(A.dim2() != x.dim() || A.dim1() != y.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        using Value = typename std::decay_t<Vector2>::value_type;
+        detail::gemv_impl(static_cast<Value>(alpha), A, x, static_cast<Value>(beta), y, 0);
+    }
+
+    /** @brief Произведение транспонированной матрицы на вектор:
+    <tt>y = alpha*A^T*x + beta*y</tt>
+    @param alpha, beta скаляры (возможно, разных типов), приводимые к типу элементов результата
+    @param A матрица
+    @param x вектор
+    @param y изменяемый вектор
+    @pre <tt>A.dim1() == x.dim()</tt>
+    @pre <tt>A.dim2() == y.dim()</tt>
+    @pre @c y не пересекается с @c A и @c x
+    @throw std::logic_error, если размерности несовместимы
+
+    Матрица не транспонируется явно: её строки, умноженные на соответствующие
+    элементы @c x, прибавляются к @c y. Если <tt>beta == 0</tt>, то исходные
+    значения элементов @c y не используются.
+    */
+    template <class Scalar1, class Scalar2, class Matrix, class Vector1, class Vector2>
+    void gemv_t(Scalar1 const & alpha, Matrix const & A, Vector1 const & x,
+                Scalar2 const & beta, Vector2 && y)
+    {
+        if(A.dim1() != x.dim() || A.dim2() != y.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        using Value = typename std::decay_t<Vector2>::value_type;
+        detail::gemv_t_impl(static_cast<Value>(alpha), A, x, static_cast<Value>(beta), y, 0);
+    }
+
+    /** @brief Произведение матриц: <tt>C = alpha*A*B + beta*C</tt>
+    @param alpha, beta скаляры (возможно, разных типов), приводимые к типу элементов результата
+    @param A, B матрицы-сомножители
+    @param C изменяемая матрица
+    @pre <tt>A.dim1() == C.dim1()</tt>
+    @pre <tt>A.dim2() == B.dim1()</tt>
+    @pre <tt>B.dim2() == C.dim2()</tt>
+    @pre @c C не пересекается с @c A и @c B
+    @throw std::logic_error, если размерности несовместимы
+
+    Если <tt>beta == 0</tt>, то исходные значения элементов @c C не
+    используются. Если элементы всех трёх матриц хранятся в массивах (есть
+    функция-член @c data()) по строкам или по столбцам, то используется
+    блочное ядро <tt>kernels::gemm</tt>.
+    */
+    template <class Scalar1, class Scalar2, class Matrix1, class Matrix2, class Matrix3>
+    void gemm(Scalar1 const & alpha, Matrix1 const & A, Matrix2 const & B,
+              Scalar2 const & beta, Matrix3 && C)
+    {
+        if(A.dim1() != C.dim1() || A.dim2() != B.dim1() || B.dim2() != C.dim2())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        using Value = typename std::decay_t<Matrix3>::value_type;
+        detail::gemm_impl(static_cast<Value>(alpha), A, B, static_cast<Value>(beta), C, 0);
+    }
+
+    /** @brief Симметричное обновление ранга один: <tt>A += alpha*x*x^T</tt>
+    @param alpha скаляр
+    @param x вектор
+    @param A изменяемая симметричная матрица
+    @pre <tt>A.dim1() == x.dim()</tt>
+    @pre @c A не пересекается с @c x
+    @throw std::logic_error, если размерности несовместимы
+
+    Изменяются только элементы <tt>A(i, j)</tt>, где <tt>i <= j</tt>, поэтому
+    матрица должна хранить элементы <tt>A(i, j)</tt> и <tt>A(j, i)</tt> в
+    одном объекте, как @c symmetric_matrix. Если элементы @c x хранятся
+    непрерывно, а @c A -- в упакованном виде (есть функция-член
+    @c packed_data()), то используется ядро <tt>kernels::spr</tt>.
+    */
+    template <class Scalar, class Vector, class Matrix>
+    void spr(Scalar const & alpha, Vector const & x, Matrix && A)
+    {
+        if(A.dim1() != x.dim() || A.dim2() != x.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        using Value = typename std::decay_t<Matrix>::value_type;
+        detail::spr_impl(static_cast<Value>(alpha), x, A, 0);
+    }
+
+    /** @brief Произведение симметричной матрицы на вектор:
+    <tt>y = alpha*A*x + beta*y</tt>
+    @param alpha, beta скаляры (возможно, разных типов), приводимые к типу элементов результата
+    @param A симметричная матрица
+    @param x вектор
+    @param y изменяемый вектор
+    @pre <tt>A.dim2() == x.dim()</tt>
+    @pre <tt>A.dim1() == y.dim()</tt>
+    @pre @c y не пересекается с @c A и @c x
+    @throw std::logic_error, если размерности несовместимы
+
+    Если элементы @c A хранятся в упакованном виде (есть функция-член
+    @c packed_data()), а элементы векторов -- непрерывно, то используется
+    ядро <tt>kernels::spmv</tt>, читающее каждый хранимый элемент один раз.
+    Иначе результат совпадает с <tt>gemv(alpha, A, x, beta, y)</tt>.
+    */
+    template <class Scalar1, class Scalar2, class Matrix, class Vector1, class Vector2>
+    void spmv(Scalar1 const & alpha, Matrix const & A, Vector1 const & x,
+              Scalar2 const & beta, Vector2 && y)
+    {
+        if(A.dim2() != x.dim() || A.dim1() != y.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        using Value = typename std::decay_t<Vector2>::value_type;
+        detail::spmv_impl(static_cast<Value>(alpha), A, x, static_cast<Value>(beta), y, 0);
+    }
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_NUMERIC_BLAS_HPP_INCLUDED
@@ -0,0 +1,1593 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_NUMERIC_DENSE_FACTORIZATION_HPP_INCLUDED
+#define Z_GRABIN_NUMERIC_DENSE_FACTORIZATION_HPP_INCLUDED
+
+/** @file grabin/numeric/dense_factorization.hpp
+ @brief Разложения плотных матриц: LU (в том числе с пониженной точностью и
+ итерационным уточнением), Холецкого и LDL^T
+*/
+
+#include <grabin/math/evaluated_type.hpp>
+#include <grabin/math/kernels.hpp>
+#include <grabin/math/matrix_layout.hpp>
+#include <grabin/numeric/blas.hpp>
+#include <grabin/utility/no_init.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace linear_algebra
+{
+    /// @cond false
+    namespace detail
+    {
+        // Копирование матрицы в порядке размещения элементов результата в памяти
+        template <class Matrix1, class Matrix2>
+        void lu_copy(grabin::row_major, Matrix1 const & A, Matrix2 & LU)
+        {
+            for(auto const & i : grabin::view::indices(LU.dim1()))
+            for(auto const & j : grabin::view::indices(LU.dim2()))
+            {
+                LU(i, j) = A(i, j);
+            }
+        }
+
+        template <class Matrix1, class Matrix2>
+        void lu_copy(grabin::column_major, Matrix1 const & A, Matrix2 & LU)
+        {
+            for(auto const & j : grabin::view::indices(LU.dim2()))
+            for(auto const & i : grabin::view::indices(LU.dim1()))
+            {
+                LU(i, j) = A(i, j);
+            }
+        }
+
+        /* LU-разложение с выбором ведущего элемента по столбцу. Если элементы
+        хранятся в массиве, то используется блочное ядро, иначе --
+        поэлементный правосторонний алгоритм
+        */
+        template <class Matrix>
+        auto lu_decompose(Matrix & LU, std::ptrdiff_t * pivots, int)
+        -> decltype(grabin::kernels::getrf(LU.dim1(), LU.data(), std::ptrdiff_t(1),
+                                           std::ptrdiff_t(1), pivots))
+        {
+            using Layout = grabin::matrix_layout_t<Matrix>;
+
+            auto const n = LU.dim1();
+            auto const ld = Layout::leading_dimension(n, n);
+
+            return grabin::kernels::getrf(n, LU.data(), Layout::offset(1, 0, ld),
+                                          Layout::offset(0, 1, ld), pivots);
+        }
+
+        template <class Matrix>
+        bool lu_decompose(Matrix & LU, std::ptrdiff_t * pivots, long)
+        {
+            using std::abs;
+
+            auto const n = LU.dim1();
+            auto nonsingular = true;
+
+            for(auto const & k : grabin::view::indices(n))
+            {
+                auto p = k;
+
+                for(auto const & i : grabin::view::indices(k + 1, n))
+                {
+                    if(abs(LU(i, k)) > abs(LU(p, k)))
+                    {
+                        p = i;
+                    }
+                }
+
+                pivots[k] = p;
+
+                if(p != k)
+                {
+                    for(auto const & j : grabin::view::indices(n))
+                    {
+                        std::swap(LU(k, j), LU(p, j));
+                    }
+                }
+
+                if(LU(k, k) == 0)
+                {
+                    nonsingular = false;
+                    continue;
+                }
+
+                for(auto const & i : grabin::view::indices(k + 1, n))
+                {
+                    auto const l_ik = (LU(i, k) /= LU(k, k));
+
+                    for(auto const & j : grabin::view::indices(k + 1, n))
+                    {
+                        LU(i, j) -= l_ik * LU(k, j);
+                    }
+                }
+            }
+
+            return nonsingular;
+        }
+
+        // Перестановка элементов вектора в соответствии с выбором ведущих элементов
+        template <class Vector>
+        void lu_permute(std::vector<std::ptrdiff_t> const & pivots, Vector & x)
+        {
+            using std::swap;
+
+            for(auto const & k : grabin::view::indices(static_cast<std::ptrdiff_t>(pivots.size())))
+            {
+                if(pivots[k] != k)
+                {
+                    swap(x[k], x[pivots[k]]);
+                }
+            }
+        }
+
+        // Решение систем Ly = b и Ux = y: по строкам или по столбцам
+        template <class Matrix, class Vector>
+        void lu_substitute(grabin::row_major, Matrix const & LU, Vector & x)
+        {
+            auto const n = LU.dim1();
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                for(auto const & j : grabin::view::indices(i))
+                {
+                    x[i] -= LU(i, j) * x[j];
+                }
+            }
+
+            for(auto i = n; i > 0; -- i)
+            {
+                for(auto j = i; j < n; ++ j)
+                {
+                    x[i-1] -= LU(i-1, j) * x[j];
+                }
+                x[i-1] /= LU(i-1, i-1);
+            }
+        }
+
+        template <class Matrix, class Vector>
+        void lu_substitute(grabin::column_major, Matrix const & LU, Vector & x)
+        {
+            auto const n = LU.dim1();
+
+            for(auto const & j : grabin::view::indices(n))
+            {
+                for(auto const & i : grabin::view::indices(j + 1, n))
+                {
+                    x[i] -= LU(i, j) * x[j];
+                }
+            }
+
+            for(auto j = n; j > 0; -- j)
+            {
+                x[j-1] /= LU(j-1, j-1);
+
+                for(auto i = j - 1; i > 0; -- i)
+                {
+                    x[i-1] -= LU(i-1, j-1) * x[j-1];
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /// @cond false
+    namespace detail
+    {
+        /* Решение систем с несколькими правыми частями: если элементы матрицы
+        правых частей хранятся непрерывно по строкам, то строки обрабатываются
+        векторизованным ядром axpy, иначе -- каждый столбец отдельно
+        */
+        template <class Matrix1, class Matrix2>
+        auto lu_substitute_matrix(Matrix1 const & LU, Matrix2 & X, int)
+        -> std::enable_if_t<std::is_same<grabin::matrix_layout_t<Matrix2>, grabin::row_major>::value,
+                            decltype(grabin::kernels::axpy(X.dim2(), LU(0, 0), X.data(), X.data()))>
+        {
+            using Value = typename Matrix2::value_type;
+
+            auto const n = LU.dim1();
+            auto const m = X.dim2();
+            auto const ld = grabin::row_major::leading_dimension(X.dim1(), X.dim2());
+
+            auto const row = [&X, ld](decltype(n) i) { return X.data() + i * ld; };
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                for(auto const & j : grabin::view::indices(i))
+                {
+                    grabin::kernels::axpy(m, Value(-LU(i, j)), row(j), row(i));
+                }
+            }
+
+            for(auto i = n; i > 0; -- i)
+            {
+                for(auto j = i; j < n; ++ j)
+                {
+                    grabin::kernels::axpy(m, Value(-LU(i-1, j)), row(j), row(i-1));
+                }
+
+                grabin::kernels::divide(m, Value(LU(i-1, i-1)), row(i-1));
+            }
+        }
+
+        template <class Matrix1, class Matrix2>
+        void lu_substitute_matrix(Matrix1 const & LU, Matrix2 & X, long)
+        {
+            using Layout = grabin::matrix_layout_t<Matrix1>;
+            using Value = typename Matrix2::value_type;
+
+            std::vector<Value> x(LU.dim1());
+
+            for(auto const & k : grabin::view::indices(X.dim2()))
+            {
+                for(auto const & i : grabin::view::indices(X.dim1()))
+                {
+                    x[i] = X(i, k);
+                }
+
+                detail::lu_substitute(Layout{}, LU, x);
+
+                for(auto const & i : grabin::view::indices(X.dim1()))
+                {
+                    X(i, k) = x[i];
+                }
+            }
+        }
+
+        template <class Matrix>
+        void lu_permute_rows(std::vector<std::ptrdiff_t> const & pivots, Matrix & X)
+        {
+            using std::swap;
+
+            for(auto const & k : grabin::view::indices(static_cast<std::ptrdiff_t>(pivots.size())))
+            {
+                if(pivots[k] == k)
+                {
+                    continue;
+                }
+
+                for(auto const & j : grabin::view::indices(X.dim2()))
+                {
+                    swap(X(k, j), X(pivots[k], j));
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief LU-разложение квадратной матрицы, вычисляемое один раз и
+    используемое для решения многих систем уравнений с этой матрицей
+    @tparam Matrix тип матрицы, в которой хранятся множители (например,
+    @c matrix)
+
+    Вычисляется разложение <tt>P*A == L*U</tt>, где @c P -- матрица
+    перестановки строк, выбранная так, чтобы на каждом шаге ведущий элемент
+    был наибольшим по модулю в своём столбце. Множители хранятся в одной
+    матрице: под главной диагональю -- элементы нижней треугольной матрицы
+    @c L с единичной диагональю, на главной диагонали и над ней -- элементы
+    верхней треугольной матрицы @c U. Разложение требует <tt>O(n^3)</tt>
+    операций (если элементы хранятся в массиве, то используется блочное ядро
+    <tt>kernels::getrf</tt>), а решение системы с очередной правой частью --
+    только <tt>O(n^2)</tt>. Удобно создавать объект с помощью функции
+    @c make_lu_factorization.
+    */
+    template <class Matrix>
+    class lu_factorization
+    {
+    public:
+        // Типы
+        /// @brief Тип матрицы, в которой хранятся множители
+        using matrix_type = Matrix;
+
+        /// @brief Тип элементов
+        using value_type = typename matrix_type::value_type;
+
+        /// @brief Тип для представления размерности
+        using size_type = decltype(std::declval<matrix_type const &>().dim1());
+
+        // Создание, копирование, уничтожение
+        /** @brief Вычисление LU-разложения матрицы
+        @param A квадратная матрица
+        @throw std::logic_error, если матрица @c A не является квадратной
+
+        Вырожденность матрицы не является ошибкой: разложение вычисляется,
+        но решать системы уравнений с ним нельзя.
+        */
+        template <class SourceMatrix>
+        explicit lu_factorization(SourceMatrix const & A)
+         : LU_(lu_factorization::make_workspace(A))
+         , pivots_(A.dim1())
+        {
+            detail::lu_copy(Layout{}, A, this->LU_);
+            this->nonsingular_ = detail::lu_decompose(this->LU_, this->pivots_.data(), 0);
+        }
+
+        // Свойства
+        /// @brief Порядок матрицы
+        size_type dim() const
+        {
+            return this->LU_.dim1();
+        }
+
+        /** @brief Множители разложения
+        @return Матрица, под главной диагональю которой хранятся элементы
+        @c L (кроме единичной диагонали), а на главной диагонали и над ней --
+        элементы @c U
+        */
+        matrix_type const & factors() const
+        {
+            return this->LU_;
+        }
+
+        /** @brief Перестановка строк
+        @return Вектор @c p из <tt>this->dim()</tt> элементов: на шаге @c k
+        разложения строка @c k была переставлена со строкой <tt>p[k] >= k</tt>
+        */
+        std::vector<std::ptrdiff_t> const & pivots() const
+        {
+            return this->pivots_;
+        }
+
+        /** @brief Проверка вырожденности
+        @return @b true, если при разложении встретился нулевой ведущий
+        элемент, то есть исходная матрица вырождена
+        */
+        bool is_singular() const
+        {
+            return !this->nonsingular_;
+        }
+
+        /** @brief Определитель исходной матрицы
+        @return Произведение диагональных элементов @c U, знак которого
+        меняется при каждой перестановке строк
+        */
+        value_type determinant() const
+        {
+            auto result = value_type(1);
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                result *= this->LU_(i, i);
+
+                if(this->pivots_[i] != i)
+                {
+                    result = -result;
+                }
+            }
+
+            return result;
+        }
+
+        // Решение систем уравнений
+        /** @brief Решение системы уравнений с записью результата на место
+        правой части
+        @param x вектор правой части; после выполнения функции -- решение
+        системы <tt>A*x == b</tt>, где @c b -- исходное значение @c x
+        @throw std::logic_error, если <tt>x.dim() != this->dim()</tt>
+        @throw std::domain_error, если матрица вырождена
+
+        Память не выделяется. Вектор может быть представлением внешних
+        данных, в том числе временным.
+        */
+        template <class Vector>
+        void solve_in_place(Vector && x) const
+        {
+            if(x.dim() != this->dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            this->ensure_nonsingular();
+
+            detail::lu_permute(this->pivots_, x);
+            detail::lu_substitute(Layout{}, this->LU_, x);
+        }
+
+        /** @brief Решение системы уравнений
+        @param b вектор правой части или матрица, столбцы которой являются
+        правыми частями
+        @return Вектор @c x, такой что <tt>A*x == b</tt>, или матрица @c X,
+        такая что <tt>A*X == b</tt>
+        @throw std::logic_error, если количество элементов (строк) @c b не
+        совпадает с <tt>this->dim()</tt>
+        @throw std::domain_error, если матрица вырождена
+
+        Если @c b -- матрица, элементы которой хранятся по строкам, то
+        правые части обрабатываются одновременно: при исключении из строки
+        вычитается другая строка векторизованным ядром.
+        */
+        template <class Rhs>
+        grabin::evaluated_type_t<Rhs>
+        solve(Rhs const & b) const
+        {
+            return this->solve_impl(b, 0);
+        }
+
+        /** @brief Обратная матрица
+        @return Матрица, обратная к исходной
+        @throw std::domain_error, если матрица вырождена
+
+        Вычисляется как решение системы, правые части которой являются
+        столбцами единичной матрицы. Для решения систем уравнений обычно
+        выгоднее и точнее использовать @c solve.
+        */
+        matrix_type inverse() const
+        {
+            this->ensure_nonsingular();
+
+            auto const n = this->dim();
+
+            auto result = grabin::make_no_init<matrix_type>(n, n);
+
+            for(auto const & i : grabin::view::indices(n))
+            for(auto const & j : grabin::view::indices(n))
+            {
+                result(i, j) = (i == j) ? value_type(1) : value_type(0);
+            }
+
+            detail::lu_permute_rows(this->pivots_, result);
+            detail::lu_substitute_matrix(this->LU_, result, 0);
+
+            return result;
+        }
+
+    private:
+        using Layout = grabin::matrix_layout_t<matrix_type>;
+
+        template <class SourceMatrix>
+        static matrix_type make_workspace(SourceMatrix const & A)
+        {
+            if(A.dim1() != A.dim2())
+            {
+                throw std::logic_error("Matrix must be square");
+            }
+
+            // Каждому элементу присваивается значение до его использования
+            return grabin::make_no_init<matrix_type>(A.dim1(), A.dim2());
+        }
+
+        void ensure_nonsingular() const
+        {
+            if(!this->nonsingular_)
+            {
+                throw std::domain_error("Matrix is singular");
+            }
+        }
+
+        template <class Rhs>
+        auto solve_impl(Rhs const & B, int) const
+        -> decltype(B.dim1(), grabin::evaluated_type_t<Rhs>(B.dim1(), B.dim2()))
+        {
+            if(B.dim1() != this->dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            this->ensure_nonsingular();
+
+            // Правая часть может быть представлением, поэтому копируется поэлементно
+            auto X = grabin::make_no_init<grabin::evaluated_type_t<Rhs>>(B.dim1(), B.dim2());
+
+            for(auto const & i : grabin::view::indices(B.dim1()))
+            for(auto const & j : grabin::view::indices(B.dim2()))
+            {
+                X(i, j) = B(i, j);
+            }
+
+            detail::lu_permute_rows(this->pivots_, X);
+            detail::lu_substitute_matrix(this->LU_, X, 0);
+
+            return X;
+        }
+
+        template <class Rhs>
+        grabin::evaluated_type_t<Rhs>
+        solve_impl(Rhs const & b, long) const
+        {
+            grabin::evaluated_type_t<Rhs> x(b);
+            this->solve_in_place(x);
+
+            return x;
+        }
+
+        matrix_type LU_;
+        std::vector<std::ptrdiff_t> pivots_;
+        bool nonsingular_ = true;
+    };
+
+    /** @brief Вычисление LU-разложения матрицы
+    @param A квадратная матрица
+    @return <tt>lu_factorization<evaluated_type_t<Matrix>>(A)</tt>
+    */
+    template <class Matrix>
+    lu_factorization<grabin::evaluated_type_t<Matrix>>
+    make_lu_factorization(Matrix const & A)
+    {
+        return lu_factorization<grabin::evaluated_type_t<Matrix>>(A);
+    }
+
+    /** @brief Решение систем линейных алгебраических уравнений методом
+    LU-разложения
+
+    Используется разложение с выбором ведущего элемента по столбцу. При
+    каждом вызове разложение вычисляется заново. Если нужно решить
+    несколько систем с одной и той же матрицей, следует один раз создать
+    @c lu_factorization.
+    */
+    struct LU_solver
+    {
+        /** @brief Решение системы уравнений
+        @param A квадратная матрица
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            assert(b.dim() == A.dim1());
+            assert(A.dim2() == A.dim1());
+
+            return linear_algebra::make_lu_factorization(A).solve(b);
+        }
+    };
+
+    /** @brief Параметры уточнения решения, найденного с пониженной точностью
+
+    Уточнение прекращается, как только нормированная обратная ошибка (см.
+    @c refinement_report) не превосходит <tt>tolerance * sqrt(n)</tt>, где
+    @c n -- порядок матрицы, если обратная ошибка за итерацию уменьшилась
+    менее чем вдвое или после @c max_iterations итераций.
+    */
+    struct refinement_options
+    {
+        /// @brief Допустимая обратная ошибка, делённая на <tt>sqrt(n)</tt>
+        double tolerance = std::numeric_limits<double>::epsilon();
+
+        /// @brief Максимальное количество итераций уточнения
+        std::ptrdiff_t max_iterations = 30;
+    };
+
+    /// @brief Результаты решения системы с уточнением
+    struct refinement_report
+    {
+        /// @brief Количество выполненных итераций уточнения
+        std::ptrdiff_t iterations = 0;
+
+        /** @brief Нормированная обратная ошибка полученного решения
+        <tt>||b - A*x|| / (||A|| * ||x|| + ||b||)</tt>, где используются
+        максимум-нормы векторов и соответствующая норма матрицы
+        */
+        double backward_error = 0.0;
+
+        /// @brief Достигнута ли заданная точность
+        bool converged = false;
+
+        /** @brief Пришлось ли вычислить разложение с полной точностью,
+        так как уточнение не сошлось
+        */
+        bool fallback = false;
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        template <class Vector>
+        auto norm_inf(Vector const & x)
+        -> decltype(std::abs(x[0]))
+        {
+            using std::abs;
+
+            auto const i = linear_algebra::iamax(x);
+
+            return (i < 0) ? decltype(abs(x[0]))(0) : abs(x[i]);
+        }
+
+        /* Матрица с элементами типа Low: значения, не представимые в нём,
+        заменяются ближайшими представимыми, так как преобразование таких
+        значений не определено
+        */
+        template <class Low, class Matrix>
+        struct saturated_matrix
+        {
+            using size_type = std::ptrdiff_t;
+
+            size_type dim1() const
+            {
+                return A.dim1();
+            }
+
+            size_type dim2() const
+            {
+                return A.dim2();
+            }
+
+            Low operator()(size_type i, size_type j) const
+            {
+                using Value = typename Matrix::value_type;
+
+                auto const max = Value(std::numeric_limits<Low>::max());
+
+                return static_cast<Low>(std::max(-max, std::min(Value(A(i, j)), max)));
+            }
+
+            Matrix const & A;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief LU-разложение с пониженной точностью и итерационным уточнением
+    решения
+    @tparam T тип элементов исходной матрицы и решения
+    @tparam Low тип элементов, в котором вычисляется разложение
+
+    Разложение <tt>P*A == L*U</tt> вычисляется в типе @c Low (по умолчанию
+    -- @c float), то есть с вдвое меньшим объёмом памяти и вдвое большим
+    количеством элементов в векторном регистре, чем для @c double. Решение
+    системы, полученное с помощью этого разложения, затем уточняется: невязка
+    <tt>r = b - A*x</tt> вычисляется в типе @c T с исходной матрицей, а
+    поправка -- решением системы <tt>A*d == r</tt> с тем же разложением.
+    Если число обусловленности матрицы заметно меньше, чем
+    <tt>1 / numeric_limits<Low>::epsilon()</tt>, то за несколько итераций
+    достигается точность, как при разложении в типе @c T, а каждая итерация
+    требует лишь <tt>O(n^2)</tt> операций.
+
+    Если уточнение перестаёт сходиться (например, матрица плохо обусловлена,
+    разложение в типе @c Low вырождено или её элементы не представимы в нём),
+    то один раз вычисляется разложение в типе @c T, которое затем
+    используется для этой и всех последующих систем. Объект хранит копию
+    исходной матрицы в типе @c T. Так как разложение с полной точностью
+    вычисляется при необходимости в константной функции @c solve, один
+    объект не должен использоваться одновременно в нескольких потоках.
+    */
+    template <class T = double, class Low = float>
+    class mixed_precision_lu_factorization
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов исходной матрицы и решения
+        using value_type = T;
+
+        /// @brief Тип элементов, в котором вычисляется разложение
+        using factor_value_type = Low;
+
+        /// @brief Тип для хранения исходной матрицы
+        using matrix_type = grabin::matrix<value_type>;
+
+        /// @brief Тип для представления размерности
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Вычисление разложения с пониженной точностью
+        @param A квадратная матрица
+        @param options параметры уточнения решения
+        @throw std::logic_error, если матрица @c A не является квадратной
+
+        Вырожденность матрицы не является ошибкой: она будет обнаружена при
+        решении системы уравнений.
+        */
+        template <class SourceMatrix>
+        explicit mixed_precision_lu_factorization(SourceMatrix const & A,
+                                                  refinement_options const & options
+                                                      = refinement_options())
+         : A_(mixed_precision_lu_factorization::make_copy(A))
+         , low_(detail::saturated_matrix<factor_value_type, matrix_type>{this->A_})
+         , options_(options)
+         , norm_A_(0)
+         , representable_(true)
+        {
+            using std::abs;
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                auto row_sum = 0.0;
+
+                for(auto const & j : grabin::view::indices(this->dim()))
+                {
+                    auto const a_ij = abs(this->A_(i, j));
+
+                    row_sum += static_cast<double>(a_ij);
+                    this->representable_ = this->representable_ && mixed_precision_lu_factorization::fits(a_ij);
+                }
+
+                this->norm_A_ = std::max(this->norm_A_, row_sum);
+            }
+        }
+
+        // Свойства
+        /// @brief Порядок матрицы
+        size_type dim() const
+        {
+            return this->A_.dim1();
+        }
+
+        /// @brief Параметры уточнения решения
+        refinement_options const & options() const
+        {
+            return this->options_;
+        }
+
+        // Решение систем уравнений
+        /** @brief Решение системы уравнений с уточнением
+        @param b вектор правой части
+        @param x вектор, в который записывается решение системы
+        <tt>A*x == b</tt>
+        @return Количество итераций уточнения, достигнутая обратная ошибка,
+        признак сходимости и признак использования разложения с полной
+        точностью
+        @throw std::logic_error, если размерности @c b или @c x не совпадают
+        с <tt>this->dim()</tt>
+        @throw std::domain_error, если матрица вырождена
+        */
+        template <class Vector1, class Vector2>
+        refinement_report solve(Vector1 const & b, Vector2 && x) const
+        {
+            using std::sqrt;
+
+            if(b.dim() != this->dim() || x.dim() != this->dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            auto const n = this->dim();
+            auto const threshold = this->options_.tolerance * sqrt(static_cast<double>(n));
+            auto const norm_b = static_cast<double>(detail::norm_inf(b));
+
+            grabin::math_vector<value_type> r(n);
+            grabin::math_vector<factor_value_type> d(n);
+
+            refinement_report report;
+
+            if(!this->high_ && this->representable_ && !this->low_.is_singular()
+               && mixed_precision_lu_factorization::fits(detail::norm_inf(b)))
+            {
+                linear_algebra::copy(b, d);
+                this->low_.solve_in_place(d);
+                linear_algebra::copy(d, x);
+
+                report.backward_error = this->residual(b, x, norm_b, r);
+
+                while(!(report.backward_error <= threshold)
+                      && report.iterations < this->options_.max_iterations)
+                {
+                    if(!mixed_precision_lu_factorization::fits(detail::norm_inf(r)))
+                    {
+                        break;
+                    }
+
+                    // x += A^{-1}*r, поправка вычисляется с пониженной точностью
+                    linear_algebra::copy(r, d);
+                    this->low_.solve_in_place(d);
+                    linear_algebra::copy(d, r);
+                    linear_algebra::axpy(1, r, x);
+
+                    ++ report.iterations;
+
+                    auto const eta = this->residual(b, x, norm_b, r);
+                    auto const stagnated = !(eta <= 0.5 * report.backward_error);
+
+                    report.backward_error = eta;
+
+                    if(stagnated)
+                    {
+                        break;
+                    }
+                }
+
+                if(report.backward_error <= threshold)
+                {
+                    report.converged = true;
+                    return report;
+                }
+            }
+
+            if(!this->high_)
+            {
+                this->high_ = std::make_shared<lu_factorization<matrix_type> const>(this->A_);
+            }
+
+            report.fallback = true;
+
+            linear_algebra::copy(b, x);
+            this->high_->solve_in_place(x);
+
+            report.backward_error = this->residual(b, x, norm_b, r);
+            report.converged = (report.backward_error <= threshold);
+
+            return report;
+        }
+
+        /** @brief Решение системы уравнений с уточнением
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        @throw std::logic_error, если <tt>b.dim() != this->dim()</tt>
+        @throw std::domain_error, если матрица вырождена
+        */
+        template <class Vector>
+        grabin::evaluated_type_t<Vector>
+        solve(Vector const & b) const
+        {
+            grabin::evaluated_type_t<Vector> x(b.dim());
+
+            this->solve(b, x);
+
+            return x;
+        }
+
+    private:
+        // Представимо ли значение в типе Low
+        template <class U>
+        static bool fits(U const & a)
+        {
+            return a <= U(std::numeric_limits<factor_value_type>::max());
+        }
+
+        template <class SourceMatrix>
+        static matrix_type make_copy(SourceMatrix const & A)
+        {
+            detail::ensure_square(A);
+
+            auto result = grabin::make_no_init<matrix_type>(A.dim1(), A.dim2());
+
+            for(auto const & i : grabin::view::indices(A.dim1()))
+            for(auto const & j : grabin::view::indices(A.dim2()))
+            {
+                result(i, j) = A(i, j);
+            }
+
+            return result;
+        }
+
+        // r = b - A*x, возвращает нормированную обратную ошибку
+        template <class Vector1, class Vector2>
+        double residual(Vector1 const & b, Vector2 const & x, double norm_b,
+                        grabin::math_vector<value_type> & r) const
+        {
+            linear_algebra::copy(b, r);
+            linear_algebra::gemv(-1, this->A_, x, 1, r);
+
+            auto const denominator = this->norm_A_ * static_cast<double>(detail::norm_inf(x)) + norm_b;
+            auto const norm_r = static_cast<double>(detail::norm_inf(r));
+
+            return (denominator > 0) ? norm_r / denominator : norm_r;
+        }
+
+        matrix_type A_;
+        lu_factorization<grabin::matrix<factor_value_type>> low_;
+        refinement_options options_;
+        double norm_A_;
+        bool representable_;
+        mutable std::shared_ptr<lu_factorization<matrix_type> const> high_;
+    };
+
+    /** @brief Вычисление LU-разложения с пониженной точностью
+    @param A квадратная матрица
+    @param options параметры уточнения решения
+    @return <tt>mixed_precision_lu_factorization<typename Matrix::value_type>(A, options)</tt>
+    */
+    template <class Matrix>
+    mixed_precision_lu_factorization<typename Matrix::value_type>
+    make_mixed_precision_lu_factorization(Matrix const & A,
+                                          refinement_options const & options = refinement_options())
+    {
+        return mixed_precision_lu_factorization<typename Matrix::value_type>(A, options);
+    }
+
+    /** @brief Решение систем линейных алгебраических уравнений методом
+    LU-разложения с пониженной точностью и итерационным уточнением
+
+    Функциональный объект для использования в качестве параметра @c Solver
+    вместо @c LU_solver для больших плотных матриц. При каждом вызове
+    разложение вычисляется заново.
+    */
+    struct mixed_precision_LU_solver
+    {
+        /// @brief Параметры уточнения решения
+        refinement_options options;
+
+        /** @brief Решение системы уравнений
+        @param A квадратная матрица
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            return linear_algebra::make_mixed_precision_lu_factorization(A, this->options).solve(b);
+        }
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        /* Тип матрицы, в которой хранятся множители разложения симметричной
+        матрицы. Упакованная симметричная матрица предоставляет функцию-член
+        dense, для остальных используется вычисляемый тип
+        */
+        template <class Matrix>
+        auto symmetric_factor_matrix(Matrix const & A, int) -> decltype(A.dense());
+
+        template <class Matrix>
+        grabin::evaluated_type_t<Matrix>
+        symmetric_factor_matrix(Matrix const & A, long);
+
+        template <class Matrix>
+        using symmetric_factor_matrix_t
+            = decltype(detail::symmetric_factor_matrix(std::declval<Matrix const &>(), 0));
+
+        // Копирование нижнего треугольника матрицы, над диагональю -- нули
+        template <class Matrix1, class Matrix2>
+        void lower_copy(grabin::row_major, Matrix1 const & A, Matrix2 & L)
+        {
+            using Value = typename Matrix2::value_type;
+
+            for(auto const & i : grabin::view::indices(L.dim1()))
+            for(auto const & j : grabin::view::indices(L.dim2()))
+            {
+                L(i, j) = (j <= i) ? Value(A(i, j)) : Value(0);
+            }
+        }
+
+        template <class Matrix1, class Matrix2>
+        void lower_copy(grabin::column_major, Matrix1 const & A, Matrix2 & L)
+        {
+            using Value = typename Matrix2::value_type;
+
+            for(auto const & j : grabin::view::indices(L.dim2()))
+            for(auto const & i : grabin::view::indices(L.dim1()))
+            {
+                L(i, j) = (j <= i) ? Value(A(i, j)) : Value(0);
+            }
+        }
+
+        // Ядра используют элементы над диагональю как рабочую память
+        template <class Matrix>
+        void clear_upper(Matrix & L)
+        {
+            using Value = typename Matrix::value_type;
+
+            for(auto const & i : grabin::view::indices(L.dim1()))
+            for(auto const & j : grabin::view::indices(i + 1, L.dim2()))
+            {
+                L(i, j) = Value(0);
+            }
+        }
+
+        /* Разложение Холецкого: если элементы хранятся в массиве, то
+        используется блочное ядро, иначе -- поэлементный алгоритм
+        */
+        template <class Matrix>
+        auto cholesky_decompose(Matrix & L, int)
+        -> decltype(grabin::kernels::potrf(L.dim1(), L.data(), std::ptrdiff_t(1), std::ptrdiff_t(1)))
+        {
+            using Layout = grabin::matrix_layout_t<Matrix>;
+
+            auto const n = L.dim1();
+            auto const ld = Layout::leading_dimension(n, n);
+
+            auto const result = grabin::kernels::potrf(n, L.data(), Layout::offset(1, 0, ld),
+                                                       Layout::offset(0, 1, ld));
+            detail::clear_upper(L);
+
+            return result;
+        }
+
+        template <class Matrix>
+        bool cholesky_decompose(Matrix & L, long)
+        {
+            using std::sqrt;
+
+            auto const n = L.dim1();
+
+            for(auto const & k : grabin::view::indices(n))
+            {
+                if(!(L(k, k) > 0))
+                {
+                    return false;
+                }
+
+                L(k, k) = sqrt(L(k, k));
+
+                for(auto const & i : grabin::view::indices(k + 1, n))
+                {
+                    L(i, k) /= L(k, k);
+                }
+
+                for(auto const & j : grabin::view::indices(k + 1, n))
+                for(auto const & i : grabin::view::indices(j, n))
+                {
+                    L(i, j) -= L(i, k) * L(j, k);
+                }
+            }
+
+            return true;
+        }
+
+        // Разложение L*D*L^T: то же разделение на блочный и поэлементный случаи
+        template <class Matrix, class T>
+        auto ldlt_decompose(Matrix & L, T const & tolerance, int)
+        -> decltype(grabin::kernels::ldlt(L.dim1(), L.data(), std::ptrdiff_t(1),
+                                          std::ptrdiff_t(1), tolerance))
+        {
+            using Layout = grabin::matrix_layout_t<Matrix>;
+
+            auto const n = L.dim1();
+            auto const ld = Layout::leading_dimension(n, n);
+
+            auto const rank = grabin::kernels::ldlt(n, L.data(), Layout::offset(1, 0, ld),
+                                                    Layout::offset(0, 1, ld), tolerance);
+            detail::clear_upper(L);
+
+            return rank;
+        }
+
+        template <class Matrix, class T>
+        std::ptrdiff_t ldlt_decompose(Matrix & L, T const & tolerance, long)
+        {
+            using std::abs;
+            using Value = typename Matrix::value_type;
+
+            auto const n = L.dim1();
+            auto rank = std::ptrdiff_t(0);
+
+            for(auto const & k : grabin::view::indices(n))
+            {
+                if(abs(L(k, k)) <= tolerance)
+                {
+                    for(auto const & i : grabin::view::indices(k, n))
+                    {
+                        L(i, k) = Value(0);
+                    }
+
+                    continue;
+                }
+
+                ++ rank;
+
+                for(auto const & j : grabin::view::indices(k + 1, n))
+                for(auto const & i : grabin::view::indices(j, n))
+                {
+                    L(i, j) -= L(i, k) * L(j, k) / L(k, k);
+                }
+
+                for(auto const & i : grabin::view::indices(k + 1, n))
+                {
+                    L(i, k) /= L(k, k);
+                }
+            }
+
+            return rank;
+        }
+
+        /* Решение систем L*y == b и L^T*x == y для нижней треугольной
+        матрицы L. Обе подстановки обходят элементы L в порядке их
+        размещения в памяти. Если unit == true, то диагональ L считается
+        единичной
+        */
+        template <class Matrix, class Vector>
+        void lower_substitute(grabin::row_major, Matrix const & L, Vector & x, bool unit)
+        {
+            auto const n = L.dim1();
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                for(auto const & j : grabin::view::indices(i))
+                {
+                    x[i] -= L(i, j) * x[j];
+                }
+
+                if(!unit)
+                {
+                    x[i] /= L(i, i);
+                }
+            }
+        }
+
+        template <class Matrix, class Vector>
+        void lower_substitute(grabin::column_major, Matrix const & L, Vector & x, bool unit)
+        {
+            auto const n = L.dim1();
+
+            for(auto const & j : grabin::view::indices(n))
+            {
+                if(!unit)
+                {
+                    x[j] /= L(j, j);
+                }
+
+                for(auto const & i : grabin::view::indices(j + 1, n))
+                {
+                    x[i] -= L(i, j) * x[j];
+                }
+            }
+        }
+
+        template <class Matrix, class Vector>
+        void lower_transpose_substitute(grabin::row_major, Matrix const & L, Vector & x, bool unit)
+        {
+            for(auto j = L.dim1(); j > 0; -- j)
+            {
+                if(!unit)
+                {
+                    x[j-1] /= L(j-1, j-1);
+                }
+
+                for(auto i = j - 1; i > 0; -- i)
+                {
+                    x[i-1] -= L(j-1, i-1) * x[j-1];
+                }
+            }
+        }
+
+        template <class Matrix, class Vector>
+        void lower_transpose_substitute(grabin::column_major, Matrix const & L, Vector & x, bool unit)
+        {
+            auto const n = L.dim1();
+
+            for(auto i = n; i > 0; -- i)
+            {
+                for(auto j = i; j < n; ++ j)
+                {
+                    x[i-1] -= L(j, i-1) * x[j];
+                }
+
+                if(!unit)
+                {
+                    x[i-1] /= L(i-1, i-1);
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Разложение Холецкого симметричной положительно определённой
+    матрицы, вычисляемое один раз и используемое для решения многих систем
+    уравнений с этой матрицей
+    @tparam Matrix тип матрицы, в которой хранятся множители
+
+    Вычисляется разложение <tt>A == L*L^T</tt>, где @c L -- нижняя
+    треугольная матрица с положительной диагональю. Используются только
+    элементы исходной матрицы на главной диагонали и под ней. Разложение
+    требует вдвое меньше операций, чем LU-разложение (если элементы хранятся
+    в массиве, то используется блочное ядро <tt>kernels::potrf</tt>), и не
+    нуждается в перестановках. Кроме того, разложение существует тогда и
+    только тогда, когда матрица положительно определена, поэтому оно служит
+    дешёвой проверкой положительной определённости. Удобно создавать объект
+    с помощью функции @c make_cholesky_factorization.
+    */
+    template <class Matrix>
+    class cholesky_factorization
+    {
+    public:
+        // Типы
+        /// @brief Тип матрицы, в которой хранятся множители
+        using matrix_type = Matrix;
+
+        /// @brief Тип элементов
+        using value_type = typename matrix_type::value_type;
+
+        /// @brief Тип для представления размерности
+        using size_type = decltype(std::declval<matrix_type const &>().dim1());
+
+        // Создание, копирование, уничтожение
+        /** @brief Вычисление разложения Холецкого
+        @param A симметричная квадратная матрица
+        @throw std::logic_error, если матрица @c A не является квадратной
+
+        Если матрица не является положительно определённой, то это не
+        является ошибкой, но решать системы уравнений с ней нельзя.
+        */
+        template <class SourceMatrix>
+        explicit cholesky_factorization(SourceMatrix const & A)
+         : L_((detail::ensure_square(A),
+               grabin::make_no_init<matrix_type>(A.dim1(), A.dim2())))
+        {
+            detail::lower_copy(Layout{}, A, this->L_);
+            this->positive_definite_ = detail::cholesky_decompose(this->L_, 0);
+        }
+
+        // Свойства
+        /// @brief Порядок матрицы
+        size_type dim() const
+        {
+            return this->L_.dim1();
+        }
+
+        /** @brief Множитель разложения
+        @return Нижняя треугольная матрица @c L, такая что
+        <tt>A == L*L^T</tt>
+        @pre <tt>this->is_positive_definite()</tt>, иначе значения элементов
+        не определены
+        */
+        matrix_type const & factors() const
+        {
+            return this->L_;
+        }
+
+        /** @brief Проверка положительной определённости
+        @return @b true, если исходная матрица положительно определена
+        */
+        bool is_positive_definite() const
+        {
+            return this->positive_definite_;
+        }
+
+        /** @brief Определитель исходной матрицы
+        @return Квадрат произведения диагональных элементов @c L
+        @throw std::domain_error, если матрица не является положительно
+        определённой
+        */
+        value_type determinant() const
+        {
+            this->ensure_positive_definite();
+
+            auto result = value_type(1);
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                result *= this->L_(i, i);
+            }
+
+            return result * result;
+        }
+
+        // Решение систем уравнений
+        /** @brief Решение системы уравнений с заменой правой части решением
+        @param x вектор правой части, после вызова -- решение системы
+        @throw std::logic_error, если <tt>x.dim() != this->dim()</tt>
+        @throw std::domain_error, если матрица не является положительно
+        определённой
+
+        Память не выделяется.
+        */
+        template <class Vector>
+        void solve_in_place(Vector && x) const
+        {
+            if(x.dim() != this->dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            this->ensure_positive_definite();
+
+            detail::lower_substitute(Layout{}, this->L_, x, false);
+            detail::lower_transpose_substitute(Layout{}, this->L_, x, false);
+        }
+
+        /** @brief Решение системы уравнений
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        @throw То же, что и @c solve_in_place
+        */
+        template <class Vector>
+        grabin::evaluated_type_t<Vector>
+        solve(Vector const & b) const
+        {
+            grabin::evaluated_type_t<Vector> x(b);
+            this->solve_in_place(x);
+            return x;
+        }
+
+    private:
+        using Layout = grabin::matrix_layout_t<matrix_type>;
+
+        void ensure_positive_definite() const
+        {
+            if(!this->positive_definite_)
+            {
+                throw std::domain_error("Matrix is not positive definite");
+            }
+        }
+
+        matrix_type L_;
+        bool positive_definite_ = false;
+    };
+
+    /** @brief Вычисление разложения Холецкого
+    @param A симметричная квадратная матрица, в том числе
+    @c symmetric_matrix
+    @return <tt>cholesky_factorization<M>(A)</tt>, где @c M -- тип плотной
+    матрицы, соответствующий типу @c Matrix
+    */
+    template <class Matrix>
+    cholesky_factorization<detail::symmetric_factor_matrix_t<Matrix>>
+    make_cholesky_factorization(Matrix const & A)
+    {
+        return cholesky_factorization<detail::symmetric_factor_matrix_t<Matrix>>(A);
+    }
+
+    /** @brief Разложение симметричной матрицы вида <tt>A == L*D*L^T</tt>
+    @tparam Matrix тип матрицы, в которой хранятся множители
+
+    Здесь @c L -- нижняя треугольная матрица с единичной диагональю, а @c D
+    -- диагональная матрица. В отличие от разложения Холецкого, не требуется
+    извлекать квадратные корни и разложение существует и для положительно
+    полуопределённых (вырожденных) матриц, например, для ковариационных
+    матриц линейно зависимых величин. Элементы @c D, не превосходящие по
+    модулю заданного порога, считаются нулевыми. Перестановки не
+    выполняются, поэтому для знаконеопределённых матриц метод может быть
+    неустойчивым. Удобно создавать объект с помощью функции
+    @c make_ldlt_factorization.
+    */
+    template <class Matrix>
+    class ldlt_factorization
+    {
+    public:
+        // Типы
+        /// @brief Тип матрицы, в которой хранятся множители
+        using matrix_type = Matrix;
+
+        /// @brief Тип элементов
+        using value_type = typename matrix_type::value_type;
+
+        /// @brief Тип для представления размерности
+        using size_type = decltype(std::declval<matrix_type const &>().dim1());
+
+        // Создание, копирование, уничтожение
+        /** @brief Вычисление разложения с порогом по умолчанию
+        @param A симметричная квадратная матрица
+        @throw std::logic_error, если матрица @c A не является квадратной
+
+        Порог равен <tt>sqrt(eps) * max|A(i, i)|</tt>, где @c eps --
+        машинный эпсилон для типа @c value_type. Так как перестановки не
+        выполняются, погрешность элементов @c D, которые равны нулю в точной
+        арифметике, может заметно превосходить <tt>eps * max|A(i, i)|</tt>.
+        */
+        template <class SourceMatrix>
+        explicit ldlt_factorization(SourceMatrix const & A)
+         : ldlt_factorization(A, ldlt_factorization::default_tolerance(A))
+        {}
+
+        /** @brief Вычисление разложения с заданным порогом
+        @param A симметричная квадратная матрица
+        @param tolerance порог: элементы @c D, не превосходящие его по модулю,
+        считаются нулевыми
+        @throw std::logic_error, если матрица @c A не является квадратной
+        */
+        template <class SourceMatrix>
+        ldlt_factorization(SourceMatrix const & A, value_type const & tolerance)
+         : L_((detail::ensure_square(A),
+               grabin::make_no_init<matrix_type>(A.dim1(), A.dim2())))
+        {
+            detail::lower_copy(Layout{}, A, this->L_);
+            this->rank_ = detail::ldlt_decompose(this->L_, tolerance, 0);
+        }
+
+        // Свойства
+        /// @brief Порядок матрицы
+        size_type dim() const
+        {
+            return this->L_.dim1();
+        }
+
+        /** @brief Множители разложения
+        @return Матрица, под главной диагональю которой хранятся элементы
+        @c L (кроме единичной диагонали), а на главной диагонали -- элементы
+        @c D
+        */
+        matrix_type const & factors() const
+        {
+            return this->L_;
+        }
+
+        /** @brief Ранг исходной матрицы
+        @return Количество ненулевых элементов @c D
+        */
+        size_type rank() const
+        {
+            return this->rank_;
+        }
+
+        /** @brief Проверка положительной полуопределённости
+        @return @b true, если все элементы @c D неотрицательны
+        */
+        bool is_positive_semidefinite() const
+        {
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                if(this->L_(i, i) < value_type(0))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /** @brief Определитель исходной матрицы
+        @return Произведение элементов @c D
+        */
+        value_type determinant() const
+        {
+            auto result = value_type(1);
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                result *= this->L_(i, i);
+            }
+
+            return result;
+        }
+
+        // Решение систем уравнений
+        /** @brief Решение системы уравнений с заменой правой части решением
+        @param x вектор правой части, после вызова -- решение системы
+        @throw std::logic_error, если <tt>x.dim() != this->dim()</tt>
+
+        Если матрица вырождена, то компоненты решения системы
+        <tt>D*z == y</tt>, соответствующие нулевым элементам @c D, полагаются
+        равными нулю. Для совместной системы, например, нормальных уравнений
+        регрессии с линейно зависимыми переменными, получается одно из её
+        решений. Память не выделяется.
+        */
+        template <class Vector>
+        void solve_in_place(Vector && x) const
+        {
+            if(x.dim() != this->dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+
+            detail::lower_substitute(Layout{}, this->L_, x, true);
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                auto const & d = this->L_(i, i);
+
+                x[i] = (d == value_type(0)) ? value_type(0) : x[i] / d;
+            }
+
+            detail::lower_transpose_substitute(Layout{}, this->L_, x, true);
+        }
+
+        /** @brief Решение системы уравнений
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        @throw То же, что и @c solve_in_place
+        */
+        template <class Vector>
+        grabin::evaluated_type_t<Vector>
+        solve(Vector const & b) const
+        {
+            grabin::evaluated_type_t<Vector> x(b);
+            this->solve_in_place(x);
+            return x;
+        }
+
+    private:
+        using Layout = grabin::matrix_layout_t<matrix_type>;
+
+        template <class SourceMatrix>
+        static value_type default_tolerance(SourceMatrix const & A)
+        {
+            using std::abs;
+
+            auto max_diag = value_type(0);
+
+            for(auto const & i : grabin::view::indices(std::min(A.dim1(), A.dim2())))
+            {
+                max_diag = std::max(max_diag, value_type(abs(A(i, i))));
+            }
+
+            using std::sqrt;
+
+            return sqrt(std::numeric_limits<value_type>::epsilon()) * max_diag;
+        }
+
+        matrix_type L_;
+        size_type rank_ = 0;
+    };
+
+    /** @brief Вычисление разложения <tt>A == L*D*L^T</tt>
+    @param A симметричная квадратная матрица, в том числе
+    @c symmetric_matrix
+    @return <tt>ldlt_factorization<M>(A)</tt>, где @c M -- тип плотной
+    матрицы, соответствующий типу @c Matrix
+    */
+    template <class Matrix>
+    ldlt_factorization<detail::symmetric_factor_matrix_t<Matrix>>
+    make_ldlt_factorization(Matrix const & A)
+    {
+        return ldlt_factorization<detail::symmetric_factor_matrix_t<Matrix>>(A);
+    }
+
+    /** @brief Решение систем линейных алгебраических уравнений с симметричной
+    положительно определённой матрицей методом Холецкого
+
+    Подходит, например, для нормальных уравнений линейной регрессии, то есть
+    может использоваться как параметр @c Solver класса
+    <tt>statistics::linear_regression_accumulator</tt>. Матрица может быть
+    упакованной (@c symmetric_matrix).
+    */
+    struct cholesky_solver
+    {
+        /** @brief Решение системы уравнений
+        @param A симметричная положительно определённая матрица
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        @throw std::domain_error, если матрица не является положительно
+        определённой
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            assert(b.dim() == A.dim1());
+            assert(A.dim2() == A.dim1());
+
+            return linear_algebra::make_cholesky_factorization(A).solve(b);
+        }
+    };
+
+    /** @brief Решение систем линейных алгебраических уравнений с симметричной
+    положительно полуопределённой матрицей с помощью разложения
+    <tt>A == L*D*L^T</tt>
+
+    В отличие от @c cholesky_solver, допускает вырожденные матрицы (см.
+    <tt>ldlt_factorization::solve_in_place</tt>), например, ковариационные
+    матрицы линейно зависимых входных переменных регрессии.
+    */
+    struct LDLT_solver
+    {
+        /** @brief Решение системы уравнений
+        @param A симметричная положительно полуопределённая матрица
+        @param b вектор правой части
+        @return Решение системы <tt>A*x == b</tt>
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            assert(b.dim() == A.dim1());
+            assert(A.dim2() == A.dim1());
+
+            return linear_algebra::make_ldlt_factorization(A).solve(b);
+        }
+    };
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_NUMERIC_DENSE_FACTORIZATION_HPP_INCLUDED
@@ -0,0 +1,176 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_NUMERIC_INNER_PRODUCT_HPP_INCLUDED
+#define Z_GRABIN_NUMERIC_INNER_PRODUCT_HPP_INCLUDED
+
+/** @file grabin/numeric/inner_product.hpp
+ @brief Скалярное произведение векторов
+*/
+
+#include <grabin/execution.hpp>
+#include <grabin/math/kernels.hpp>
+#include <grabin/numeric.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace linear_algebra
+{
+    /// @cond false
+    namespace detail
+    {
+        // Векторы с непрерывным хранением элементов обрабатываются ядром
+        template <class Vector1, class Vector2>
+        auto inner_prod_impl(Vector1 const & x, Vector2 const & y, int)
+        -> decltype(grabin::kernels::dot(x.dim(), x.data(), y.data()))
+        {
+            return grabin::kernels::dot(x.dim(), x.data(), y.data());
+        }
+
+        template <class Vector1, class Vector2>
+        typename Vector1::value_type
+        inner_prod_impl(Vector1 const & x, Vector2 const & y, long)
+        {
+            auto const zero = typename Vector1::value_type(0);
+            return grabin::inner_product(x, y, zero);
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Скалярное произведение векторов
+    @param x, y аргументы
+    @pre <tt>x.dim() == y.dim()</tt>
+    @return <tt> std::inner_product(x.begin(), x.end(), y.begin(), zero)</tt>,
+    где <tt>zero == typename Vector1::value_type(0)</tt>
+
+    Типы аргументов могут различаться: например, можно вычислить скалярное
+    произведение вектора и представления внешнего буфера. Если элементы обоих
+    векторов хранятся непрерывно (есть функция-член @c data()), то
+    используется векторизованное ядро, поэтому порядок суммирования для чисел с
+    плавающей точкой может отличаться от последовательного.
+    */
+    template <class Vector1, class Vector2>
+    typename Vector1::value_type
+    inner_prod(Vector1 const & x, Vector2 const & y)
+    {
+        if(x.dim() != y.dim())
+        {
+            throw std::logic_error("Dimensions must be equal");
+        }
+
+        return detail::inner_prod_impl(x, y, 0);
+    }
+
+    /** @brief Скалярное произведение векторов с последовательной стратегией
+    выполнения
+    @return <tt>inner_prod(x, y)</tt>
+    */
+    template <class Vector1, class Vector2>
+    typename Vector1::value_type
+    inner_prod(execution::sequenced_policy, Vector1 const & x, Vector2 const & y)
+    {
+        return linear_algebra::inner_prod(x, y);
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        template <class Vector1, class Vector2>
+        auto inner_prod_impl(execution::parallel_policy const & policy,
+                             Vector1 const & x, Vector2 const & y, int)
+        -> decltype(grabin::kernels::dot(x.dim(), x.data(), y.data()))
+        {
+            using Result = decltype(grabin::kernels::dot(x.dim(), x.data(), y.data()));
+
+            auto const x_data = x.data();
+            auto const y_data = y.data();
+
+            auto dot_block = [x_data, y_data](std::ptrdiff_t first, std::ptrdiff_t last)
+            {
+                return grabin::kernels::dot(last - first, x_data + first, y_data + first);
+            };
+
+            return execution::detail::blocked_reduce(policy, x.dim(), Result(0),
+                                                     dot_block, std::plus<>{});
+        }
+
+        template <class Vector1, class Vector2>
+        typename Vector1::value_type
+        inner_prod_impl(execution::parallel_policy const &,
+                        Vector1 const & x, Vector2 const & y, long)
+        {
+            return detail::inner_prod_impl(x, y, 0);
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Параллельное скалярное произведение векторов
+    @param policy стратегия параллельного выполнения
+    @param x, y аргументы
+    @pre <tt>x.dim() == y.dim()</tt>
+    @return Скалярное произведение @c x и @c y
+
+    Если элементы обоих векторов хранятся непрерывно, то векторы делятся на
+    блоки размера <tt>policy.grain_size()</tt>, скалярные произведения блоков
+    вычисляются векторизованным ядром в нескольких потоках и суммируются в
+    порядке следования блоков, так что результат не зависит от количества
+    потоков. В противном случае произведение вычисляется последовательно.
+    */
+    template <class Vector1, class Vector2>
+    typename Vector1::value_type
+    inner_prod(execution::parallel_policy const & policy, Vector1 const & x, Vector2 const & y)
+    {
+        if(x.dim() != y.dim())
+        {
+            throw std::logic_error("Dimensions must be equal");
+        }
+
+        return detail::inner_prod_impl(policy, x, y, 0);
+    }
+
+    /// @brief Тип функционального объекта, выполняющего внутреннее (скалярное) произведение
+    struct inner_product
+    {
+        /** @brief Скалярное произведение векторов
+        @param x, y аргументы
+        @pre <tt>x.dim() == y.dim()</tt>
+        @return <tt> std::inner_product(x.begin(), x.end(), y.begin(), zero)</tt>,
+        где <tt>zero == typename Vector1::value_type(0)</tt>
+        */
+        template <class Vector1, class Vector2>
+        typename Vector1::value_type
+        operator()(Vector1 const & x, Vector2 const & y) const
+        {
+            return grabin::linear_algebra::inner_prod(x, y);
+        }
+    };
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_NUMERIC_INNER_PRODUCT_HPP_INCLUDED
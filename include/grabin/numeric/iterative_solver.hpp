@@ -0,0 +1,1653 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_NUMERIC_ITERATIVE_SOLVER_HPP_INCLUDED
+#define Z_GRABIN_NUMERIC_ITERATIVE_SOLVER_HPP_INCLUDED
+
+/** @file grabin/numeric/iterative_solver.hpp
+ @brief Итерационные методы решения систем линейных алгебраических уравнений
+ и предобуславливатели
+
+ Методы принимают матрицы (в том числе разреженные) и линейные операторы из
+ grabin/numeric/linear_operator.hpp.
+*/
+
+#include <grabin/math/evaluated_type.hpp>
+#include <grabin/numeric/blas.hpp>
+#include <grabin/numeric/inner_product.hpp>
+#include <grabin/numeric/linear_operator.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace linear_algebra
+{
+    /** @brief Параметры итерационного метода решения СЛАУ
+
+    Итерации прекращаются, как только норма невязки <tt>||b - A*x||</tt> не
+    превосходит <tt>max(tolerance * ||b||, absolute_tolerance)</tt>, или после
+    @c max_iterations итераций.
+    */
+    struct iterative_options
+    {
+        /// @brief Допустимая относительная норма невязки
+        double tolerance = 1e-10;
+
+        /// @brief Допустимая абсолютная норма невязки
+        double absolute_tolerance = 0.0;
+
+        /// @brief Максимальное количество итераций
+        std::ptrdiff_t max_iterations = 100;
+    };
+
+    /// @brief Результаты работы итерационного метода решения СЛАУ
+    struct iterative_report
+    {
+        /// @brief Количество выполненных итераций
+        std::ptrdiff_t iterations = 0;
+
+        /// @brief Евклидова норма невязки полученного приближения
+        double residual = 0.0;
+
+        /// @brief Достигнута ли заданная точность
+        bool converged = false;
+    };
+
+    /** @brief Рабочая память итерационных методов решения СЛАУ
+    @tparam Vector тип вспомогательных векторов
+
+    Хранит вспомогательные векторы, нужные методу. Один и тот же объект можно
+    передавать в последовательные вызовы: память выделяется заново, только
+    если не хватает векторов или изменилась размерность системы. Объект не
+    должен использоваться одновременно в нескольких потоках.
+    */
+    template <class Vector>
+    class iterative_workspace
+    {
+    public:
+        // Типы
+        /// @brief Тип вспомогательных векторов
+        using vector_type = Vector;
+
+        /// @brief Тип для представления количества векторов и размерности
+        using size_type = std::ptrdiff_t;
+
+        // Доступ к векторам
+        /** @brief Подготовка вспомогательных векторов
+        @param count количество векторов
+        @param dim размерность векторов
+        @post <tt>this->size() >= count</tt>, а первые @c count векторов имеют
+        размерность @c dim; значения их элементов не определены
+        */
+        void reserve(size_type count, size_type dim)
+        {
+            auto const old_size = static_cast<size_type>(this->vectors_.size());
+
+            for(auto const & k : grabin::view::indices(std::min(count, old_size)))
+            {
+                if(this->vectors_[k].dim() != dim)
+                {
+                    this->vectors_[k] = vector_type(dim);
+                }
+            }
+
+            for(auto k = old_size; k < count; ++ k)
+            {
+                this->vectors_.emplace_back(dim);
+            }
+        }
+
+        /// @brief Количество подготовленных векторов
+        size_type size() const
+        {
+            return static_cast<size_type>(this->vectors_.size());
+        }
+
+        /** @brief Доступ к вспомогательному вектору
+        @param k номер вектора
+        @pre <tt>0 <= k && k < this->size()</tt>
+        */
+        vector_type & operator[](size_type k)
+        {
+            assert(0 <= k && k < this->size());
+
+            return this->vectors_[k];
+        }
+
+    private:
+        std::vector<vector_type> vectors_;
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        // r = b - A*x
+        template <class Matrix, class Vector1, class Vector2, class Vector3>
+        void iterative_residual(Matrix const & A, Vector1 const & b, Vector2 const & x,
+                                Vector3 & r)
+        {
+            linear_algebra::apply_operator(A, x, r);
+            linear_algebra::scal(-1, r);
+            linear_algebra::axpy(1, b, r);
+        }
+
+        // Порог для нормы невязки
+        template <class Vector>
+        double iterative_threshold(Vector const & b, iterative_options const & options)
+        {
+            return std::max(options.tolerance * static_cast<double>(linear_algebra::nrm2(b)),
+                            options.absolute_tolerance);
+        }
+
+        template <class Matrix, class Vector>
+        void ensure_iterative_dimensions(Matrix const & A, Vector const & b)
+        {
+            if(A.dim1() != A.dim2() || A.dim1() != b.dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+        }
+
+        /* Функциональные объекты-решатели не возвращают отчёт, поэтому
+        недостижение заданной точности сообщается исключением, а не
+        возвратом приближения, которое может быть далеко от решения
+        */
+        inline void ensure_converged(iterative_report const & report)
+        {
+            if(!report.converged)
+            {
+                throw std::runtime_error("Iterative method did not converge");
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Решение СЛАУ методом минимальных невязок
+    @param A квадратная матрица или оператор с функцией-членом
+    <tt>apply(x, y)</tt>, вычисляющей <tt>y = A*x</tt>
+    @param b вектор правой части
+    @param x начальное приближение, после вызова -- найденное приближение
+    @param options параметры итерационного процесса
+    @param workspace рабочая память
+    @return Количество итераций, норма невязки и признак сходимости
+    @throw std::logic_error, если размерности не согласованы
+
+    На каждой итерации <tt>x += lambda*r</tt>, где <tt>r == b - A*x</tt>, а
+    @c lambda минимизирует норму новой невязки. Метод сходится, если
+    симметричная часть @c A положительно определена. Невязка пересчитывается
+    рекуррентно, так что на итерацию приходится одно умножение матрицы на
+    вектор. Если рабочая память уже подготовлена для этой размерности, то
+    память не выделяется, а разреженная матрица умножается на вектор без
+    создания временных векторов.
+    */
+    template <class Matrix, class Vector1, class Vector2, class WorkVector>
+    iterative_report
+    minimal_residue(Matrix const & A, Vector1 const & b, Vector2 && x,
+                    iterative_options const & options,
+                    iterative_workspace<WorkVector> & workspace)
+    {
+        using Value = typename WorkVector::value_type;
+
+        detail::ensure_iterative_dimensions(A, b);
+
+        if(x.dim() != b.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        workspace.reserve(2, b.dim());
+
+        auto & r = workspace[0];
+        auto & Ar = workspace[1];
+
+        auto const threshold = detail::iterative_threshold(b, options);
+
+        detail::iterative_residual(A, b, x, r);
+
+        iterative_report report;
+        report.residual = linear_algebra::nrm2(r);
+
+        while(report.residual > threshold && report.iterations < options.max_iterations)
+        {
+            linear_algebra::apply_operator(A, r, Ar);
+
+            auto const Ar_Ar = linear_algebra::inner_prod(Ar, Ar);
+
+            if(Ar_Ar == Value(0))
+            {
+                break;
+            }
+
+            auto const lambda = linear_algebra::inner_prod(r, Ar) / Ar_Ar;
+
+            linear_algebra::axpy(lambda, r, x);
+            linear_algebra::axpy(-lambda, Ar, r);
+
+            report.residual = linear_algebra::nrm2(r);
+            ++ report.iterations;
+        }
+
+        report.converged = (report.residual <= threshold);
+
+        return report;
+    }
+
+    /** @brief Решение СЛАУ методом минимальных невязок с временной рабочей
+    памятью
+    @return <tt>minimal_residue(A, b, x, options, workspace)</tt>, где
+    @c workspace -- новый объект
+    */
+    template <class Matrix, class Vector1, class Vector2>
+    iterative_report
+    minimal_residue(Matrix const & A, Vector1 const & b, Vector2 && x,
+                    iterative_options const & options = iterative_options())
+    {
+        iterative_workspace<grabin::evaluated_type_t<std::decay_t<Vector2>>> workspace;
+
+        return linear_algebra::minimal_residue(A, b, x, options, workspace);
+    }
+
+    /** @brief Решение СЛАУ методом минимальных невязок
+    @param A матрица
+    @param b вектор правой части
+    @pre <tt>A.dim2() == b.dim()</tt>
+    @return Приближённое решение СЛАУ <tt>A*x == b</tt>, полученное из
+    нулевого начального приближения с параметрами по умолчанию
+
+    Матрица и вектор могут быть представлениями внешних данных, решение
+    возвращается в векторе, владеющем своими элементами. Если заданная
+    точность не достигнута, то возвращается последнее приближение: чтобы
+    узнать, сошёлся ли метод, используйте перегрузку, возвращающую
+    @c iterative_report.
+    */
+    template <class Matrix, class Vector>
+    grabin::evaluated_type_t<Vector>
+    minimal_residue(Matrix const & A, Vector const & b)
+    {
+        auto const & b_value = grabin::detail::vector_operand(b, 0);
+
+        grabin::evaluated_type_t<Vector> x(b.dim());
+
+        linear_algebra::minimal_residue(A, b_value, x);
+
+        return x;
+    }
+
+    /** @brief Решение СЛАУ методом минимальных невязок
+
+    Функциональный объект для использования в качестве параметра @c Solver.
+    */
+    struct minimal_residue_solver
+    {
+        /// @brief Параметры итерационного процесса
+        iterative_options options;
+
+        /** @brief Решение системы уравнений
+        @param A матрица
+        @param b вектор правой части
+        @return Приближённое решение системы <tt>A*x == b</tt>: последнее
+        приближение, даже если заданная точность не достигнута за
+        <tt>options.max_iterations</tt> итераций
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            auto const & b_value = grabin::detail::vector_operand(b, 0);
+
+            grabin::evaluated_type_t<Vector> x(b.dim());
+
+            linear_algebra::minimal_residue(A, b_value, x, this->options);
+
+            return x;
+        }
+    };
+
+    // Предобуславливатели
+    /** @brief Тождественный предобуславливатель
+
+    Использование с @c conjugate_gradient даёт метод сопряжённых градиентов
+    без предобуславливания.
+    */
+    struct identity_preconditioner
+    {
+        /// @brief Конструктор без аргументов
+        identity_preconditioner() = default;
+
+        /** @brief Конструктор для совместимости с другими предобуславливателями
+        @param A матрица (не используется)
+        */
+        template <class Matrix>
+        explicit identity_preconditioner(Matrix const & A)
+        {
+            (void)A;
+        }
+
+        /** @brief Применение предобуславливателя
+        @param r вектор
+        @param z вектор, в который записывается результат
+        @post <tt>z == r</tt>
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & r, Vector2 && z) const
+        {
+            linear_algebra::copy(r, z);
+        }
+    };
+
+    /** @brief Диагональный предобуславливатель (метод Якоби)
+    @tparam T тип элементов
+
+    Умножает вектор на матрицу, обратную к диагональной части исходной
+    матрицы. Эффективен, если диагональные элементы матрицы сильно
+    различаются по величине.
+    */
+    template <class T>
+    class jacobi_preconditioner
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления размерности
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Построение по матрице
+        @param A квадратная матрица, предоставляющая доступ к диагональным
+        элементам через <tt>A(i, i)</tt>
+        @throw std::logic_error, если матрица не является квадратной
+        @throw std::domain_error, если один из диагональных элементов равен
+        нулю
+        */
+        template <class Matrix>
+        explicit jacobi_preconditioner(Matrix const & A)
+         : inverse_diagonal_((detail::ensure_square(A), A.dim1()))
+        {
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                auto const a_ii = value_type(A(i, i));
+
+                if(a_ii == value_type(0))
+                {
+                    throw std::domain_error("Zero diagonal element");
+                }
+
+                this->inverse_diagonal_[i] = value_type(1) / a_ii;
+            }
+        }
+
+        // Свойства
+        /// @brief Размерность
+        size_type dim() const
+        {
+            return static_cast<size_type>(this->inverse_diagonal_.size());
+        }
+
+        // Применение
+        /** @brief Применение предобуславливателя
+        @param r вектор
+        @param z вектор, в который записывается результат
+        @pre <tt>r.dim() == this->dim() && z.dim() == this->dim()</tt>
+        @post <tt>z[i] == r[i] / A(i, i)</tt>
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & r, Vector2 && z) const
+        {
+            assert(r.dim() == this->dim() && z.dim() == this->dim());
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                z[i] = this->inverse_diagonal_[i] * r[i];
+            }
+        }
+
+    private:
+        std::vector<value_type> inverse_diagonal_;
+    };
+
+    /** @brief Создание диагонального предобуславливателя
+    @param A квадратная матрица
+    @return <tt>jacobi_preconditioner<typename Matrix::value_type>(A)</tt>
+    */
+    template <class Matrix>
+    jacobi_preconditioner<typename Matrix::value_type>
+    make_jacobi_preconditioner(Matrix const & A)
+    {
+        return jacobi_preconditioner<typename Matrix::value_type>(A);
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        /* Обход ненулевых элементов по строкам, внутри строки -- по
+        возрастанию номеров столбцов. Для разреженных матриц используется
+        сжатый строчный формат, остальные просматриваются целиком
+        */
+        template <class Matrix, class Function>
+        auto for_each_entry(Matrix const & A, Function f, int)
+        -> decltype(A.row_offsets(), A.column_indices(), A.values(), void())
+        {
+            auto const & offsets = A.row_offsets();
+            auto const & columns = A.column_indices();
+            auto const & values = A.values();
+
+            for(auto const & i : grabin::view::indices(A.dim1()))
+            for(auto k = offsets[i]; k != offsets[i + 1]; ++ k)
+            {
+                f(i, columns[k], values[k]);
+            }
+        }
+
+        template <class Matrix, class Function>
+        void for_each_entry(Matrix const & A, Function f, long)
+        {
+            using Value = typename Matrix::value_type;
+
+            for(auto const & i : grabin::view::indices(A.dim1()))
+            for(auto const & j : grabin::view::indices(A.dim2()))
+            {
+                auto const a_ij = Value(A(i, j));
+
+                if(a_ij != Value(0))
+                {
+                    f(i, j, a_ij);
+                }
+            }
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Предобуславливатель на основе неполного разложения Холецкого
+    без заполнения (IC(0))
+    @tparam T тип элементов
+
+    Вычисляется нижняя треугольная матрица @c L, ненулевые элементы которой
+    могут располагаться только там же, где ненулевые элементы нижнего
+    треугольника исходной симметричной матрицы, такая что
+    <tt>L*L^T</tt> приближает исходную матрицу. Множитель хранится в сжатом
+    строчном формате, поэтому для разреженной матрицы объём памяти и
+    стоимость применения пропорциональны количеству её ненулевых элементов.
+    Разложение существует, например, для симметричных M-матриц (в частности,
+    для разностных аппроксимаций оператора Лапласа) и матриц с диагональным
+    преобладанием.
+    */
+    template <class T>
+    class incomplete_cholesky_preconditioner
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления размерности
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Вычисление неполного разложения
+        @param A симметричная квадратная матрица, в том числе @c csr_matrix;
+        используются только элементы на главной диагонали и под ней
+        @throw std::logic_error, если матрица не является квадратной
+        @throw std::domain_error, если разложение не существует (встретился
+        неположительный диагональный элемент)
+        */
+        template <class Matrix>
+        explicit incomplete_cholesky_preconditioner(Matrix const & A)
+         : offsets_((detail::ensure_square(A), A.dim1() + 1), 0)
+        {
+            detail::for_each_entry(A, [this](size_type i, size_type j, value_type a_ij)
+            {
+                if(j > i)
+                {
+                    return;
+                }
+
+                this->columns_.push_back(j);
+                this->values_.push_back(a_ij);
+                this->offsets_[i + 1] = static_cast<size_type>(this->values_.size());
+            }, 0);
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                this->offsets_[i + 1] = std::max(this->offsets_[i + 1], this->offsets_[i]);
+            }
+
+            this->factorize();
+        }
+
+        // Свойства
+        /// @brief Размерность
+        size_type dim() const
+        {
+            return static_cast<size_type>(this->offsets_.size()) - 1;
+        }
+
+        /// @brief Количество хранимых элементов множителя @c L
+        size_type nnz() const
+        {
+            return static_cast<size_type>(this->values_.size());
+        }
+
+        // Применение
+        /** @brief Применение предобуславливателя
+        @param r вектор
+        @param z вектор, в который записывается результат
+        @pre <tt>r.dim() == this->dim() && z.dim() == this->dim()</tt>
+        @post <tt>z</tt> -- решение системы <tt>L*L^T*z == r</tt>
+
+        Память не выделяется.
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & r, Vector2 && z) const
+        {
+            assert(r.dim() == this->dim() && z.dim() == this->dim());
+
+            auto const n = this->dim();
+
+            // L*y == r
+            for(auto const & i : grabin::view::indices(n))
+            {
+                auto sum = value_type(r[i]);
+                auto const last = this->offsets_[i + 1] - 1;
+
+                for(auto k = this->offsets_[i]; k != last; ++ k)
+                {
+                    sum -= this->values_[k] * z[this->columns_[k]];
+                }
+
+                z[i] = sum / this->values_[last];
+            }
+
+            // L^T*z == y: строки L -- это столбцы L^T
+            for(auto i = n; i > 0; -- i)
+            {
+                auto const last = this->offsets_[i] - 1;
+                auto const z_i = (z[i-1] /= this->values_[last]);
+
+                for(auto k = this->offsets_[i-1]; k != last; ++ k)
+                {
+                    z[this->columns_[k]] -= this->values_[k] * z_i;
+                }
+            }
+        }
+
+    private:
+        // Позиция диагонального элемента строки i, если он хранится
+        size_type diagonal_position(size_type i) const
+        {
+            auto const last = this->offsets_[i + 1];
+
+            if(last == this->offsets_[i] || this->columns_[last - 1] != i)
+            {
+                throw std::domain_error("Incomplete Cholesky factorization does not exist");
+            }
+
+            return last - 1;
+        }
+
+        void factorize()
+        {
+            using std::sqrt;
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                auto const first_i = this->offsets_[i];
+                auto const diag_i = this->diagonal_position(i);
+
+                for(auto p = first_i; p <= diag_i; ++ p)
+                {
+                    auto const k = this->columns_[p];
+                    auto sum = this->values_[p];
+
+                    // Сумма L(i, j) * L(k, j) по общим столбцам j < k
+                    auto q_i = first_i;
+                    auto q_k = this->offsets_[k];
+
+                    while(q_i < p && q_k < this->offsets_[k + 1] && this->columns_[q_k] < k)
+                    {
+                        if(this->columns_[q_i] < this->columns_[q_k])
+                        {
+                            ++ q_i;
+                        }
+                        else if(this->columns_[q_k] < this->columns_[q_i])
+                        {
+                            ++ q_k;
+                        }
+                        else
+                        {
+                            sum -= this->values_[q_i] * this->values_[q_k];
+                            ++ q_i;
+                            ++ q_k;
+                        }
+                    }
+
+                    if(k < i)
+                    {
+                        this->values_[p] = sum / this->values_[this->offsets_[k + 1] - 1];
+                    }
+                    else if(sum > value_type(0))
+                    {
+                        this->values_[p] = sqrt(sum);
+                    }
+                    else
+                    {
+                        throw std::domain_error("Incomplete Cholesky factorization does not exist");
+                    }
+                }
+            }
+        }
+
+        std::vector<size_type> offsets_;
+        std::vector<size_type> columns_;
+        std::vector<value_type> values_;
+    };
+
+    /** @brief Вычисление неполного разложения Холецкого
+    @param A симметричная квадратная матрица
+    @return <tt>incomplete_cholesky_preconditioner<typename Matrix::value_type>(A)</tt>
+    */
+    template <class Matrix>
+    incomplete_cholesky_preconditioner<typename Matrix::value_type>
+    make_incomplete_cholesky_preconditioner(Matrix const & A)
+    {
+        return incomplete_cholesky_preconditioner<typename Matrix::value_type>(A);
+    }
+
+    // Метод сопряжённых градиентов
+    /** @brief Решение СЛАУ с симметричной положительно определённой матрицей
+    методом сопряжённых градиентов с предобуславливанием
+    @param A симметричная положительно определённая матрица или оператор с
+    функцией-членом <tt>apply(x, y)</tt>, вычисляющей <tt>y = A*x</tt>
+    @param b вектор правой части
+    @param x начальное приближение, после вызова -- найденное приближение
+    @param M предобуславливатель: функция-член <tt>M.apply(r, z)</tt>
+    вычисляет <tt>z</tt> -- приближение к решению <tt>A*z == r</tt>;
+    соответствующий оператор должен быть симметричным и положительно
+    определённым
+    @param options параметры итерационного процесса
+    @param workspace рабочая память
+    @return Количество итераций, норма невязки и признак сходимости
+    @throw std::logic_error, если размерности не согласованы
+
+    На каждой итерации выполняется одно умножение на @c A и одно применение
+    предобуславливателя. В точной арифметике решение находится не более чем
+    за @c n итераций, а количество итераций, нужное для заданной точности,
+    растёт как квадратный корень из числа обусловленности, а не линейно, как у
+    @c minimal_residue. Если обнаружено, что @c A не является положительно
+    определённой, то итерации прекращаются и <tt>converged == false</tt>.
+    Если рабочая память уже подготовлена для этой размерности, то память не
+    выделяется.
+    */
+    template <class Matrix, class Vector1, class Vector2, class Preconditioner, class WorkVector>
+    iterative_report
+    conjugate_gradient(Matrix const & A, Vector1 const & b, Vector2 && x,
+                       Preconditioner const & M, iterative_options const & options,
+                       iterative_workspace<WorkVector> & workspace)
+    {
+        using Value = typename WorkVector::value_type;
+
+        detail::ensure_iterative_dimensions(A, b);
+
+        if(x.dim() != b.dim())
+        {
+            throw std::logic_error("Incompatible dimensions");
+        }
+
+        workspace.reserve(4, b.dim());
+
+        auto & r = workspace[0];
+        auto & z = workspace[1];
+        auto & p = workspace[2];
+        auto & Ap = workspace[3];
+
+        auto const threshold = detail::iterative_threshold(b, options);
+
+        detail::iterative_residual(A, b, x, r);
+
+        iterative_report report;
+        report.residual = linear_algebra::nrm2(r);
+
+        if(report.residual <= threshold)
+        {
+            report.converged = true;
+            return report;
+        }
+
+        M.apply(r, z);
+        linear_algebra::copy(z, p);
+
+        auto rz = linear_algebra::inner_prod(r, z);
+
+        while(report.iterations < options.max_iterations)
+        {
+            linear_algebra::apply_operator(A, p, Ap);
+
+            auto const pAp = linear_algebra::inner_prod(p, Ap);
+
+            if(!(pAp > Value(0)))
+            {
+                break;
+            }
+
+            auto const alpha = rz / pAp;
+
+            linear_algebra::axpy(alpha, p, x);
+            linear_algebra::axpy(-alpha, Ap, r);
+
+            report.residual = linear_algebra::nrm2(r);
+            ++ report.iterations;
+
+            if(report.residual <= threshold)
+            {
+                break;
+            }
+
+            M.apply(r, z);
+
+            auto const rz_new = linear_algebra::inner_prod(r, z);
+
+            // p = z + beta*p
+            linear_algebra::scal(rz_new / rz, p);
+            linear_algebra::axpy(1, z, p);
+
+            rz = rz_new;
+        }
+
+        report.converged = (report.residual <= threshold);
+
+        return report;
+    }
+
+    /** @brief Метод сопряжённых градиентов с временной рабочей памятью
+    @return <tt>conjugate_gradient(A, b, x, M, options, workspace)</tt>, где
+    @c workspace -- новый объект
+    */
+    template <class Matrix, class Vector1, class Vector2, class Preconditioner>
+    iterative_report
+    conjugate_gradient(Matrix const & A, Vector1 const & b, Vector2 && x,
+                       Preconditioner const & M,
+                       iterative_options const & options = iterative_options())
+    {
+        iterative_workspace<grabin::evaluated_type_t<std::decay_t<Vector2>>> workspace;
+
+        return linear_algebra::conjugate_gradient(A, b, x, M, options, workspace);
+    }
+
+    /** @brief Решение СЛАУ с симметричной положительно определённой матрицей
+    методом сопряжённых градиентов
+    @param A матрица или оператор
+    @param b вектор правой части
+    @return Приближённое решение СЛАУ <tt>A*x == b</tt>, полученное без
+    предобуславливания из нулевого начального приближения с параметрами по
+    умолчанию
+    @throw std::runtime_error, если заданная точность не достигнута
+    */
+    template <class Matrix, class Vector>
+    grabin::evaluated_type_t<Vector>
+    conjugate_gradient(Matrix const & A, Vector const & b)
+    {
+        auto const & b_value = grabin::detail::vector_operand(b, 0);
+
+        grabin::evaluated_type_t<Vector> x(b.dim());
+
+        auto const report = linear_algebra::conjugate_gradient(A, b_value, x, identity_preconditioner{});
+        detail::ensure_converged(report);
+
+        return x;
+    }
+
+    /** @brief Решение СЛАУ методом сопряжённых градиентов с
+    предобуславливанием
+    @tparam Preconditioner тип предобуславливателя, создаваемого по матрице
+    системы при каждом вызове, например,
+    <tt>incomplete_cholesky_preconditioner<double></tt>
+
+    Функциональный объект для использования в качестве параметра @c Solver,
+    например, для нормальных уравнений в
+    <tt>statistics::linear_regression_accumulator</tt>.
+    */
+    template <class Preconditioner = identity_preconditioner>
+    struct conjugate_gradient_solver
+    {
+        /// @brief Параметры итерационного процесса
+        iterative_options options;
+
+        /** @brief Решение системы уравнений
+        @param A симметричная положительно определённая матрица
+        @param b вектор правой части
+        @return Приближённое решение системы <tt>A*x == b</tt>
+        @throw std::runtime_error, если заданная точность не достигнута за
+        <tt>options.max_iterations</tt> итераций
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            auto const & b_value = grabin::detail::vector_operand(b, 0);
+
+            grabin::evaluated_type_t<Vector> x(b.dim());
+
+            auto const report = linear_algebra::conjugate_gradient(A, b_value, x, Preconditioner(A), this->options);
+            detail::ensure_converged(report);
+
+            return x;
+        }
+    };
+
+    /** @brief Предобуславливатель на основе неполного LU-разложения без
+    заполнения (ILU(0))
+    @tparam T тип элементов
+
+    Вычисляются нижняя треугольная матрица @c L с единичной диагональю и
+    верхняя треугольная матрица @c U, ненулевые элементы которых могут
+    располагаться только там же, где ненулевые элементы исходной матрицы,
+    такие что <tt>L*U</tt> приближает исходную матрицу. Симметричность матрицы
+    не требуется, поэтому предобуславливатель подходит для @c gmres и
+    @c bicgstab. Множители хранятся в сжатом строчном формате, поэтому для
+    разреженной матрицы объём памяти и стоимость применения пропорциональны
+    количеству её ненулевых элементов. Разложение существует, например, для
+    M-матриц и матриц с диагональным преобладанием.
+    */
+    template <class T>
+    class incomplete_lu_preconditioner
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Тип для представления размерности
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Вычисление неполного разложения
+        @param A квадратная матрица, в том числе @c csr_matrix
+        @throw std::logic_error, если матрица не является квадратной
+        @throw std::domain_error, если разложение не существует (отсутствует
+        или обратился в ноль диагональный элемент)
+        */
+        template <class Matrix>
+        explicit incomplete_lu_preconditioner(Matrix const & A)
+         : offsets_((detail::ensure_square(A), A.dim1() + 1), 0)
+         , diagonal_(A.dim1(), -1)
+        {
+            detail::for_each_entry(A, [this](size_type i, size_type j, value_type a_ij)
+            {
+                if(j == i)
+                {
+                    this->diagonal_[i] = static_cast<size_type>(this->values_.size());
+                }
+
+                this->columns_.push_back(j);
+                this->values_.push_back(a_ij);
+                this->offsets_[i + 1] = static_cast<size_type>(this->values_.size());
+            }, 0);
+
+            for(auto const & i : grabin::view::indices(this->dim()))
+            {
+                this->offsets_[i + 1] = std::max(this->offsets_[i + 1], this->offsets_[i]);
+            }
+
+            this->factorize();
+        }
+
+        // Свойства
+        /// @brief Размерность
+        size_type dim() const
+        {
+            return static_cast<size_type>(this->diagonal_.size());
+        }
+
+        /// @brief Количество хранимых элементов множителей @c L и @c U
+        size_type nnz() const
+        {
+            return static_cast<size_type>(this->values_.size());
+        }
+
+        // Применение
+        /** @brief Применение предобуславливателя
+        @param r вектор
+        @param z вектор, в который записывается результат
+        @pre <tt>r.dim() == this->dim() && z.dim() == this->dim()</tt>
+        @post <tt>z</tt> -- решение системы <tt>L*U*z == r</tt>
+
+        Память не выделяется.
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & r, Vector2 && z) const
+        {
+            assert(r.dim() == this->dim() && z.dim() == this->dim());
+
+            auto const n = this->dim();
+
+            // L*y == r
+            for(auto const & i : grabin::view::indices(n))
+            {
+                auto sum = value_type(r[i]);
+
+                for(auto k = this->offsets_[i]; k != this->diagonal_[i]; ++ k)
+                {
+                    sum -= this->values_[k] * z[this->columns_[k]];
+                }
+
+                z[i] = sum;
+            }
+
+            // U*z == y
+            for(auto i = n; i > 0; -- i)
+            {
+                auto const diag = this->diagonal_[i-1];
+                auto sum = value_type(z[i-1]);
+
+                for(auto k = diag + 1; k != this->offsets_[i]; ++ k)
+                {
+                    sum -= this->values_[k] * z[this->columns_[k]];
+                }
+
+                z[i-1] = sum / this->values_[diag];
+            }
+        }
+
+    private:
+        void factorize()
+        {
+            auto const n = this->dim();
+
+            // Позиции элементов текущей строки по номерам столбцов
+            std::vector<size_type> position(n, -1);
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                auto const diag_i = this->diagonal_[i];
+
+                if(diag_i < 0)
+                {
+                    throw std::domain_error("Incomplete LU factorization does not exist");
+                }
+
+                for(auto p = this->offsets_[i]; p != this->offsets_[i + 1]; ++ p)
+                {
+                    position[this->columns_[p]] = p;
+                }
+
+                for(auto p = this->offsets_[i]; p != diag_i; ++ p)
+                {
+                    auto const k = this->columns_[p];
+                    auto const l_ik = (this->values_[p] /= this->values_[this->diagonal_[k]]);
+
+                    for(auto q = this->diagonal_[k] + 1; q != this->offsets_[k + 1]; ++ q)
+                    {
+                        auto const pos = position[this->columns_[q]];
+
+                        if(pos >= 0)
+                        {
+                            this->values_[pos] -= l_ik * this->values_[q];
+                        }
+                    }
+                }
+
+                if(this->values_[diag_i] == value_type(0))
+                {
+                    throw std::domain_error("Incomplete LU factorization does not exist");
+                }
+
+                for(auto p = this->offsets_[i]; p != this->offsets_[i + 1]; ++ p)
+                {
+                    position[this->columns_[p]] = -1;
+                }
+            }
+        }
+
+        std::vector<size_type> offsets_;
+        std::vector<size_type> columns_;
+        std::vector<value_type> values_;
+        std::vector<size_type> diagonal_;
+    };
+
+    /** @brief Вычисление неполного LU-разложения
+    @param A квадратная матрица
+    @return <tt>incomplete_lu_preconditioner<typename Matrix::value_type>(A)</tt>
+    */
+    template <class Matrix>
+    incomplete_lu_preconditioner<typename Matrix::value_type>
+    make_incomplete_lu_preconditioner(Matrix const & A)
+    {
+        return incomplete_lu_preconditioner<typename Matrix::value_type>(A);
+    }
+
+    // Методы для несимметричных матриц
+    /** @brief Сторона, с которой применяется предобуславливатель
+
+    При предобуславливании слева решается система <tt>M^{-1}*A*x == M^{-1}*b</tt>,
+    и критерий остановки применяется к её невязке. При предобуславливании
+    справа решается система <tt>A*M^{-1}*y == b</tt>, <tt>x == M^{-1}*y</tt>,
+    поэтому контролируется невязка исходной системы.
+    */
+    enum class preconditioning_side
+    {
+        left,
+        right
+    };
+
+    /// @brief Параметры метода GMRES с перезапусками
+    struct gmres_options
+     : iterative_options
+    {
+        /// @brief Количество итераций между перезапусками (размерность
+        /// подпространства Крылова)
+        std::ptrdiff_t restart = 30;
+
+        /// @brief Сторона, с которой применяется предобуславливатель
+        preconditioning_side side = preconditioning_side::right;
+    };
+
+    /// @brief Параметры метода BiCGSTAB
+    struct bicgstab_options
+     : iterative_options
+    {
+        /// @brief Сторона, с которой применяется предобуславливатель
+        preconditioning_side side = preconditioning_side::right;
+    };
+
+    /// @cond false
+    namespace detail
+    {
+        // Оператор M^{-1}*A для предобуславливания слева
+        template <class Matrix, class Preconditioner, class Vector>
+        struct left_preconditioned_operator
+        {
+            using size_type = std::ptrdiff_t;
+
+            size_type dim1() const
+            {
+                return A.dim1();
+            }
+
+            size_type dim2() const
+            {
+                return A.dim2();
+            }
+
+            template <class Vector1, class Vector2>
+            void apply(Vector1 const & x, Vector2 && y) const
+            {
+                linear_algebra::apply_operator(A, x, temp);
+                M.apply(temp, y);
+            }
+
+            Matrix const & A;
+            Preconditioner const & M;
+            Vector & temp;
+        };
+
+        template <class Matrix, class Vector1, class Vector2>
+        void ensure_iterative_dimensions(Matrix const & A, Vector1 const & b, Vector2 const & x)
+        {
+            detail::ensure_iterative_dimensions(A, b);
+
+            if(x.dim() != b.dim())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+        }
+
+        /* Предобуславливание слева сводится к предобуславливанию справа
+        тождественным оператором для системы M^{-1}*A*x == M^{-1}*b. Два
+        последних вектора рабочей памяти отводятся под M^{-1}*b и
+        промежуточный результат умножения на A
+        */
+        template <class Method, class Matrix, class Vector1, class Vector2,
+                  class Preconditioner, class Options, class WorkVector>
+        iterative_report
+        left_preconditioned(Method method, Matrix const & A, Vector1 const & b, Vector2 & x,
+                            Preconditioner const & M, Options const & options,
+                            std::ptrdiff_t count, iterative_workspace<WorkVector> & workspace)
+        {
+            workspace.reserve(count + 2, b.dim());
+
+            auto & Mb = workspace[count];
+            auto & temp = workspace[count + 1];
+
+            M.apply(b, Mb);
+
+            using Operator = left_preconditioned_operator<Matrix, Preconditioner, WorkVector>;
+
+            return method(Operator{A, M, temp}, Mb, x, identity_preconditioner{}, options, workspace);
+        }
+
+        // GMRES(m) с предобуславливанием справа: нужны m + 3 вектора
+        template <class Matrix, class Vector1, class Vector2,
+                  class Preconditioner, class WorkVector>
+        iterative_report
+        gmres_right(Matrix const & A, Vector1 const & b, Vector2 & x,
+                    Preconditioner const & M, gmres_options const & options,
+                    iterative_workspace<WorkVector> & workspace)
+        {
+            using Value = typename WorkVector::value_type;
+            using size_type = std::ptrdiff_t;
+
+            auto const m = std::max(size_type(1), std::min(options.restart, b.dim()));
+
+            workspace.reserve(m + 3, b.dim());
+
+            auto & w = workspace[m + 1];
+            auto & z = workspace[m + 2];
+
+            // Матрица Хессенберга (по столбцам), вращения Гивенса и правая часть
+            std::vector<Value> H((m + 1) * m);
+            std::vector<Value> cs(m);
+            std::vector<Value> sn(m);
+            std::vector<Value> g(m + 1);
+
+            auto const threshold = detail::iterative_threshold(b, options);
+
+            iterative_report report;
+
+            for(;;)
+            {
+                auto & r = workspace[0];
+
+                detail::iterative_residual(A, b, x, r);
+
+                auto const beta = linear_algebra::nrm2(r);
+
+                report.residual = beta;
+
+                if(report.residual <= threshold || report.iterations >= options.max_iterations)
+                {
+                    break;
+                }
+
+                linear_algebra::scal(Value(1) / beta, r);
+                std::fill(g.begin(), g.end(), Value(0));
+                g[0] = beta;
+
+                auto k = size_type(0);
+                auto breakdown = false;
+
+                while(k < m && report.iterations < options.max_iterations)
+                {
+                    auto const h = H.begin() + k * (m + 1);
+                    auto & v_next = workspace[k + 1];
+
+                    M.apply(workspace[k], z);
+                    linear_algebra::apply_operator(A, z, v_next);
+
+                    // Модифицированный процесс Грама-Шмидта
+                    for(auto const & i : grabin::view::indices(k + 1))
+                    {
+                        h[i] = linear_algebra::inner_prod(v_next, workspace[i]);
+                        linear_algebra::axpy(-h[i], workspace[i], v_next);
+                    }
+
+                    h[k + 1] = linear_algebra::nrm2(v_next);
+
+                    breakdown = (h[k + 1] == Value(0));
+
+                    if(!breakdown)
+                    {
+                        linear_algebra::scal(Value(1) / h[k + 1], v_next);
+                    }
+
+                    for(auto const & i : grabin::view::indices(k))
+                    {
+                        auto const h_i = h[i];
+                        h[i] = cs[i] * h_i + sn[i] * h[i + 1];
+                        h[i + 1] = cs[i] * h[i + 1] - sn[i] * h_i;
+                    }
+
+                    auto const rotation = linear_algebra::rotg(h[k], h[k + 1]);
+
+                    cs[k] = rotation.c;
+                    sn[k] = rotation.s;
+                    h[k] = rotation.r;
+                    h[k + 1] = Value(0);
+
+                    g[k + 1] = -sn[k] * g[k];
+                    g[k] = cs[k] * g[k];
+
+                    ++ k;
+                    ++ report.iterations;
+
+                    using std::abs;
+                    if(breakdown || abs(g[k]) <= threshold)
+                    {
+                        break;
+                    }
+                }
+
+                // Решение треугольной системы H*y == g, y записывается в g
+                for(auto i = k; i > 0; -- i)
+                {
+                    auto sum = g[i - 1];
+
+                    for(auto j = i; j < k; ++ j)
+                    {
+                        sum -= H[j * (m + 1) + i - 1] * g[j];
+                    }
+
+                    g[i - 1] = sum / H[(i - 1) * (m + 1) + i - 1];
+                }
+
+                // x += M^{-1} * V * y
+                linear_algebra::scal(Value(0), w);
+
+                for(auto const & i : grabin::view::indices(k))
+                {
+                    linear_algebra::axpy(g[i], workspace[i], w);
+                }
+
+                M.apply(w, z);
+                linear_algebra::axpy(1, z, x);
+            }
+
+            report.converged = (report.residual <= threshold);
+
+            return report;
+        }
+
+        struct gmres_right_fn
+        {
+            template <class... Args>
+            iterative_report operator()(Args &&... args) const
+            {
+                return detail::gmres_right(std::forward<Args>(args)...);
+            }
+        };
+
+        // BiCGSTAB с предобуславливанием справа: нужно 7 векторов
+        template <class Matrix, class Vector1, class Vector2,
+                  class Preconditioner, class WorkVector>
+        iterative_report
+        bicgstab_right(Matrix const & A, Vector1 const & b, Vector2 & x,
+                       Preconditioner const & M, iterative_options const & options,
+                       iterative_workspace<WorkVector> & workspace)
+        {
+            using Value = typename WorkVector::value_type;
+
+            workspace.reserve(7, b.dim());
+
+            auto & r = workspace[0];
+            auto & r0 = workspace[1];
+            auto & p = workspace[2];
+            auto & v = workspace[3];
+            auto & p_hat = workspace[4];
+            auto & s_hat = workspace[5];
+            auto & t = workspace[6];
+
+            auto const threshold = detail::iterative_threshold(b, options);
+
+            detail::iterative_residual(A, b, x, r);
+
+            iterative_report report;
+            report.residual = linear_algebra::nrm2(r);
+
+            auto rho = Value(1);
+            auto alpha = Value(1);
+            auto omega = Value(1);
+
+            /* При вырождении процесс начинается заново с r0 == r: вырождение
+            возможно, например, если r0 ортогонален всем векторам невязок,
+            как для правой части системы ctmc_stationary
+            */
+            auto restart = true;
+
+            /* Рекуррентно пересчитываемая невязка из-за ошибок округления может
+            отличаться от истинной b - A*x, поэтому, когда она достигает
+            порога, невязка вычисляется заново, и при необходимости процесс
+            продолжается с начала
+            */
+            auto check_true_residual = [&]
+            {
+                detail::iterative_residual(A, b, x, r);
+                report.residual = linear_algebra::nrm2(r);
+                restart = true;
+            };
+
+            while(report.residual > threshold && report.iterations < options.max_iterations)
+            {
+                if(restart)
+                {
+                    linear_algebra::copy(r, r0);
+                }
+
+                auto const rho_new = linear_algebra::inner_prod(r0, r);
+
+                if(rho_new == Value(0))
+                {
+                    if(restart)
+                    {
+                        break;
+                    }
+
+                    restart = true;
+                    continue;
+                }
+
+                if(restart)
+                {
+                    linear_algebra::copy(r, p);
+                }
+                else
+                {
+                    // p = r + beta*(p - omega*v)
+                    linear_algebra::axpy(-omega, v, p);
+                    linear_algebra::scal((rho_new / rho) * (alpha / omega), p);
+                    linear_algebra::axpy(1, r, p);
+                }
+
+                M.apply(p, p_hat);
+                linear_algebra::apply_operator(A, p_hat, v);
+
+                auto const r0_v = linear_algebra::inner_prod(r0, v);
+
+                if(r0_v == Value(0))
+                {
+                    if(restart)
+                    {
+                        break;
+                    }
+
+                    restart = true;
+                    continue;
+                }
+
+                restart = false;
+                alpha = rho_new / r0_v;
+                rho = rho_new;
+
+                // s = r - alpha*v хранится в r
+                linear_algebra::axpy(-alpha, v, r);
+                linear_algebra::axpy(alpha, p_hat, x);
+
+                report.residual = linear_algebra::nrm2(r);
+                ++ report.iterations;
+
+                if(report.residual <= threshold)
+                {
+                    check_true_residual();
+                    continue;
+                }
+
+                M.apply(r, s_hat);
+                linear_algebra::apply_operator(A, s_hat, t);
+
+                auto const t_t = linear_algebra::inner_prod(t, t);
+
+                if(t_t == Value(0))
+                {
+                    break;
+                }
+
+                /* Если t почти ортогонален s, то omega близко к нулю, и процесс
+                застаивается, поэтому omega увеличивается так, чтобы косинус
+                угла между ними был не меньше 0.7 (Sleijpen, van der Vorst)
+                */
+                auto const t_r = linear_algebra::inner_prod(t, r);
+                omega = t_r / t_t;
+
+                using std::abs;
+                using std::sqrt;
+                auto const cosine = abs(t_r) / (sqrt(t_t) * report.residual);
+                auto const min_cosine = Value(0.7);
+
+                if(cosine < min_cosine && cosine != Value(0))
+                {
+                    omega *= min_cosine / cosine;
+                }
+
+                linear_algebra::axpy(omega, s_hat, x);
+                linear_algebra::axpy(-omega, t, r);
+
+                report.residual = linear_algebra::nrm2(r);
+
+                if(report.residual <= threshold)
+                {
+                    check_true_residual();
+                }
+                else if(omega == Value(0))
+                {
+                    // Следующее направление вырождается, поэтому процесс начинается заново
+                    restart = true;
+                }
+            }
+
+            report.converged = (report.residual <= threshold);
+
+            return report;
+        }
+
+        struct bicgstab_right_fn
+        {
+            template <class... Args>
+            iterative_report operator()(Args &&... args) const
+            {
+                return detail::bicgstab_right(std::forward<Args>(args)...);
+            }
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Решение СЛАУ методом обобщённых минимальных невязок с
+    перезапусками (GMRES(m))
+    @param A квадратная матрица или оператор с функцией-членом
+    <tt>apply(x, y)</tt>, вычисляющей <tt>y = A*x</tt>
+    @param b вектор правой части
+    @param x начальное приближение, после вызова -- найденное приближение
+    @param M предобуславливатель: функция-член <tt>M.apply(r, z)</tt>
+    вычисляет <tt>z</tt> -- приближение к решению <tt>A*z == r</tt>
+    @param options параметры итерационного процесса, в том числе количество
+    итераций между перезапусками и сторона предобуславливания
+    @param workspace рабочая память
+    @return Количество итераций, норма невязки (при предобуславливании слева
+    -- невязки предобусловленной системы) и признак сходимости
+    @throw std::logic_error, если размерности не согласованы
+
+    Метод не требует симметричности @c A. На каждой итерации выполняется одно
+    умножение на @c A и одно применение предобуславливателя, а приближение
+    минимизирует норму невязки на подпространстве Крылова, базис которого
+    строится процессом Арнольди. Базис хранится в рабочей памяти, поэтому
+    через каждые <tt>options.restart</tt> итераций процесс начинается заново
+    от текущего приближения. Нужно <tt>options.restart + 3</tt> вспомогательных
+    вектора (ещё два при предобуславливании слева); кроме них, выделяется
+    только память для матрицы Хессенберга размера
+    <tt>(restart + 1) x restart</tt>.
+    */
+    template <class Matrix, class Vector1, class Vector2, class Preconditioner, class WorkVector>
+    iterative_report
+    gmres(Matrix const & A, Vector1 const & b, Vector2 && x,
+          Preconditioner const & M, gmres_options const & options,
+          iterative_workspace<WorkVector> & workspace)
+    {
+        detail::ensure_iterative_dimensions(A, b, x);
+
+        if(options.side == preconditioning_side::left)
+        {
+            auto const m = std::max(std::ptrdiff_t(1), std::min(options.restart, b.dim()));
+
+            return detail::left_preconditioned(detail::gmres_right_fn{}, A, b, x, M, options,
+                                               m + 3, workspace);
+        }
+
+        return detail::gmres_right(A, b, x, M, options, workspace);
+    }
+
+    /** @brief Метод GMRES(m) с временной рабочей памятью
+    @return <tt>gmres(A, b, x, M, options, workspace)</tt>, где @c workspace
+    -- новый объект
+    */
+    template <class Matrix, class Vector1, class Vector2, class Preconditioner>
+    iterative_report
+    gmres(Matrix const & A, Vector1 const & b, Vector2 && x, Preconditioner const & M,
+          gmres_options const & options = gmres_options())
+    {
+        iterative_workspace<grabin::evaluated_type_t<std::decay_t<Vector2>>> workspace;
+
+        return linear_algebra::gmres(A, b, x, M, options, workspace);
+    }
+
+    /** @brief Решение СЛАУ методом бисопряжённых градиентов со стабилизацией
+    (BiCGSTAB)
+    @param A квадратная матрица или оператор с функцией-членом
+    <tt>apply(x, y)</tt>, вычисляющей <tt>y = A*x</tt>
+    @param b вектор правой части
+    @param x начальное приближение, после вызова -- найденное приближение
+    @param M предобуславливатель: функция-член <tt>M.apply(r, z)</tt>
+    вычисляет <tt>z</tt> -- приближение к решению <tt>A*z == r</tt>
+    @param options параметры итерационного процесса, в том числе сторона
+    предобуславливания
+    @param workspace рабочая память
+    @return Количество итераций, норма невязки (при предобуславливании слева
+    -- невязки предобусловленной системы) и признак сходимости
+    @throw std::logic_error, если размерности не согласованы
+
+    Метод не требует симметричности @c A. На каждой итерации выполняется два
+    умножения на @c A и два применения предобуславливателя, но, в отличие от
+    @c gmres, объём памяти не растёт с количеством итераций: нужно 7
+    вспомогательных векторов (ещё два при предобуславливании слева), и если
+    рабочая память уже подготовлена для этой размерности, то память не
+    выделяется. Норма невязки, в отличие от @c gmres, может убывать
+    немонотонно. При вырождении рекуррентных соотношений процесс начинается
+    заново от текущего приближения; если вырождение повторяется сразу после
+    этого, то итерации прекращаются и <tt>converged == false</tt>.
+    */
+    template <class Matrix, class Vector1, class Vector2, class Preconditioner, class WorkVector>
+    iterative_report
+    bicgstab(Matrix const & A, Vector1 const & b, Vector2 && x,
+             Preconditioner const & M, bicgstab_options const & options,
+             iterative_workspace<WorkVector> & workspace)
+    {
+        detail::ensure_iterative_dimensions(A, b, x);
+
+        if(options.side == preconditioning_side::left)
+        {
+            return detail::left_preconditioned(detail::bicgstab_right_fn{}, A, b, x, M, options,
+                                               7, workspace);
+        }
+
+        return detail::bicgstab_right(A, b, x, M, options, workspace);
+    }
+
+    /** @brief Метод BiCGSTAB с временной рабочей памятью
+    @return <tt>bicgstab(A, b, x, M, options, workspace)</tt>, где
+    @c workspace -- новый объект
+    */
+    template <class Matrix, class Vector1, class Vector2, class Preconditioner>
+    iterative_report
+    bicgstab(Matrix const & A, Vector1 const & b, Vector2 && x, Preconditioner const & M,
+             bicgstab_options const & options = bicgstab_options())
+    {
+        iterative_workspace<grabin::evaluated_type_t<std::decay_t<Vector2>>> workspace;
+
+        return linear_algebra::bicgstab(A, b, x, M, options, workspace);
+    }
+
+    /** @brief Решение СЛАУ методом GMRES(m) с предобуславливанием
+    @tparam Preconditioner тип предобуславливателя, создаваемого по матрице
+    системы при каждом вызове, например,
+    <tt>incomplete_lu_preconditioner<double></tt>
+
+    Функциональный объект для использования в качестве параметра @c Solver,
+    например, в <tt>stochastic::ctmc_stationary</tt> для разреженных матриц.
+    */
+    template <class Preconditioner = identity_preconditioner>
+    struct gmres_solver
+    {
+        /// @brief Параметры итерационного процесса
+        gmres_options options;
+
+        /** @brief Решение системы уравнений
+        @param A квадратная матрица
+        @param b вектор правой части
+        @return Приближённое решение системы <tt>A*x == b</tt>
+        @throw std::runtime_error, если заданная точность не достигнута за
+        <tt>options.max_iterations</tt> итераций
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            auto const & b_value = grabin::detail::vector_operand(b, 0);
+
+            grabin::evaluated_type_t<Vector> x(b.dim());
+
+            auto const report = linear_algebra::gmres(A, b_value, x, Preconditioner(A), this->options);
+            detail::ensure_converged(report);
+
+            return x;
+        }
+    };
+
+    /** @brief Решение СЛАУ методом BiCGSTAB с предобуславливанием
+    @tparam Preconditioner тип предобуславливателя, создаваемого по матрице
+    системы при каждом вызове, например,
+    <tt>incomplete_lu_preconditioner<double></tt>
+
+    Функциональный объект для использования в качестве параметра @c Solver,
+    например, в <tt>stochastic::ctmc_stationary</tt> для разреженных матриц.
+    */
+    template <class Preconditioner = identity_preconditioner>
+    struct bicgstab_solver
+    {
+        /// @brief Параметры итерационного процесса
+        bicgstab_options options;
+
+        /** @brief Решение системы уравнений
+        @param A квадратная матрица
+        @param b вектор правой части
+        @return Приближённое решение системы <tt>A*x == b</tt>
+        @throw std::runtime_error, если заданная точность не достигнута за
+        <tt>options.max_iterations</tt> итераций
+        */
+        template <class Matrix, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(Matrix const & A, Vector const & b) const
+        {
+            auto const & b_value = grabin::detail::vector_operand(b, 0);
+
+            grabin::evaluated_type_t<Vector> x(b.dim());
+
+            auto const report = linear_algebra::bicgstab(A, b_value, x, Preconditioner(A), this->options);
+            detail::ensure_converged(report);
+
+            return x;
+        }
+    };
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_NUMERIC_ITERATIVE_SOLVER_HPP_INCLUDED
@@ -0,0 +1,514 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_NUMERIC_LINEAR_OPERATOR_HPP_INCLUDED
+#define Z_GRABIN_NUMERIC_LINEAR_OPERATOR_HPP_INCLUDED
+
+/** @file grabin/numeric/linear_operator.hpp
+ @brief Линейные операторы, заданные без хранения матрицы
+
+ Линейным оператором называется любой объект @c A, для которого определены
+ функции-члены <tt>A.dim1()</tt> и <tt>A.dim2()</tt>, возвращающие
+ размерности, и <tt>A.apply(x, y)</tt>, записывающая в вектор @c y
+ размерности <tt>A.dim1()</tt> произведение оператора на вектор @c x
+ размерности <tt>A.dim2()</tt>. Итерационные методы из
+ grabin/numeric/iterative_solver.hpp принимают как операторы, так и матрицы
+ (в том числе разреженные): умножение выполняет функция @c apply_operator.
+ Адаптеры из этого файла позволяют строить операторы из функций, а также
+ композиции, суммы и кронекеровы произведения операторов, не формируя
+ соответствующие матрицы явно.
+*/
+
+#include <grabin/execution.hpp>
+#include <grabin/numeric/blas.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v1
+{
+namespace linear_algebra
+{
+    /// @cond false
+    namespace detail
+    {
+        /* Разреженные матрицы умножаются функцией multiply с вектором
+        результата, плотные матрицы с непрерывным хранением обрабатываются
+        gemv, для остальных используется умножение, возвращающее новый вектор
+        */
+        template <class Matrix, class Vector1, class Vector2>
+        auto apply_operator_sparse(Matrix const & A, Vector1 const & x, Vector2 & y, int)
+        -> decltype(multiply(execution::seq, A, x, y))
+        {
+            return multiply(execution::seq, A, x, y);
+        }
+
+        template <class Matrix, class Vector1, class Vector2>
+        auto apply_operator_dense(Matrix const & A, Vector1 const & x, Vector2 & y, int)
+        -> decltype(A.data(), void())
+        {
+            linear_algebra::gemv(1, A, x, 0, y);
+        }
+
+        template <class Matrix, class Vector1, class Vector2>
+        void apply_operator_dense(Matrix const & A, Vector1 const & x, Vector2 & y, long)
+        {
+            y = A * x;
+        }
+
+        template <class Matrix, class Vector1, class Vector2>
+        void apply_operator_sparse(Matrix const & A, Vector1 const & x, Vector2 & y, long)
+        {
+            detail::apply_operator_dense(A, x, y, 0);
+        }
+
+        template <class Operator, class Vector1, class Vector2>
+        auto apply_operator(Operator const & A, Vector1 const & x, Vector2 & y, int)
+        -> decltype(A.apply(x, y))
+        {
+            return A.apply(x, y);
+        }
+
+        template <class Matrix, class Vector1, class Vector2>
+        void apply_operator(Matrix const & A, Vector1 const & x, Vector2 & y, long)
+        {
+            detail::apply_operator_sparse(A, x, y, 0);
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Применение линейного оператора или матрицы к вектору
+    @param A линейный оператор, плотная или разреженная матрица
+    @param x вектор размерности <tt>A.dim2()</tt>
+    @param y вектор размерности <tt>A.dim1()</tt>
+    @post <tt>y == A*x</tt>
+
+    Если у @c A есть функция-член @c apply, то вызывается она. Разреженная
+    матрица умножается на вектор без создания временных векторов, плотная
+    матрица с непрерывным хранением элементов -- с помощью @c gemv.
+    */
+    template <class Operator, class Vector1, class Vector2>
+    void apply_operator(Operator const & A, Vector1 const & x, Vector2 && y)
+    {
+        detail::apply_operator(A, x, y, 0);
+    }
+
+    /** @brief Линейный оператор, заданный функцией
+    @tparam Function тип функционального объекта, вызов <tt>f(x, y)</tt>
+    которого записывает в @c y результат применения оператора к @c x
+    */
+    template <class Function>
+    class function_operator
+    {
+    public:
+        // Типы
+        /// @brief Тип для представления размерностей
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param rows размерность результата
+        @param cols размерность аргумента
+        @param f функциональный объект, вычисляющий произведение
+        */
+        function_operator(size_type rows, size_type cols, Function f)
+         : rows_(rows)
+         , cols_(cols)
+         , f_(std::move(f))
+        {}
+
+        // Размерности
+        /// @brief Размерность результата
+        size_type dim1() const
+        {
+            return this->rows_;
+        }
+
+        /// @brief Размерность аргумента
+        size_type dim2() const
+        {
+            return this->cols_;
+        }
+
+        // Применение
+        /** @brief Применение оператора
+        @param x вектор размерности <tt>this->dim2()</tt>
+        @param y вектор размерности <tt>this->dim1()</tt>
+        @post @c y содержит результат вызова <tt>f(x, y)</tt>
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & x, Vector2 && y) const
+        {
+            this->f_(x, y);
+        }
+
+    private:
+        size_type rows_;
+        size_type cols_;
+        Function f_;
+    };
+
+    /** @brief Создание линейного оператора, заданного функцией
+    @param rows размерность результата
+    @param cols размерность аргумента
+    @param f функциональный объект (например, лямбда-выражение), вызов
+    <tt>f(x, y)</tt> которого записывает в @c y результат применения
+    оператора к @c x
+    @return <tt>function_operator<Function>(rows, cols, std::move(f))</tt>
+    */
+    template <class Function>
+    function_operator<Function>
+    make_linear_operator(std::ptrdiff_t rows, std::ptrdiff_t cols, Function f)
+    {
+        return function_operator<Function>(rows, cols, std::move(f));
+    }
+
+    /// @brief Тождественный оператор
+    class identity_operator
+    {
+    public:
+        // Типы
+        /// @brief Тип для представления размерностей
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param n размерность
+        */
+        explicit identity_operator(size_type n)
+         : dim_(n)
+        {}
+
+        // Размерности
+        /// @brief Размерность результата
+        size_type dim1() const
+        {
+            return this->dim_;
+        }
+
+        /// @brief Размерность аргумента
+        size_type dim2() const
+        {
+            return this->dim_;
+        }
+
+        // Применение
+        /** @brief Применение оператора
+        @param x вектор
+        @param y вектор, в который записывается результат
+        @post <tt>y == x</tt>
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & x, Vector2 && y) const
+        {
+            linear_algebra::copy(x, y);
+        }
+
+    private:
+        size_type dim_;
+    };
+
+    /** @brief Композиция линейных операторов
+    @tparam Operator1, Operator2 типы операторов или матриц
+    @tparam Vector тип вспомогательного вектора
+
+    Применение к вектору @c x даёт <tt>A*(B*x)</tt>. Промежуточный результат
+    хранится в объекте, поэтому память при применении не выделяется, но один
+    объект не должен использоваться одновременно в нескольких потоках.
+    */
+    template <class Operator1, class Operator2, class Vector = grabin::math_vector<double>>
+    class composed_operator
+    {
+    public:
+        // Типы
+        /// @brief Тип для представления размерностей
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param A, B операторы
+        @throw std::logic_error, если <tt>A.dim2() != B.dim1()</tt>
+        */
+        composed_operator(Operator1 A, Operator2 B)
+         : A_(std::move(A))
+         , B_(std::move(B))
+         , temp_(this->B_.dim1())
+        {
+            if(this->A_.dim2() != this->B_.dim1())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+        }
+
+        // Размерности
+        /// @brief Размерность результата
+        size_type dim1() const
+        {
+            return this->A_.dim1();
+        }
+
+        /// @brief Размерность аргумента
+        size_type dim2() const
+        {
+            return this->B_.dim2();
+        }
+
+        // Применение
+        /** @brief Применение оператора
+        @param x вектор размерности <tt>this->dim2()</tt>
+        @param y вектор размерности <tt>this->dim1()</tt>
+        @post <tt>y == A*(B*x)</tt>
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & x, Vector2 && y) const
+        {
+            linear_algebra::apply_operator(this->B_, x, this->temp_);
+            linear_algebra::apply_operator(this->A_, this->temp_, y);
+        }
+
+    private:
+        Operator1 A_;
+        Operator2 B_;
+        mutable Vector temp_;
+    };
+
+    /** @brief Создание композиции линейных операторов
+    @param A, B операторы или матрицы
+    @return Оператор, применение которого к вектору @c x даёт <tt>A*(B*x)</tt>
+    @throw std::logic_error, если <tt>A.dim2() != B.dim1()</tt>
+    */
+    template <class Vector = grabin::math_vector<double>, class Operator1, class Operator2>
+    composed_operator<Operator1, Operator2, Vector>
+    make_composed_operator(Operator1 A, Operator2 B)
+    {
+        return composed_operator<Operator1, Operator2, Vector>(std::move(A), std::move(B));
+    }
+
+    /** @brief Сумма линейных операторов
+    @tparam Operator1, Operator2 типы операторов или матриц
+    @tparam Vector тип вспомогательного вектора
+
+    Применение к вектору @c x даёт <tt>A*x + B*x</tt>. Промежуточный результат
+    хранится в объекте, поэтому память при применении не выделяется, но один
+    объект не должен использоваться одновременно в нескольких потоках.
+    */
+    template <class Operator1, class Operator2, class Vector = grabin::math_vector<double>>
+    class sum_operator
+    {
+    public:
+        // Типы
+        /// @brief Тип для представления размерностей
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param A, B операторы
+        @throw std::logic_error, если размерности операторов не совпадают
+        */
+        sum_operator(Operator1 A, Operator2 B)
+         : A_(std::move(A))
+         , B_(std::move(B))
+         , temp_(this->A_.dim1())
+        {
+            if(this->A_.dim1() != this->B_.dim1() || this->A_.dim2() != this->B_.dim2())
+            {
+                throw std::logic_error("Incompatible dimensions");
+            }
+        }
+
+        // Размерности
+        /// @brief Размерность результата
+        size_type dim1() const
+        {
+            return this->A_.dim1();
+        }
+
+        /// @brief Размерность аргумента
+        size_type dim2() const
+        {
+            return this->A_.dim2();
+        }
+
+        // Применение
+        /** @brief Применение оператора
+        @param x вектор размерности <tt>this->dim2()</tt>
+        @param y вектор размерности <tt>this->dim1()</tt>
+        @post <tt>y == A*x + B*x</tt>
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & x, Vector2 && y) const
+        {
+            linear_algebra::apply_operator(this->A_, x, y);
+            linear_algebra::apply_operator(this->B_, x, this->temp_);
+            linear_algebra::axpy(1, this->temp_, y);
+        }
+
+    private:
+        Operator1 A_;
+        Operator2 B_;
+        mutable Vector temp_;
+    };
+
+    /** @brief Создание суммы линейных операторов
+    @param A, B операторы или матрицы одинаковых размерностей
+    @return Оператор, применение которого к вектору @c x даёт <tt>A*x + B*x</tt>
+    @throw std::logic_error, если размерности операторов не совпадают
+    */
+    template <class Vector = grabin::math_vector<double>, class Operator1, class Operator2>
+    sum_operator<Operator1, Operator2, Vector>
+    make_sum_operator(Operator1 A, Operator2 B)
+    {
+        return sum_operator<Operator1, Operator2, Vector>(std::move(A), std::move(B));
+    }
+
+    /** @brief Кронекерово произведение линейных операторов
+    @tparam Operator1, Operator2 типы операторов или матриц
+    @tparam Vector тип вспомогательных векторов
+
+    Если @c A имеет размеры <tt>m1 x n1</tt>, а @c B -- <tt>m2 x n2</tt>, то
+    оператор имеет размеры <tt>(m1*m2) x (n1*n2)</tt>, а элемент его матрицы
+    в строке <tt>p*m2 + q</tt> и столбце <tt>i*n2 + j</tt> равен
+    <tt>A(p, i) * B(q, j)</tt>. Если рассматривать аргумент как матрицу @c X
+    размера <tt>n1 x n2</tt>, хранящуюся по строкам, то результат -- это
+    матрица <tt>A*X*B^T</tt>: применение сводится к @c n1 умножениям на @c B
+    и @c m2 умножениям на @c A, поэтому ни матрица оператора, ни даже
+    матрицы сомножителей не формируются. Промежуточные результаты хранятся в
+    объекте, поэтому память при применении не выделяется, но один объект не
+    должен использоваться одновременно в нескольких потоках.
+    */
+    template <class Operator1, class Operator2, class Vector = grabin::math_vector<double>>
+    class kronecker_operator
+    {
+    public:
+        // Типы
+        /// @brief Тип для представления размерностей
+        using size_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param A, B операторы
+        */
+        kronecker_operator(Operator1 A, Operator2 B)
+         : A_(std::move(A))
+         , B_(std::move(B))
+         , temp_(this->A_.dim2() * this->B_.dim1())
+         , x_row_(this->B_.dim2())
+         , y_row_(this->B_.dim1())
+         , x_col_(this->A_.dim2())
+         , y_col_(this->A_.dim1())
+        {}
+
+        // Размерности
+        /// @brief Размерность результата
+        size_type dim1() const
+        {
+            return this->A_.dim1() * this->B_.dim1();
+        }
+
+        /// @brief Размерность аргумента
+        size_type dim2() const
+        {
+            return this->A_.dim2() * this->B_.dim2();
+        }
+
+        // Применение
+        /** @brief Применение оператора
+        @param x вектор размерности <tt>this->dim2()</tt>
+        @param y вектор размерности <tt>this->dim1()</tt>
+        @post @c y -- произведение кронекерова произведения @c A и @c B на @c x
+        */
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & x, Vector2 && y) const
+        {
+            auto const m1 = this->A_.dim1();
+            auto const n1 = this->A_.dim2();
+            auto const m2 = this->B_.dim1();
+            auto const n2 = this->B_.dim2();
+
+            // T = X*B^T, размер n1 x m2
+            for(auto const & i : grabin::view::indices(n1))
+            {
+                for(auto const & j : grabin::view::indices(n2))
+                {
+                    this->x_row_[j] = x[i*n2 + j];
+                }
+
+                linear_algebra::apply_operator(this->B_, this->x_row_, this->y_row_);
+
+                for(auto const & q : grabin::view::indices(m2))
+                {
+                    this->temp_[i*m2 + q] = this->y_row_[q];
+                }
+            }
+
+            // Y = A*T, размер m1 x m2
+            for(auto const & q : grabin::view::indices(m2))
+            {
+                for(auto const & i : grabin::view::indices(n1))
+                {
+                    this->x_col_[i] = this->temp_[i*m2 + q];
+                }
+
+                linear_algebra::apply_operator(this->A_, this->x_col_, this->y_col_);
+
+                for(auto const & p : grabin::view::indices(m1))
+                {
+                    y[p*m2 + q] = this->y_col_[p];
+                }
+            }
+        }
+
+    private:
+        Operator1 A_;
+        Operator2 B_;
+        mutable Vector temp_;
+        mutable Vector x_row_;
+        mutable Vector y_row_;
+        mutable Vector x_col_;
+        mutable Vector y_col_;
+    };
+
+    /** @brief Создание кронекерова произведения линейных операторов
+    @param A, B операторы или матрицы
+    @return Оператор, матрица которого равна кронекерову произведению
+    матриц @c A и @c B
+
+    Например, генератор пары независимых марковских процессов с генераторами
+    @c Q1 и @c Q2 равен кронекеровой сумме
+    <tt>make_sum_operator(make_kronecker_operator(Q1, identity_operator(n2)),
+    make_kronecker_operator(identity_operator(n1), Q2))</tt>.
+    */
+    template <class Vector = grabin::math_vector<double>, class Operator1, class Operator2>
+    kronecker_operator<Operator1, Operator2, Vector>
+    make_kronecker_operator(Operator1 A, Operator2 B)
+    {
+        return kronecker_operator<Operator1, Operator2, Vector>(std::move(A), std::move(B));
+    }
+}
+// namespace linear_algebra
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_NUMERIC_LINEAR_OPERATOR_HPP_INCLUDED
@@ -22,6 +22,7 @@ Grabin -- это свободной программное обеспечени
  @brief Функциональность, связанная с линейной регрессией
 */
 
+#include <grabin/math/evaluated_type.hpp>
 #include <grabin/statistics/mean.hpp>
 #include <grabin/statistics/variance.hpp>
 #include <grabin/utility/use_default.hpp>
@@ -86,7 +87,8 @@ namespace statistics
         using slope_type = X;
 
         /// @brief Тип ковариации между выходной и входной переменными
-        using covariance_type = decltype(std::declval<intercept_type>() * std::declval<X>());
+        using covariance_type
+            = grabin::evaluated_type_t<decltype(std::declval<intercept_type>() * std::declval<X>())>;
 
         // Создание, копирование, уничтожение
         /// @brief Конструктор без аргументов
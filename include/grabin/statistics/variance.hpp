@@ -29,6 +29,8 @@ Grabin -- это свободной программное обеспечени
 #include <cstdint>
 
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 namespace grabin
 {
@@ -36,18 +38,88 @@ inline namespace v1
 {
 namespace statistics
 {
+    /// @cond false
+    namespace detail
+    {
+        /* Есть ли у Product функция-член accumulate(s2, alpha, u, v), которой
+        variance_accumulator передаёт множитель типа Variance::value_type
+        */
+        template <class T, class Count, class Product>
+        struct has_rank_one_accumulate
+        {
+        private:
+            using Mean = typename grabin::statistics::mean_accumulator<T, Count>::mean_type;
+            using Variance = decltype(std::declval<Product>()(std::declval<Mean>(), std::declval<Mean>()));
+
+            template <class P, class V = Variance>
+            static auto test(int)
+            -> decltype(std::declval<P const &>().accumulate(std::declval<V &>(),
+                                                             std::declval<typename V::value_type>(),
+                                                             std::declval<Mean const &>(),
+                                                             std::declval<Mean const &>()),
+                        std::true_type{});
+
+            template <class P>
+            static std::false_type test(long);
+
+        public:
+            static constexpr bool value = decltype(test<Product>(0))::value;
+        };
+
+        /* Разность нового значения и предыдущего среднего хранится, только
+        если она используется для обновления ранга один
+        */
+        template <class Mean, bool Stored>
+        struct variance_delta_storage
+        {
+            variance_delta_storage() = default;
+
+            explicit variance_delta_storage(Mean const &)
+            {}
+        };
+
+        template <class Mean>
+        struct variance_delta_storage<Mean, true>
+        {
+            variance_delta_storage() = default;
+
+            explicit variance_delta_storage(Mean const & zero)
+             : delta_(zero)
+            {}
+
+            Mean delta_ = Mean(0);
+        };
+    }
+    // namespace detail
+    /// @endcond
+
     /** @brief Класс-накопитель для вычисления дисперсии, а также среднеквадратического отклонения
     и среднего.
     @tparam T тип значений, для которых вычисляется среднее
     @tparam Count тип количества элементов
     @tparam Product Тип функционального объекта, задающий операцию умножения,
     по умолчанию используется оператор *.
+
+    Если у @c Product есть функция-член
+    <tt>accumulate(s2, alpha, u, v)</tt>, прибавляющая <tt>alpha * prod(u, v)</tt>
+    к @c s2 "на месте" (например, у @c linear_algebra::outer_product и
+    @c linear_algebra::symmetric_outer_product), то она используется вместо
+    вычисления произведения. Так как <tt>value - mean_new</tt> равно
+    <tt>(value - mean_old) * (n-1)/n</tt>, обработка нового значения сводится
+    к одному обновлению ранга один с <tt>u == v == value - mean_old</tt>.
+    Разность хранится в накопителе (только при наличии такой функции-члена),
+    поэтому при обработке векторов память не выделяется, а ковариационная
+    матрица обновляется за один проход.
     */
     template <class T, class Count = std::ptrdiff_t,
               class Product = std::multiplies<>>
     class variance_accumulator
+     : private detail::variance_delta_storage<typename grabin::statistics::mean_accumulator<T, Count>::mean_type,
+                                              detail::has_rank_one_accumulate<T, Count, Product>::value>
     {
         using Mean = grabin::statistics::mean_accumulator<T, Count>;
+        using Rank_one_update = std::integral_constant<bool, detail::has_rank_one_accumulate<T, Count, Product>::value>;
+        using Delta_storage = detail::variance_delta_storage<typename Mean::mean_type, Rank_one_update::value>;
 
     public:
         // Типы
@@ -79,7 +151,8 @@ namespace statistics
         функциональный объект, используемый для вычисления произведения
         */
         variance_accumulator(mean_type const & zero)
-         : prod_()
+         : Delta_storage(zero)
+         , prod_()
          , mean_(zero)
          , s2_(prod_(zero, zero))
         {}
@@ -132,17 +205,35 @@ namespace statistics
         @return <tt> *this </tt>
         */
         variance_accumulator & operator()(value_type const & value)
+        {
+            this->update(value, Rank_one_update{});
+
+            return *this;
+        }
+
+    private:
+        void update(value_type const & value, std::true_type)
+        {
+            this->delta_ = value;
+            this->delta_ -= this->mean();
+
+            this->mean_(value);
+
+            using Scalar = typename variance_type::value_type;
+            auto const n = Scalar(this->count());
+
+            this->prod_.accumulate(this->s2_, (n - 1) / n, this->delta_, this->delta_);
+        }
+
+        void update(value_type const & value, std::false_type)
         {
             auto const mean_old = this->mean();
 
             this->mean_(value);
 
             s2_ += this->prod_(value - this->mean(), value - mean_old);
-
-            return *this;
         }
 
-    private:
         Product prod_;
         Mean mean_;
         variance_type s2_ = variance_type(0);
@@ -22,8 +22,14 @@ Grabin -- это свободной программное обеспечени
  @brief Функционал, связанный с теорией вероятностей и теорией случайных процессов
 */
 
+#include <grabin/math/band_matrix.hpp>
+#include <grabin/math/sparse_matrix.hpp>
 #include <grabin/numeric/linear_algebra.hpp>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace grabin
 {
 inline namespace v1
@@ -70,6 +76,342 @@ namespace stochastic
 
         return solver(A, b);
     }
+
+    /** @brief Определение стационарных вероятностей марковского процесса с
+    дискретными состояниями и непрерывным временем, заданного разреженной
+    матрицей интенсивностей переходов
+    @param lambda разреженная матрица интенсивности переходов
+    @param solver метод решения систем линейных алгебраических уравнений,
+    принимающий разреженную матрицу @c csr_matrix<T, Check>
+    @pre <tt>lambda.dim1() == lambda.dim2()</tt>
+    @return Вектор, компоненты которого равны вероятностям состояний в
+    стационарном режиме
+
+    Система уравнений та же, что и для плотной матрицы, но строится сразу в
+    разреженном виде, поэтому объём памяти пропорционален количеству
+    переходов, а не квадрату количества состояний.
+
+    Матрица этой системы несимметрична и не является знакоопределённой,
+    поэтому метод минимальных невязок и метод сопряжённых градиентов для неё,
+    вообще говоря, не сходятся. По умолчанию используется метод GMRES(m) с
+    предобуславливателем ILU(0). Метод BiCGSTAB тоже применим, но только с
+    предобуславливателем (например,
+    <tt>linear_algebra::bicgstab_solver<linear_algebra::incomplete_lu_preconditioner<T>></tt>):
+    без него для моделей с сотнями состояний итераций по умолчанию не хватает.
+    Если заданная точность не достигнута, то решатели GMRES(m) и BiCGSTAB
+    выбрасывают исключение; в этом случае следует передать решатель с
+    увеличенным <tt>options.max_iterations</tt>.
+    @throw std::runtime_error, если итерационный метод @c solver не достиг
+    заданной точности и сообщает об этом исключением
+    */
+    template <class T, class Check,
+              class Solver = linear_algebra::gmres_solver<linear_algebra::incomplete_lu_preconditioner<T>>>
+    grabin::math_vector<T>
+    ctmc_stationary(grabin::csr_matrix<T, Check> const & lambda, Solver const & solver = Solver())
+    {
+        auto const n = lambda.dim1();
+        assert(lambda.dim2() == n);
+
+        grabin::csr_matrix_builder<T, Check> builder(n, n);
+        builder.reserve(2 * lambda.nnz() + n);
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            for(auto k = lambda.row_offsets()[i]; k != lambda.row_offsets()[i + 1]; ++ k)
+            {
+                auto const j = lambda.column_indices()[k];
+
+                if(j == i)
+                {
+                    continue;
+                }
+
+                if(i != n - 1)
+                {
+                    builder.add(i, i, -lambda.values()[k]);
+                }
+
+                if(j != n - 1)
+                {
+                    builder.add(j, i, lambda.values()[k]);
+                }
+            }
+        }
+
+        for(auto const & j : grabin::view::indices(n))
+        {
+            builder.add(n - 1, j, T(1));
+        }
+
+        grabin::math_vector<T> b(n, 0);
+        b[n-1] = 1;
+
+        return solver(builder.build(), b);
+    }
+
+    /// @cond false
+    namespace detail
+    {
+        /* Система уравнений для стационарных вероятностей: уравнения
+        равновесия, последнее из которых заменено условием нормировки
+        */
+        template <class Operator>
+        struct ctmc_balance_operator
+        {
+            using size_type = std::ptrdiff_t;
+
+            size_type dim1() const
+            {
+                return generator_transposed.dim1();
+            }
+
+            size_type dim2() const
+            {
+                return generator_transposed.dim2();
+            }
+
+            template <class Vector1, class Vector2>
+            void apply(Vector1 const & x, Vector2 && y) const
+            {
+                linear_algebra::apply_operator(generator_transposed, x, y);
+
+                auto const n = this->dim1();
+
+                auto sum = 0 * x[0];
+                for(auto const & i : grabin::view::indices(n))
+                {
+                    sum += x[i];
+                }
+
+                y[n-1] = sum;
+            }
+
+            Operator const & generator_transposed;
+        };
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Определение стационарных вероятностей марковского процесса с
+    дискретными состояниями и непрерывным временем, генератор которого задан
+    линейным оператором
+    @tparam T тип элементов результата
+    @param generator_transposed линейный оператор (см.
+    grabin/numeric/linear_operator.hpp) или матрица, умножающий вектор на
+    транспонированный генератор <tt>Q^T</tt>: вне диагонали @c Q стоят
+    интенсивности переходов, а сумма элементов каждой строки равна нулю
+    @param solver итерационный метод решения систем линейных алгебраических
+    уравнений, принимающий линейный оператор
+    @pre <tt>generator_transposed.dim1() == generator_transposed.dim2()</tt>
+    @return Вектор, компоненты которого равны вероятностям состояний в
+    стационарном режиме
+
+    Система уравнений та же, что и в остальных вариантах, но её матрица не
+    формируется: каждое умножение на неё сводится к одному применению
+    оператора и суммированию элементов вектора. Это позволяет решать задачи
+    для процессов с кронекеровой структурой, матрицы которых не помещаются в
+    память. Предобуславливатели, которым нужны элементы матрицы, здесь
+    неприменимы, поэтому по умолчанию используется GMRES(m) без
+    предобуславливания; для большой модели следует передать решатель с
+    увеличенным <tt>options.max_iterations</tt>.
+    @throw std::runtime_error, если итерационный метод @c solver не достиг
+    заданной точности и сообщает об этом исключением
+    */
+    template <class T = double, class Operator,
+              class Solver = linear_algebra::gmres_solver<>>
+    grabin::math_vector<T>
+    ctmc_stationary_matrix_free(Operator const & generator_transposed,
+                                Solver const & solver = Solver())
+    {
+        auto const n = generator_transposed.dim1();
+        assert(generator_transposed.dim2() == n);
+
+        if(n == 0)
+        {
+            return grabin::math_vector<T>(0);
+        }
+
+        grabin::math_vector<T> b(n, 0);
+        b[n-1] = 1;
+
+        return solver(detail::ctmc_balance_operator<Operator>{generator_transposed}, b);
+    }
+
+    /** @brief Определение стационарных вероятностей марковского процесса с
+    дискретными состояниями и непрерывным временем, заданного ленточной
+    матрицей интенсивностей переходов (например, процесса гибели и
+    размножения)
+    @param lambda ленточная матрица интенсивности переходов
+    @pre <tt>lambda.dim1() == lambda.dim2()</tt>
+    @pre Процесс неприводим, то есть из любого состояния достижимо любое
+    другое
+    @return Вектор, компоненты которого равны вероятностям состояний в
+    стационарном режиме
+
+    Используется алгоритм Грассмана-Таксара-Хеймана (GTH): состояния
+    исключаются, начиная с последнего, а интенсивности выхода из состояний
+    вычисляются как суммы интенсивностей переходов, а не как диагональные
+    элементы. Вычитания не выполняются, поэтому результат вычисляется с
+    высокой относительной точностью даже тогда, когда вероятности состояний
+    различаются на много порядков. Исключение состояний не выводит за
+    пределы ленты, так что для процесса с @c n состояниями требуется
+    <tt>O(n * kl * ku)</tt> операций и <tt>O(n * (kl + ku))</tt> памяти, где
+    @c kl и @c ku -- ширины лент @c lambda.
+
+    Ненормированные вероятности отсчитываются от вероятности начального
+    состояния, поэтому если она на сотни порядков меньше вероятностей
+    остальных состояний, то возможно переполнение.
+    */
+    template <class T, class Check>
+    grabin::math_vector<T>
+    ctmc_stationary(grabin::band_matrix<T, Check> const & lambda)
+    {
+        auto const n = lambda.dim1();
+        assert(lambda.dim2() == n);
+
+        if(n == 0)
+        {
+            return grabin::math_vector<T>(0);
+        }
+
+        using size_type = typename grabin::band_matrix<T, Check>::size_type;
+
+        auto const kl = lambda.lower_bandwidth();
+        auto const ku = lambda.upper_bandwidth();
+
+        // Интенсивности переходов между ещё не исключёнными состояниями
+        auto Q = lambda;
+
+        // Интенсивности выхода из состояния k в состояния с меньшими номерами
+        std::vector<T> out(n, T(0));
+
+        for(auto k = n - 1; k > 0; -- k)
+        {
+            auto const first_j = std::max(k - kl, size_type(0));
+            auto const first_i = std::max(k - ku, size_type(0));
+
+            for(auto j = first_j; j < k; ++ j)
+            {
+                out[k] += Q(k, j);
+            }
+
+            assert(out[k] > 0);
+
+            for(auto i = first_i; i < k; ++ i)
+            {
+                auto const a = Q(i, k) / out[k];
+
+                if(a == T(0))
+                {
+                    continue;
+                }
+
+                for(auto j = first_j; j < k; ++ j)
+                {
+                    if(j != i)
+                    {
+                        Q(i, j) += a * Q(k, j);
+                    }
+                }
+            }
+        }
+
+        grabin::math_vector<T> p(n, grabin::no_init);
+        p[0] = T(1);
+
+        for(auto k = size_type(1); k < n; ++ k)
+        {
+            auto sum = T(0);
+
+            for(auto i = std::max(k - ku, size_type(0)); i < k; ++ i)
+            {
+                sum += p[i] * Q(i, k);
+            }
+
+            p[k] = sum / out[k];
+        }
+
+        p /= std::accumulate(p.begin(), p.end(), T(0));
+
+        return p;
+    }
+
+    /** @brief Определение стационарных вероятностей марковского процесса с
+    дискретными состояниями и непрерывным временем, заданного ленточной
+    матрицей интенсивностей переходов, путём решения системы линейных
+    алгебраических уравнений
+    @param lambda ленточная матрица интенсивности переходов
+    @param solver метод решения систем линейных алгебраических уравнений с
+    ленточной матрицей, например, @c linear_algebra::band_LU_solver или, для
+    процессов гибели и размножения, @c linear_algebra::tridiagonal_solver
+    @pre <tt>lambda.dim1() == lambda.dim2()</tt>
+    @return Вектор, компоненты которого равны вероятностям состояний в
+    стационарном режиме
+
+    Уравнение баланса для начального состояния заменяется условием
+    <tt>p[0] == 1</tt>, а не условием нормировки, поэтому матрица системы
+    остаётся ленточной (ширины лент @c lambda меняются местами). Решение
+    нормируется после решения системы.
+
+    Методы исключения без выбора главного элемента устойчивы для этой системы,
+    если вероятности состояний в основном убывают с ростом номера состояния
+    (например, для систем массового обслуживания с загрузкой меньше единицы).
+    В противном случае следует пронумеровать состояния в обратном порядке или
+    использовать перегрузку без параметра @c solver.
+    */
+    template <class T, class Check, class Solver>
+    grabin::math_vector<T>
+    ctmc_stationary(grabin::band_matrix<T, Check> const & lambda, Solver const & solver)
+    {
+        auto const n = lambda.dim1();
+        assert(lambda.dim2() == n);
+
+        if(n == 0)
+        {
+            return grabin::math_vector<T>(0);
+        }
+
+        using size_type = typename grabin::band_matrix<T, Check>::size_type;
+
+        grabin::band_matrix<T, Check> A(n, lambda.upper_bandwidth(), lambda.lower_bandwidth());
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            auto const first = std::max(i - lambda.lower_bandwidth(), size_type(0));
+            auto const last = std::min(i + lambda.upper_bandwidth() + 1, n);
+
+            for(auto j = first; j < last; ++ j)
+            {
+                if(j == i)
+                {
+                    continue;
+                }
+
+                auto const rate = lambda(i, j);
+
+                if(i != 0)
+                {
+                    A(i, i) -= rate;
+                }
+
+                if(j != 0)
+                {
+                    A(j, i) = rate;
+                }
+            }
+        }
+
+        A(0, 0) = 1;
+
+        grabin::math_vector<T> b(n, 0);
+        b[0] = 1;
+
+        grabin::math_vector<T> p = solver(A, b);
+
+        p /= std::accumulate(p.begin(), p.end(), T(0));
+
+        return p;
+    }
 }
 // namespace stochastic
 }
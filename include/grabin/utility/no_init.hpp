@@ -0,0 +1,88 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_GRABIN_UTILITY_NO_INIT_HPP_INCLUDED
+#define Z_GRABIN_UTILITY_NO_INIT_HPP_INCLUDED
+
+/** @file grabin/utility/no_init.hpp
+ @brief Тэг для создания контейнеров без инициализации элементов
+*/
+
+#include <type_traits>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v1
+{
+    /** @brief Тип-тэг "не инициализировать элементы"
+
+    Конструкторы векторов и матриц, принимающие этот тэг, инициализируют
+    элементы по умолчанию, то есть для встроенных типов оставляют их значения
+    неопределёнными. Это исключает лишнее заполнение нулями, если следующим
+    шагом всем элементам будут присвоены значения.
+    */
+    struct no_init_t
+    {
+        /// @brief Явный конструктор, чтобы исключить создание из <tt>{}</tt>
+        explicit no_init_t() = default;
+    };
+
+    /// @brief Объект-тэг "не инициализировать элементы"
+    constexpr no_init_t no_init{};
+
+    /// @cond false
+    namespace detail
+    {
+        template <class T, class... Args>
+        T make_no_init_impl(std::true_type, Args &&... args)
+        {
+            return T(std::forward<Args>(args)..., grabin::no_init);
+        }
+
+        template <class T, class... Args>
+        T make_no_init_impl(std::false_type, Args &&... args)
+        {
+            return T(std::forward<Args>(args)...);
+        }
+    }
+    // namespace detail
+    /// @endcond
+
+    /** @brief Создание объекта без инициализации элементов, если тип это
+    поддерживает
+    @tparam T тип создаваемого объекта
+    @param args аргументы конструктора (например, размерности)
+    @return <tt>T(args..., no_init)</tt>, если такой конструктор существует,
+    иначе -- <tt>T(args...)</tt>
+
+    Предназначена для обобщённого кода, который создаёт временные объекты и
+    затем присваивает значения всем их элементам.
+    */
+    template <class T, class... Args>
+    T make_no_init(Args &&... args)
+    {
+        using Tag = std::is_constructible<T, Args..., no_init_t>;
+        return detail::make_no_init_impl<T>(Tag{}, std::forward<Args>(args)...);
+    }
+}
+// namespace v1
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_UTILITY_NO_INIT_HPP_INCLUDED
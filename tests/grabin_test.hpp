@@ -341,15 +341,15 @@ namespace Matchers
 namespace Catch
 {
 
-    template <class T, class Check>
-    struct is_range<grabin::matrix<T, Check>>
+    template <class T, class Check, class A>
+    struct is_range<grabin::matrix<T, Check, A>>
      : std::false_type
     {};
 
-    template <class T, class Check>
-    struct StringMaker<grabin::matrix<T, Check>>
+    template <class T, class Check, class A>
+    struct StringMaker<grabin::matrix<T, Check, A>>
     {
-        static std::string convert(grabin::matrix<T, Check> const & value)
+        static std::string convert(grabin::matrix<T, Check, A> const & value)
         {
             std::ostringstream os;
 
@@ -380,6 +380,40 @@ namespace Catch
 }
 // namespace Catch
 
+#include <grabin/algorithm.hpp>
+
+namespace grabin_test
+{
+    // Симметричная положительно определённая матрица B*B^T + I
+    template <class Matrix>
+    Matrix make_random_spd_matrix(std::ptrdiff_t n)
+    {
+        auto & rnd = grabin_test::random_engine();
+        std::uniform_real_distribution<double> distr(-1.0, 1.0);
+
+        grabin::matrix<double> B(n, n);
+        grabin::generate(B, [&]{ return distr(rnd); });
+
+        Matrix A(n, n);
+
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            auto sum = (i == j) ? 1.0 : 0.0;
+
+            for(auto const & k : grabin::view::indices(n))
+            {
+                sum += B(i, k) * B(j, k);
+            }
+
+            A(i, j) = sum;
+        }
+
+        return A;
+    }
+}
+// namespace grabin_test
+
 
 #endif
 // Z_GRABIN_TEST_HPP_INCLUDED
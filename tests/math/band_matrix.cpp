@@ -0,0 +1,105 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/band_matrix.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/view/indices.hpp>
+
+TEST_CASE("band_matrix : storage and access")
+{
+    using Value = int;
+
+    grabin::band_matrix<Value> A(5, 1, 2);
+
+    CHECK(A.dim() == std::make_pair(std::ptrdiff_t(5), std::ptrdiff_t(5)));
+    CHECK(A.lower_bandwidth() == 1);
+    CHECK(A.upper_bandwidth() == 2);
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CAPTURE(i, j);
+
+        auto const in_band = (j - i <= 2 && i - j <= 1);
+
+        CHECK(A.in_band(i, j) == in_band);
+        CHECK(grabin::as_const(A)(i, j) == 0);
+
+        if(in_band)
+        {
+            A(i, j) = 10 * i + j;
+        }
+        else
+        {
+            CHECK_THROWS_AS(A(i, j), std::out_of_range);
+        }
+    }
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(grabin::as_const(A)(i, j) == (A.in_band(i, j) ? 10 * i + j : 0));
+    }
+
+    CHECK_THROWS_AS(grabin::as_const(A)(5, 0), std::out_of_range);
+    CHECK_THROWS_AS(grabin::as_const(A)(0, -1), std::out_of_range);
+}
+
+TEST_CASE("band_matrix : product with vector")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const n = 9;
+
+    grabin::band_matrix<Value> A(n, 2, 1);
+    grabin::matrix<Value> D(n, n);
+
+    std::uniform_int_distribution<Value> distr(-10, 10);
+    auto gen = [&]{ return distr(grabin_test::random_engine()); };
+
+    for(auto const & i : grabin::view::indices(n))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        if(A.in_band(i, j))
+        {
+            D(i, j) = A(i, j) = gen();
+        }
+    }
+
+    Vector x(n);
+    grabin::generate(x, gen);
+
+    CHECK(A * x == D * x);
+    CHECK(A * (x + x) == D * (2 * x));
+    CHECK_THROWS_AS(A * Vector(n + 1), std::logic_error);
+
+    // Пустая и диагональная матрицы
+    CHECK(grabin::band_matrix<Value>(0, 0, 0) * Vector(0) == Vector(0));
+
+    grabin::band_matrix<Value> I(3, 0, 0);
+    for(auto const & i : grabin::view::indices(3))
+    {
+        I(i, i) = 1;
+    }
+
+    CHECK(I * Vector{1, 2, 3} == (Vector{1, 2, 3}));
+}
@@ -0,0 +1,193 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/fixed_math_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/view/indices.hpp>
+
+namespace grabin_test
+{
+    template <class T, std::ptrdiff_t N, class Check>
+    struct Arbitrary<grabin::fixed_math_vector<T, N, Check>>
+    {
+        using value_type = grabin::fixed_math_vector<T, N, Check>;
+
+        template <class Engine>
+        static value_type generate(Engine & rnd, generation_t generation)
+        {
+            value_type result;
+
+            for(auto & x : result)
+            {
+                x = Arbitrary<T>::generate(rnd, generation);
+            }
+
+            return result;
+        }
+    };
+}
+// namespace grabin_test
+
+TEST_CASE("fixed_math_vector : types and default ctor")
+{
+    using Value = int;
+    using Vector = grabin::fixed_math_vector<Value, 3>;
+
+    static_assert(std::is_same<Vector::size_type, grabin::math_vector<Value>::size_type>::value, "");
+    static_assert(Vector::extent == 3, "");
+    static_assert(Vector::dim() == 3, "");
+    static_assert(grabin::is_math_vector_expression<Vector>::value, "");
+    static_assert(std::is_trivially_copyable<Vector>::value, "");
+    static_assert(sizeof(Vector) == 3 * sizeof(Value), "");
+
+    Vector const x{};
+
+    CHECK(x.dim() == 3);
+    CHECK(x.end() - x.begin() == 3);
+
+    for(auto const & elem : x)
+    {
+        CHECK(elem == Value(0));
+    }
+}
+
+TEST_CASE("fixed_math_vector : ctors check dimension")
+{
+    using Value = int;
+    using Vector = grabin::fixed_math_vector<Value, 3>;
+
+    auto property = [](Value const & value)
+    {
+        Vector const x(3, value);
+
+        for(auto const & elem : x)
+        {
+            CHECK(elem == value);
+        }
+
+        CHECK(Vector(3) == Vector{});
+
+        CHECK_THROWS_AS(Vector(2), std::logic_error);
+        CHECK_THROWS_AS(Vector(4, value), std::logic_error);
+        CHECK_THROWS_AS((Vector{value, value}), std::logic_error);
+        CHECK_THROWS_AS(Vector(std::vector<Value>(4, value)), std::logic_error);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("fixed_math_vector : range and initializer list ctors")
+{
+    using Value = int;
+    using Vector = grabin::fixed_math_vector<Value, 3>;
+
+    auto property = [](Value const & a, Value const & b, Value const & c)
+    {
+        Vector const x{a, b, c};
+        Vector const y(std::vector<Value>{a, b, c});
+
+        CHECK(x[0] == a);
+        CHECK(x[1] == b);
+        CHECK(x[2] == c);
+
+        CHECK(x == y);
+        CHECK_FALSE(x != y);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("fixed_math_vector : indexing")
+{
+    using Value = int;
+    using Vector = grabin::fixed_math_vector<Value, 4>;
+
+    auto property = [](Vector x, Value const & value)
+    {
+        for(auto const & i : grabin::view::indices_of(x))
+        {
+            CHECK(&x[i] == x.data() + i);
+            CHECK(&x.at(i) == x.data() + i);
+        }
+
+        x[1] = value;
+        CHECK(x.at(1) == value);
+
+        CHECK_THROWS_AS(x[-1], std::out_of_range);
+        CHECK_THROWS_AS(x[4], std::out_of_range);
+        CHECK_THROWS_AS(x.at(4), std::out_of_range);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("fixed_math_vector : linear operations")
+{
+    using Value = double;
+    using Vector = grabin::fixed_math_vector<Value, 3>;
+
+    Vector const x{1.0, 2.0, 3.0};
+    Vector const y{4.0, -5.0, 6.0};
+
+    Vector const z = 2.0 * x + y / 2.0 - x;
+
+    CHECK(z == (Vector{3.0, -0.5, 6.0}));
+
+    auto w = x;
+    w += y;
+    CHECK(w == (Vector{5.0, -3.0, 9.0}));
+
+    w -= x;
+    CHECK(w == y);
+
+    w *= 2.0;
+    CHECK(w == (Vector{8.0, -10.0, 12.0}));
+
+    w /= 4.0;
+    CHECK(w == (Vector{2.0, -2.5, 3.0}));
+
+    CHECK_THROWS_AS(w /= 0.0, std::logic_error);
+}
+
+TEST_CASE("fixed_math_vector : expression result keeps fixed dimension")
+{
+    using Value = double;
+    using Vector = grabin::fixed_math_vector<Value, 2>;
+    using Dynamic = grabin::math_vector<Value>;
+
+    Vector const x{1.0, 2.0};
+    Dynamic const y{3.0, 4.0};
+
+    static_assert(std::is_same<grabin::evaluated_type_t<decltype(x + x)>, Vector>::value, "");
+    static_assert(std::is_same<grabin::evaluated_type_t<decltype(x - y)>, Vector>::value, "");
+    static_assert(std::is_same<grabin::evaluated_type_t<decltype(y - x)>, Vector>::value, "");
+    static_assert(std::is_same<grabin::evaluated_type_t<decltype(2.0 * x)>, Vector>::value, "");
+    static_assert(std::is_same<grabin::evaluated_type_t<decltype(y + y)>, Dynamic>::value, "");
+
+    // Смешанные выражения
+    Vector const z = x + y;
+    CHECK(z == (Vector{4.0, 6.0}));
+
+    Dynamic const d = y - x;
+    CHECK(d == (Dynamic{2.0, 2.0}));
+    CHECK(d == (y - x));
+
+    CHECK_THROWS_AS(x + Dynamic(3), std::logic_error);
+}
@@ -0,0 +1,160 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/fixed_matrix.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/numeric.hpp>
+#include <grabin/view/indices.hpp>
+
+TEST_CASE("fixed_matrix : types and default ctor")
+{
+    using Value = int;
+    using Matrix = grabin::fixed_matrix<Value, 2, 3>;
+
+    static_assert(Matrix::dim1() == 2, "");
+    static_assert(Matrix::dim2() == 3, "");
+    static_assert(Matrix::size() == 6, "");
+    static_assert(sizeof(Matrix) == 6 * sizeof(Value), "");
+
+    Matrix const A{};
+
+    CHECK(A.dim() == std::make_pair(Matrix::size_type(2), Matrix::size_type(3)));
+    CHECK(A.end() - A.begin() == A.size());
+
+    for(auto const & elem : A)
+    {
+        CHECK(elem == Value(0));
+    }
+
+    CHECK(Matrix(2, 3) == A);
+    CHECK_THROWS_AS(Matrix(3, 2), std::logic_error);
+}
+
+TEST_CASE("fixed_matrix : indexing and linear operations")
+{
+    using Value = int;
+    using Matrix = grabin::fixed_matrix<Value, 2, 3>;
+
+    Matrix A;
+    Matrix B;
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        A(i, j) = i * 3 + j;
+        B(i, j) = 1;
+    }
+
+    CHECK(&A(1, 2) - &A(0, 0) == 5);
+    CHECK_THROWS_AS(A(2, 0), std::out_of_range);
+    CHECK_THROWS_AS(A(0, 3), std::out_of_range);
+
+    auto const C = 2 * A + B;
+    auto const D = (A * 4) / 2;
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(C(i, j) == 2 * A(i, j) + 1);
+        CHECK(D(i, j) == 2 * A(i, j));
+    }
+}
+
+TEST_CASE("fixed_matrix : product with vector")
+{
+    using Value = int;
+    using Matrix = grabin::fixed_matrix<Value, 2, 3>;
+    using Vector = grabin::fixed_math_vector<Value, 3>;
+
+    Matrix A;
+    A(0, 0) = 1; A(0, 1) = 2; A(0, 2) = 3;
+    A(1, 0) = 4; A(1, 1) = 5; A(1, 2) = 6;
+
+    auto const y = A * Vector{1, 0, -1};
+
+    static_assert(std::is_same<decltype(y), grabin::fixed_math_vector<Value, 2> const>::value, "");
+
+    CHECK(y == (grabin::fixed_math_vector<Value, 2>{-2, -2}));
+}
+
+TEST_CASE("fixed_matrix : outer product of fixed vectors")
+{
+    using Value = int;
+    using Vector = grabin::fixed_math_vector<Value, 3>;
+
+    Vector const x{1, 2, 3};
+    Vector const y{4, 5, 6};
+
+    auto const P = grabin::linear_algebra::outer_product{}(x, y);
+    auto const Q = grabin::linear_algebra::outer_product{}(x - y, y - x);
+
+    static_assert(std::is_same<decltype(P), grabin::fixed_matrix<Value, 3, 3> const>::value, "");
+    static_assert(std::is_same<decltype(Q), grabin::fixed_matrix<Value, 3, 3> const>::value, "");
+
+    for(auto const & i : grabin::view::indices(3))
+    for(auto const & j : grabin::view::indices(3))
+    {
+        CHECK(P(i, j) == x[i] * y[j]);
+        CHECK(Q(i, j) == (x[i] - y[i]) * (y[j] - x[j]));
+    }
+}
+
+TEST_CASE("fixed_matrix : product of matrices")
+{
+    using Value = int;
+
+    grabin::fixed_matrix<Value, 2, 3> A;
+    A(0, 0) = 1; A(0, 1) = 2; A(0, 2) = 3;
+    A(1, 0) = 4; A(1, 1) = 5; A(1, 2) = 6;
+
+    grabin::fixed_matrix<Value, 3, 2> B;
+    B(0, 0) = 1; B(0, 1) = 0;
+    B(1, 0) = 0; B(1, 1) = 1;
+    B(2, 0) = 1; B(2, 1) = -1;
+
+    auto const C = A * B;
+
+    static_assert(std::is_same<decltype(C), grabin::fixed_matrix<Value, 2, 2> const>::value, "");
+
+    CHECK(C(0, 0) == 4);
+    CHECK(C(0, 1) == -1);
+    CHECK(C(1, 0) == 10);
+    CHECK(C(1, 1) == -1);
+}
+
+TEST_CASE("fixed_matrix: transpose")
+{
+    using Value = int;
+
+    grabin::fixed_matrix<Value, 2, 3> A;
+    grabin::iota(A, 1);
+
+    auto const B = grabin::transpose(A);
+
+    static_assert(std::is_same<decltype(B), grabin::fixed_matrix<Value, 3, 2> const>::value, "");
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(B(j, i) == A(i, j));
+    }
+
+    CHECK(grabin::transpose(B) == A);
+}
@@ -0,0 +1,369 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/kernels.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    template <class Value>
+    std::vector<Value> make_random_vector(std::ptrdiff_t n)
+    {
+        std::uniform_int_distribution<int> distr(-20, 20);
+        std::vector<Value> result(n);
+        grabin::generate(result, [&]{ return Value(distr(grabin_test::random_engine())); });
+        return result;
+    }
+
+    // Длины перебираются так, чтобы покрыть основной цикл и все варианты "хвоста"
+    template <class Value>
+    void check_kernels()
+    {
+        for(auto n = 0; n < 70; ++ n)
+        {
+            auto const x = make_random_vector<Value>(n);
+            auto const y_old = make_random_vector<Value>(n);
+            auto const a = Value(3);
+
+            CAPTURE(n, x, y_old);
+
+            // Скалярное произведение: значения целые и небольшие, поэтому вычисления точные
+            auto expected_dot = Value(0);
+            for(auto i = 0; i < n; ++ i)
+            {
+                expected_dot += x[i] * y_old[i];
+            }
+            CHECK(grabin::kernels::dot(n, x.data(), y_old.data()) == expected_dot);
+
+            // Сумма элементов
+            auto expected_sum = Value(0);
+            for(auto i = 0; i < n; ++ i)
+            {
+                expected_sum += x[i];
+            }
+            CHECK(grabin::kernels::sum(n, x.data()) == expected_sum);
+
+            // axpy
+            auto y = y_old;
+            grabin::kernels::axpy(n, a, x.data(), y.data());
+            for(auto i = 0; i < n; ++ i)
+            {
+                CHECK(y[i] == y_old[i] + a * x[i]);
+            }
+
+            // Сложение и вычитание
+            y = y_old;
+            grabin::kernels::add(n, x.data(), y.data());
+            for(auto i = 0; i < n; ++ i)
+            {
+                CHECK(y[i] == y_old[i] + x[i]);
+            }
+
+            y = y_old;
+            grabin::kernels::subtract(n, x.data(), y.data());
+            for(auto i = 0; i < n; ++ i)
+            {
+                CHECK(y[i] == y_old[i] - x[i]);
+            }
+
+            // Умножение и деление на скаляр
+            y = y_old;
+            grabin::kernels::scale(n, a, y.data());
+            for(auto i = 0; i < n; ++ i)
+            {
+                CHECK(y[i] == y_old[i] * a);
+            }
+
+            y = y_old;
+            grabin::kernels::divide(n, Value(4), y.data());
+            for(auto i = 0; i < n; ++ i)
+            {
+                CHECK(y[i] == y_old[i] / Value(4));
+            }
+        }
+    }
+}
+
+TEST_CASE("kernels: double")
+{
+    check_kernels<double>();
+}
+
+TEST_CASE("kernels: float")
+{
+    check_kernels<float>();
+}
+
+TEST_CASE("kernels: int")
+{
+    check_kernels<int>();
+}
+
+TEST_CASE("kernels: dot of large real arrays")
+{
+    using Value = double;
+
+    auto const n = 100003;
+
+    std::vector<Value> x(n);
+    std::vector<Value> y(n);
+
+    std::uniform_real_distribution<Value> distr(-1, 1);
+    auto gen = [&]{ return distr(grabin_test::random_engine()); };
+
+    grabin::generate(x, gen);
+    grabin::generate(y, gen);
+
+    auto expected = Value(0);
+    auto abs_sum = Value(0);
+    for(auto i = 0; i < n; ++ i)
+    {
+        expected += x[i] * y[i];
+        abs_sum += std::abs(x[i] * y[i]);
+    }
+
+    auto const actual = grabin::kernels::dot(n, x.data(), y.data());
+
+    CHECK_THAT(actual, Catch::Matchers::WithinAbs(expected, abs_sum * 1e-12));
+}
+
+namespace
+{
+    // Размеры подобраны так, чтобы покрыть неполные блоки микроядра и
+    // несколько блоков всех уровней разбиения
+    template <class Value>
+    void check_gemm()
+    {
+        struct dims { std::ptrdiff_t m, n, k; };
+
+        for(auto d : {dims{1, 1, 1}, dims{3, 5, 2}, dims{7, 17, 9}, dims{13, 33, 40},
+                      dims{80, 21, 300}, dims{150, 70, 31}})
+        {
+            CAPTURE(d.m, d.n, d.k);
+
+            // Строки C длиннее n, чтобы проверить работу с подматрицами
+            auto const ldc = d.n + 3;
+
+            auto const a = make_random_vector<Value>(d.m * d.k);
+            auto const b = make_random_vector<Value>(d.k * d.n);
+            auto const c_old = make_random_vector<Value>(d.m * ldc);
+
+            auto const alpha = Value(2);
+            auto const beta = Value(3);
+
+            auto expected = c_old;
+            for(auto i = 0; i < d.m; ++ i)
+            for(auto j = 0; j < d.n; ++ j)
+            {
+                auto sum = Value(0);
+                for(auto p = 0; p < d.k; ++ p)
+                {
+                    sum += a[i*d.k + p] * b[p*d.n + j];
+                }
+
+                expected[i*ldc + j] = alpha * sum + beta * c_old[i*ldc + j];
+            }
+
+            auto c = c_old;
+            grabin::kernels::gemm(d.m, d.n, d.k, alpha, a.data(), d.k, b.data(), d.n,
+                                  beta, c.data(), ldc);
+
+            CHECK(c == expected);
+
+            // Те же матрицы A и B, хранящиеся по столбцам
+            std::vector<Value> a_c(a.size());
+            std::vector<Value> b_c(b.size());
+            for(auto i = 0; i < d.m; ++ i)
+            for(auto p = 0; p < d.k; ++ p)
+            {
+                a_c[p*d.m + i] = a[i*d.k + p];
+            }
+            for(auto p = 0; p < d.k; ++ p)
+            for(auto j = 0; j < d.n; ++ j)
+            {
+                b_c[j*d.k + p] = b[p*d.n + j];
+            }
+
+            c = c_old;
+            grabin::kernels::gemm(d.m, d.n, d.k, alpha, a_c.data(), std::ptrdiff_t(1), d.m,
+                                  b_c.data(), std::ptrdiff_t(1), d.k, beta, c.data(), ldc);
+
+            CHECK(c == expected);
+
+            // При beta == 0 исходные значения C не используются
+            for(auto i = 0; i < d.m; ++ i)
+            for(auto j = 0; j < d.n; ++ j)
+            {
+                c[i*ldc + j] = std::numeric_limits<Value>::max();
+                expected[i*ldc + j] -= beta * c_old[i*ldc + j];
+            }
+
+            grabin::kernels::gemm(d.m, d.n, d.k, alpha, a.data(), d.k, b.data(), d.n,
+                                  Value(0), c.data(), ldc);
+
+            for(auto i = 0; i < d.m; ++ i)
+            for(auto j = 0; j < d.n; ++ j)
+            {
+                REQUIRE(c[i*ldc + j] == expected[i*ldc + j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("kernels: gemm")
+{
+    check_gemm<double>();
+    check_gemm<float>();
+    check_gemm<int>();
+}
+
+namespace
+{
+    template <class Value>
+    void check_gemv()
+    {
+        for(auto m : {0, 1, 5, 17})
+        for(auto n : {0, 1, 3, 33})
+        {
+            CAPTURE(m, n);
+
+            auto const lda = n + 2;
+            auto const a = make_random_vector<Value>(m * lda);
+            auto const x = make_random_vector<Value>(std::max(m, n));
+            auto const y_old = make_random_vector<Value>(std::max(m, n));
+
+            auto const alpha = Value(2);
+            auto const beta = Value(-3);
+
+            // y = alpha*A*x + beta*y
+            auto y = y_old;
+            grabin::kernels::gemv(m, n, alpha, a.data(), lda, x.data(), beta, y.data());
+
+            for(auto i = 0; i < m; ++ i)
+            {
+                auto sum = Value(0);
+                for(auto j = 0; j < n; ++ j)
+                {
+                    sum += a[i*lda + j] * x[j];
+                }
+
+                CHECK(y[i] == alpha * sum + beta * y_old[i]);
+            }
+
+            // y = alpha*A^T*x + beta*y
+            y = y_old;
+            grabin::kernels::gemv_t(m, n, alpha, a.data(), lda, x.data(), beta, y.data());
+
+            for(auto j = 0; j < n; ++ j)
+            {
+                auto sum = Value(0);
+                for(auto i = 0; i < m; ++ i)
+                {
+                    sum += a[i*lda + j] * x[i];
+                }
+
+                CHECK(y[j] == alpha * sum + beta * y_old[j]);
+            }
+
+            // При beta == 0 исходные значения y не используются
+            std::fill(y.begin(), y.end(), std::numeric_limits<Value>::max());
+            grabin::kernels::gemv_t(m, n, alpha, a.data(), lda, x.data(), Value(0), y.data());
+
+            for(auto j = 0; j < n; ++ j)
+            {
+                auto sum = Value(0);
+                for(auto i = 0; i < m; ++ i)
+                {
+                    sum += a[i*lda + j] * x[i];
+                }
+
+                CHECK(y[j] == alpha * sum);
+            }
+        }
+    }
+}
+
+TEST_CASE("kernels: gemv")
+{
+    check_gemv<double>();
+    check_gemv<float>();
+    check_gemv<int>();
+}
+
+TEST_CASE("kernels: transpose")
+{
+    using Value = int;
+
+    for(auto m : {0, 1, 7, 32, 33, 70})
+    for(auto n : {0, 1, 31, 65})
+    {
+        CAPTURE(m, n);
+
+        auto const lda = n + 3;
+        auto const ldb = m + 1;
+        auto const a = make_random_vector<Value>(m * lda);
+
+        // Промежутки между строками результата не изменяются
+        std::vector<Value> b(n * ldb, -1);
+        grabin::kernels::transpose(m, n, a.data(), lda, b.data(), ldb);
+
+        for(auto i = 0; i < m; ++ i)
+        for(auto j = 0; j < n; ++ j)
+        {
+            REQUIRE(b[j*ldb + i] == a[i*lda + j]);
+        }
+
+        for(auto j = 0; j < n; ++ j)
+        {
+            REQUIRE(b[j*ldb + m] == -1);
+        }
+    }
+}
+
+TEST_CASE("kernels: transpose in place")
+{
+    using Value = int;
+
+    for(auto n : {0, 1, 2, 31, 32, 33, 100})
+    {
+        CAPTURE(n);
+
+        auto const lda = n + 2;
+        auto const a_old = make_random_vector<Value>(n * lda);
+
+        auto a = a_old;
+        grabin::kernels::transpose(n, a.data(), lda);
+
+        for(auto i = 0; i < n; ++ i)
+        {
+            for(auto j = 0; j < n; ++ j)
+            {
+                REQUIRE(a[i*lda + j] == a_old[j*lda + i]);
+            }
+
+            REQUIRE(a[i*lda + n] == a_old[i*lda + n]);
+            REQUIRE(a[i*lda + n + 1] == a_old[i*lda + n + 1]);
+        }
+    }
+}
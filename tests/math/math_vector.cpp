@@ -25,10 +25,10 @@ Grabin -- это свободной программное обеспечени
 
 namespace grabin_test
 {
-    template <class T, class Check>
-    struct Arbitrary<grabin::math_vector<T, Check>>
+    template <class T, class Check, class A>
+    struct Arbitrary<grabin::math_vector<T, Check, A>>
     {
-        using value_type = grabin::math_vector<T, Check>;
+        using value_type = grabin::math_vector<T, Check, A>;
 
         template <class Engine>
         static value_type generate(Engine & rnd, generation_t generation)
@@ -607,3 +607,273 @@ TEST_CASE("math_vector: operator plus throws on different dimensions")
 
     grabin_test::check(property);
 }
+
+// Выражения
+namespace
+{
+    // Ограничение значений, чтобы произведения и суммы не переполняли int
+    int bounded(int a)
+    {
+        return a % 1000;
+    }
+
+    grabin::math_vector<int> bounded(grabin::math_vector<int> x)
+    {
+        for(auto & x_i : x)
+        {
+            x_i = bounded(x_i);
+        }
+
+        return x;
+    }
+}
+
+TEST_CASE("math_vector: expression is evaluated in one pass")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](Vector const & x_arbitrary, Value const & a_arbitrary)
+    {
+        auto const x = bounded(x_arbitrary);
+        auto const a = bounded(a_arbitrary);
+
+        auto const y = Vector(x.dim(), 3);
+        auto const z = Vector(x.dim(), -7);
+
+        auto const expr = a*x + y - z;
+
+        static_assert(grabin::is_math_vector_expression<std::decay_t<decltype(expr)>>::value, "");
+        static_assert(std::is_same<grabin::evaluated_type_t<decltype(expr)>, Vector>::value, "");
+
+        Vector const r1 = expr;
+
+        Vector r2(x.dim());
+        r2 = expr;
+
+        REQUIRE(expr.dim() == x.dim());
+        REQUIRE(r1.dim() == x.dim());
+
+        for(auto const & i : grabin::view::indices_of(x))
+        {
+            CHECK(expr[i] == a * x[i] + y[i] - z[i]);
+            CHECK(r1[i] == a * x[i] + y[i] - z[i]);
+        }
+
+        CHECK(r2 == r1);
+        CHECK(expr == r1);
+        CHECK_FALSE(expr != r1);
+
+        CHECK_THROWS_AS(expr[x.dim()], std::out_of_range);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector: expression owns temporary operands")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](Vector const & x_arbitrary)
+    {
+        auto const x = bounded(x_arbitrary);
+        auto const expr = Vector(x) + Vector(x.dim(), 1) * 2;
+
+        for(auto const & i : grabin::view::indices_of(x))
+        {
+            CHECK(expr[i] == x[i] + 2);
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector: aliasing assignment and compound operators")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](Vector const & x_arbitrary, Value const & a_arbitrary)
+    {
+        auto const x_old = bounded(x_arbitrary);
+        auto const a = bounded(a_arbitrary);
+
+        auto const y = Vector(x_old.dim(), 5);
+
+        auto x1 = x_old;
+        x1 = a * x1 - y;
+
+        auto x2 = x_old;
+        x2 += x2 * a - x2 - y;
+
+        auto x3 = x_old;
+        x3 -= y / 2 - x3;
+
+        for(auto const & i : grabin::view::indices_of(x_old))
+        {
+            CHECK(x1[i] == a * x_old[i] - y[i]);
+            CHECK(x2[i] == x_old[i] * a - y[i]);
+            CHECK(x3[i] == 2 * x_old[i] - y[i] / 2);
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector: mixed-type expressions")
+{
+    using Vector = grabin::math_vector<int>;
+    using Real_vector = grabin::math_vector<double>;
+
+    auto property = [](Vector const & x)
+    {
+        auto const y = Real_vector(x.dim(), 0.5);
+
+        auto const expr = (x - y) / 2.0;
+
+        static_assert(std::is_same<grabin::evaluated_type_t<decltype(expr)>, Real_vector>::value, "");
+
+        Real_vector const z = expr;
+
+        for(auto const & i : grabin::view::indices_of(x))
+        {
+            CHECK(z[i] == (x[i] - 0.5) / 2.0);
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector: element type conversion is explicit")
+{
+    using Vector = grabin::math_vector<int>;
+    using Real_vector = grabin::math_vector<double>;
+
+    static_assert(!std::is_convertible<Vector, Real_vector>::value, "");
+    static_assert(!std::is_assignable<Real_vector &, Vector const &>::value, "");
+    static_assert(std::is_constructible<Real_vector, Vector const &>::value, "");
+    static_assert(std::is_convertible<decltype(std::declval<Vector const &>() * 0.5),
+                                      Real_vector>::value, "");
+
+    auto property = [](Vector const & x)
+    {
+        auto const y = Real_vector(x);
+
+        REQUIRE(y.dim() == x.dim());
+
+        for(auto const & i : grabin::view::indices_of(x))
+        {
+            CHECK(y[i] == x[i]);
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+#include <grabin/numeric/inner_product.hpp>
+
+TEST_CASE("math_vector: expressions are iterable")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](Vector const & x)
+    {
+        auto const y = Vector(x.dim(), 3);
+
+        auto const diff = x - y;
+        auto const sum = x + y;
+        auto const scaled = 2 * x;
+
+        using Iterator = decltype(diff.begin());
+
+        static_assert(std::is_same<std::iterator_traits<Iterator>::iterator_category,
+                                   std::random_access_iterator_tag>::value, "");
+
+        REQUIRE(diff.end() - diff.begin() == x.dim());
+        REQUIRE(scaled.end() - scaled.begin() == x.dim());
+
+        auto const diff_value = Vector(diff);
+        auto const sum_value = Vector(sum);
+
+        CHECK(grabin::equal(diff, diff_value));
+        CHECK(grabin::equal(scaled, Vector(scaled)));
+
+        CHECK(grabin::linear_algebra::inner_prod(x - y, x - y)
+              == grabin::linear_algebra::inner_prod(diff_value, diff_value));
+
+        CHECK(grabin::reduce(x + y) == grabin::reduce(sum_value));
+        CHECK(grabin::reduce(grabin::execution::par, x + y) == grabin::reduce(sum_value));
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector: nested expression checks dimensions")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](Vector const & x, Vector const & y)
+    {
+        if(x.dim() != y.dim())
+        {
+            CHECK_THROWS_AS(2 * x - y, std::logic_error);
+            CHECK_THROWS_AS(x + x - y, std::logic_error);
+            CHECK_THROWS_AS(Vector(x) -= y * 3, std::logic_error);
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+#include <grabin/memory.hpp>
+
+TEST_CASE("math_vector: custom allocator")
+{
+    using Value = double;
+    using Allocator = grabin::aligned_allocator<Value>;
+    using Vector = grabin::math_vector<Value, grabin::math_vector_throws_check_policy, Allocator>;
+
+    static_assert(std::is_same<Vector::allocator_type, Allocator>::value, "");
+
+    auto property = [](std::vector<Value> const & src)
+    {
+        Vector const x(src);
+        Vector const y(x.dim(), Value(2), Allocator());
+
+        CHECK(reinterpret_cast<std::uintptr_t>(x.data()) % Allocator::alignment == 0);
+        CHECK(x.get_allocator() == Allocator());
+
+        Vector const z = x * 3.0 - y;
+
+        REQUIRE(z.dim() == x.dim());
+        for(auto const & i : grabin::view::indices_of(z))
+        {
+            CHECK(z[i] == x[i] * 3.0 - y[i]);
+        }
+        CHECK(reinterpret_cast<std::uintptr_t>(z.data()) % Allocator::alignment == 0);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector: no_init ctor")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](std::vector<Value> const & values)
+    {
+        Vector x(values.size(), grabin::no_init);
+
+        CHECK(x.dim() == static_cast<Vector::size_type>(values.size()));
+
+        std::copy(values.begin(), values.end(), x.begin());
+
+        CHECK(x == Vector(values));
+    };
+
+    grabin_test::check(property);
+}
@@ -0,0 +1,142 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/math_vector_view.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/numeric/linear_algebra.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <vector>
+
+TEST_CASE("math_vector_view : types")
+{
+    using Value = double;
+    using View = grabin::math_vector_view<Value const>;
+
+    static_assert(std::is_same<View::value_type, Value>::value, "");
+    static_assert(std::is_same<View::element_type, Value const>::value, "");
+    static_assert(std::is_same<View::size_type, grabin::math_vector<Value>::size_type>::value, "");
+    static_assert(std::is_same<View::iterator, Value const *>::value, "");
+    static_assert(grabin::is_math_vector_expression<View>::value, "");
+    static_assert(std::is_same<grabin::evaluated_type_t<View>, grabin::math_vector<Value>>::value, "");
+}
+
+TEST_CASE("math_vector_view : refers to external buffer")
+{
+    using Value = int;
+
+    auto property = [](std::vector<Value> values)
+    {
+        grabin::math_vector_view<Value> const x(values.data(), values.size());
+
+        CHECK(x.dim() == static_cast<std::ptrdiff_t>(values.size()));
+        CHECK(x.data() == values.data());
+        CHECK(x.begin() == values.data());
+        CHECK(x.end() == values.data() + values.size());
+
+        for(auto const & i : grabin::view::indices_of(x))
+        {
+            CHECK(&x[i] == &values[i]);
+            CHECK(&x.at(i) == &values[i]);
+        }
+
+        CHECK_THROWS_AS(x[-1], std::out_of_range);
+        CHECK_THROWS_AS(x.at(x.dim()), std::out_of_range);
+
+        // Копирование представления не копирует элементы
+        auto const y = x;
+        CHECK(y.data() == x.data());
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector_view : views of vectors")
+{
+    using Value = int;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](std::vector<Value> const & values)
+    {
+        Vector x(values);
+
+        auto const view = grabin::make_math_vector_view(x);
+        auto const c_view = grabin::make_math_vector_view(grabin::as_const(x));
+
+        static_assert(std::is_same<decltype(view), grabin::math_vector_view<Value> const>::value, "");
+        static_assert(std::is_same<decltype(c_view), grabin::math_vector_view<Value const> const>::value, "");
+
+        CHECK(view.data() == x.data());
+        CHECK(c_view.data() == x.data());
+
+        CHECK(view == x);
+        CHECK(c_view == x);
+        CHECK(Vector(c_view) == x);
+
+        grabin::math_vector_view<Value const> const from_view(view);
+        CHECK(from_view.data() == x.data());
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("math_vector_view : assignment writes to the buffer")
+{
+    using Value = double;
+
+    std::vector<Value> buffer{1.0, 2.0, 3.0, 4.0};
+    std::vector<Value> const other{10.0, 20.0};
+
+    grabin::math_vector_view<Value> x(buffer.data(), 2);
+    grabin::math_vector_view<Value> y(buffer.data() + 2, 2);
+    grabin::math_vector_view<Value const> const z(other.data(), 2);
+
+    x = 2.0 * z - y;
+    CHECK(buffer == (std::vector<Value>{17.0, 36.0, 3.0, 4.0}));
+
+    y = x;
+    CHECK(buffer == (std::vector<Value>{17.0, 36.0, 17.0, 36.0}));
+    CHECK(y.data() == buffer.data() + 2);
+
+    y += z;
+    y -= x;
+    CHECK(buffer == (std::vector<Value>{17.0, 36.0, 10.0, 20.0}));
+
+    y *= 3.0;
+    y /= 2.0;
+    CHECK(buffer == (std::vector<Value>{17.0, 36.0, 15.0, 30.0}));
+
+    CHECK_THROWS_AS(x = grabin::math_vector<Value>(3), std::logic_error);
+}
+
+TEST_CASE("math_vector_view : inner product without copy")
+{
+    using Value = double;
+
+    std::vector<Value> const buffer{1.0, 2.0, 3.0};
+    grabin::math_vector_view<Value const> const x(buffer.data(), buffer.size());
+    grabin::math_vector<Value> const y{4.0, 5.0, 6.0};
+
+    CHECK(grabin::linear_algebra::inner_prod(x, y) == 32.0);
+    CHECK(grabin::linear_algebra::inner_prod(y, x) == 32.0);
+    CHECK(grabin::linear_algebra::inner_prod(x, x) == 14.0);
+    CHECK_THROWS_AS(grabin::linear_algebra::inner_prod(x, grabin::math_vector<Value>(2)),
+                    std::logic_error);
+}
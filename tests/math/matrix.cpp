@@ -21,8 +21,11 @@ Grabin -- это свободной программное обеспечени
 #include "../grabin_test.hpp"
 
 #include <grabin/algorithm.hpp>
+#include <grabin/numeric.hpp>
+#include <grabin/numeric/linear_algebra.hpp>
 
 #include <cmath>
+#include <vector>
 
 TEST_CASE("matrix : types and default ctor")
 {
@@ -131,10 +134,10 @@ TEST_CASE("matrix: non-const indexing")
 
 namespace grabin_test
 {
-    template <class T, class Check>
-    struct Arbitrary<grabin::matrix<T, Check>>
+    template <class T, class Check, class A>
+    struct Arbitrary<grabin::matrix<T, Check, A>>
     {
-        using value_type = grabin::matrix<T, Check>;
+        using value_type = grabin::matrix<T, Check, A>;
 
         template <class Engine>
         static value_type generate(Engine & rnd, generation_t generation)
@@ -383,3 +386,388 @@ TEST_CASE("matrix: operator plus")
         property(xs, ys);
     }
 }
+
+#include <grabin/memory.hpp>
+#include <grabin/numeric.hpp>
+
+TEST_CASE("matrix: custom allocator")
+{
+    using Value = int;
+    using Allocator = grabin::aligned_allocator<Value>;
+    using Matrix = grabin::matrix<Value, grabin::math_vector_throws_check_policy, Allocator>;
+
+    static_assert(std::is_same<Matrix::allocator_type, Allocator>::value, "");
+
+    Matrix A(3, 5, Allocator());
+
+    CHECK(A.get_allocator() == Allocator());
+    CHECK(reinterpret_cast<std::uintptr_t>(&*A.begin()) % Allocator::alignment == 0);
+
+    grabin::iota(A, 1);
+
+    auto const B = A + 2 * A;
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(B(i, j) == 3 * A(i, j));
+    }
+}
+
+TEST_CASE("matrix: no_init ctor")
+{
+    using Value = int;
+    using Matrix = grabin::matrix<Value>;
+
+    Matrix A(3, 4, grabin::no_init);
+
+    CHECK(A.dim() == std::make_pair(Matrix::size_type(3), Matrix::size_type(4)));
+    CHECK(A.size() == 12);
+
+    grabin::iota(A, 1);
+
+    CHECK(A(2, 3) == 12);
+}
+
+TEST_CASE("matrix: product of matrices")
+{
+    using Value = double;
+    using Matrix = grabin::matrix<Value>;
+
+    auto property = [](Matrix const & A, Matrix const & B)
+    {
+        auto const C = A * B;
+
+        REQUIRE(C.dim1() == A.dim1());
+        REQUIRE(C.dim2() == B.dim2());
+
+        // Элементы целые и небольшие, поэтому вычисления точные
+        for(auto const & i : grabin::view::indices(C.dim1()))
+        for(auto const & j : grabin::view::indices(C.dim2()))
+        {
+            auto expected = Value(0);
+
+            for(auto const & p : grabin::view::indices(A.dim2()))
+            {
+                expected += A(i, p) * B(p, j);
+            }
+
+            REQUIRE(C(i, j) == expected);
+        }
+    };
+
+    for(auto generation = 0; generation < 100; ++ generation)
+    {
+        auto & rnd = grabin_test::random_engine();
+        std::uniform_int_distribution<int> distr(-10, +10);
+
+        using Size = Matrix::size_type;
+        using Size_generator = grabin_test::Arbitrary<grabin_test::container_size<Size>>;
+        auto const m = Size_generator::generate(rnd, generation) + 1;
+        auto const n = Size_generator::generate(rnd, generation) + 1;
+        auto const k = Size_generator::generate(rnd, generation) + 1;
+
+        Matrix A(m, k);
+        Matrix B(k, n);
+        grabin::generate(A, [&]{ return distr(rnd); });
+        grabin::generate(B, [&]{ return distr(rnd); });
+
+        property(A, B);
+    }
+
+    CHECK_THROWS_AS(Matrix(2, 3) * Matrix(2, 3), std::logic_error);
+}
+
+TEST_CASE("matrix: column-major layout")
+{
+    using Value = double;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    static_assert(std::is_same<Matrix_r::layout_type, grabin::row_major>::value, "");
+    static_assert(std::is_same<grabin::matrix_layout_t<Matrix_c>, grabin::column_major>::value, "");
+
+    Matrix_c A(2, 3);
+    A(0, 0) = 1; A(0, 1) = 2; A(0, 2) = 3;
+    A(1, 0) = 4; A(1, 1) = 5; A(1, 2) = 6;
+
+    // Элементы хранятся по столбцам
+    CHECK(std::vector<Value>(A.begin(), A.end()) == (std::vector<Value>{1, 4, 2, 5, 3, 6}));
+    CHECK(A.data()[1] == 4);
+
+    CHECK_THROWS_AS(A(2, 0), std::out_of_range);
+
+    auto const B = 2.0 * A + A;
+    CHECK(B(1, 2) == 18);
+
+    // Умножение на вектор
+    auto const y = A * grabin::math_vector<Value>{1, 0, -1};
+    CHECK(y == (grabin::math_vector<Value>{-2, -2}));
+
+    auto const z = A * (grabin::math_vector<Value>{1, 0, 0} - grabin::math_vector<Value>{0, 0, 1});
+    CHECK(z == y);
+}
+
+TEST_CASE("matrix: product of matrices with different layouts")
+{
+    using Value = double;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_int_distribution<int> distr(-10, +10);
+
+    // Размеры выбраны так, чтобы задействовать блочное ядро
+    auto const m = 23;
+    auto const k = 31;
+    auto const n = 19;
+
+    Matrix_r A_r(m, k);
+    Matrix_c A_c(m, k);
+    for(auto const & i : grabin::view::indices(m))
+    for(auto const & j : grabin::view::indices(k))
+    {
+        A_c(i, j) = A_r(i, j) = distr(rnd);
+    }
+
+    Matrix_r B_r(k, n);
+    Matrix_c B_c(k, n);
+    for(auto const & i : grabin::view::indices(k))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        B_c(i, j) = B_r(i, j) = distr(rnd);
+    }
+
+    auto const C = A_r * B_r;
+    auto const C_rc = A_r * B_c;
+    auto const C_cr = A_c * B_r;
+    auto const C_cc = A_c * B_c;
+
+    static_assert(std::is_same<decltype(C_rc), Matrix_r const>::value, "");
+    static_assert(std::is_same<decltype(C_cr), Matrix_c const>::value, "");
+
+    for(auto const & i : grabin::view::indices(m))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        CAPTURE(i, j);
+
+        REQUIRE(C_rc(i, j) == C(i, j));
+        REQUIRE(C_cr(i, j) == C(i, j));
+        REQUIRE(C_cc(i, j) == C(i, j));
+    }
+}
+
+TEST_CASE("matrix: rows, columns, diagonal and blocks")
+{
+    using Value = int;
+    using Matrix = grabin::matrix<Value>;
+
+    Matrix A(3, 3);
+    grabin::iota(A, 1);
+
+    static_assert(std::is_same<decltype(A.row(0)), grabin::math_vector_view<Value>>::value, "");
+    static_assert(std::is_same<decltype(grabin::as_const(A).col(0)),
+                               grabin::strided_vector_view<Value const>>::value, "");
+    static_assert(std::is_same<decltype(A.block(0, 0, 1, 1)), grabin::matrix_view<Value>>::value, "");
+
+    CHECK(A.row(2) == (grabin::math_vector<Value>{7, 8, 9}));
+    CHECK(grabin::math_vector<Value>(grabin::as_const(A).col(0)) == (grabin::math_vector<Value>{1, 4, 7}));
+    CHECK(grabin::math_vector<Value>(A.diagonal()) == (grabin::math_vector<Value>{1, 5, 9}));
+
+    CHECK(grabin::linear_algebra::inner_prod(A.row(1), A.col(1)) == 8 + 25 + 48);
+
+    // Исключение Гаусса для первого столбца без временных копий
+    for(auto const & i : grabin::view::indices(Matrix::size_type(1), A.dim1()))
+    {
+        auto const factor = A(i, 0);
+        A.row(i) -= factor * A.row(0);
+    }
+
+    CHECK(A(1, 0) == 0);
+    CHECK(A(2, 0) == 0);
+    CHECK(A.block(1, 1, 2, 2) == grabin::make_matrix_view(A).block(1, 1, 2, 2));
+    CHECK(grabin::math_vector<Value>(A.col(2)) == (grabin::math_vector<Value>{3, -6, -12}));
+
+    grabin::fill(A.block(1, 0, 2, 3), 0);
+    CHECK(A.view() == grabin::make_matrix_view(A));
+    CHECK(grabin::math_vector<Value>(A.col(2)) == (grabin::math_vector<Value>{3, 0, 0}));
+
+    CHECK_THROWS_AS(A.block(0, 0, 4, 1), std::out_of_range);
+}
+
+TEST_CASE("matrix: rows and columns of column-major matrix")
+{
+    using Value = int;
+    using Matrix = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                  std::allocator<Value>, grabin::column_major>;
+
+    Matrix A(2, 3);
+    grabin::iota(A, 1);
+
+    static_assert(std::is_same<decltype(A.row(0)), grabin::strided_vector_view<Value>>::value, "");
+    static_assert(std::is_same<decltype(A.col(0)), grabin::math_vector_view<Value>>::value, "");
+
+    CHECK(grabin::math_vector<Value>(A.row(0)) == (grabin::math_vector<Value>{1, 3, 5}));
+    CHECK(A.col(1) == (grabin::math_vector<Value>{3, 4}));
+    CHECK(grabin::math_vector<Value>(A.diagonal()) == (grabin::math_vector<Value>{1, 4}));
+
+    A.row(1) *= 10;
+    CHECK(std::vector<Value>(A.begin(), A.end()) == (std::vector<Value>{1, 20, 3, 40, 5, 60}));
+
+    auto const B = A.block(0, 1, 2, 2);
+    CHECK(B.stride() == 2);
+    CHECK(B(1, 1) == 60);
+}
+
+TEST_CASE("matrix: transpose")
+{
+    using Value = double;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_int_distribution<int> distr(-10, +10);
+
+    // Размеры выбраны так, чтобы задействовать рекурсивное деление
+    auto const m = 45;
+    auto const n = 70;
+
+    Matrix_r A_r(m, n);
+    Matrix_c A_c(m, n);
+    for(auto const & i : grabin::view::indices(m))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        A_c(i, j) = A_r(i, j) = distr(rnd);
+    }
+
+    auto const B_r = grabin::transpose(A_r);
+    auto const B_c = grabin::transpose(A_c);
+
+    static_assert(std::is_same<decltype(B_r), Matrix_r const>::value, "");
+    static_assert(std::is_same<decltype(B_c), Matrix_c const>::value, "");
+
+    REQUIRE(B_r.dim() == std::make_pair(A_r.dim2(), A_r.dim1()));
+    REQUIRE(B_c.dim() == std::make_pair(A_c.dim2(), A_c.dim1()));
+
+    // Ленивое транспонирование не копирует элементы
+    auto const T_r = A_r.transposed();
+    static_assert(std::is_same<grabin::matrix_layout_t<decltype(T_r)>, grabin::column_major>::value, "");
+    CHECK(T_r.data() == A_r.data());
+    CHECK(T_r.dim() == B_r.dim());
+
+    auto const T_c = grabin::as_const(A_c).transposed();
+    static_assert(std::is_same<grabin::matrix_layout_t<decltype(T_c)>, grabin::row_major>::value, "");
+
+    for(auto const & i : grabin::view::indices(m))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        REQUIRE(B_r(j, i) == A_r(i, j));
+        REQUIRE(B_c(j, i) == A_r(i, j));
+        REQUIRE(T_r(j, i) == A_r(i, j));
+        REQUIRE(T_c(j, i) == A_r(i, j));
+    }
+
+    // Транспонированное представление используется в произведениях
+    grabin::math_vector<Value> x(m);
+    grabin::generate(x, [&]{ return distr(rnd); });
+
+    CHECK(T_r * x == B_r * x);
+    CHECK(T_c * x == B_r * x);
+
+    // Транспонирование подматрицы и двойное транспонирование
+    auto const S = grabin::transpose(A_r.block(1, 2, 3, 4));
+    static_assert(std::is_same<decltype(S), Matrix_r const>::value, "");
+    CHECK(S.dim() == std::make_pair(Matrix_r::size_type(4), Matrix_r::size_type(3)));
+    CHECK(S(3, 2) == A_r(3, 5));
+
+    CHECK(grabin::transpose(B_r) == A_r);
+    CHECK(grabin::transpose(B_c) == A_c);
+}
+
+TEST_CASE("matrix: transpose in place")
+{
+    using Value = int;
+    using Matrix = grabin::matrix<Value>;
+
+    for(auto n : {0, 1, 5, 40})
+    {
+        Matrix A(n, n);
+        grabin::iota(A, 0);
+
+        auto const B = grabin::transpose(A);
+
+        grabin::transpose_in_place(A);
+        CHECK(A == B);
+    }
+
+    // Квадратный блок прямоугольной матрицы
+    Matrix A(3, 4);
+    grabin::iota(A, 1);
+
+    grabin::transpose_in_place(A.block(0, 1, 3, 3));
+    CHECK(std::vector<Value>(A.begin(), A.end())
+          == (std::vector<Value>{1, 2, 6, 10, 5, 3, 7, 11, 9, 4, 8, 12}));
+
+    CHECK_THROWS_AS(grabin::transpose_in_place(A), std::logic_error);
+}
+
+TEST_CASE("outer_product: accumulate in place")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    Vector const x{1, 2, 3};
+    Vector const y{-1, 0, 1, 2};
+
+    auto const product = grabin::linear_algebra::outer_product{};
+
+    Matrix A(3, 4);
+    grabin::iota(A, 1);
+    auto const A_obj = A + 2.0 * product(x, y);
+
+    // Строки хранятся непрерывно
+    product.accumulate(A, 2, x, y);
+    CHECK(A == A_obj);
+
+    // Столбцы хранятся непрерывно
+    Matrix_c B(3, 4);
+    for(auto const & i : grabin::view::indices(3))
+    for(auto const & j : grabin::view::indices(4))
+    {
+        B(i, j) = 4 * i + j + 1;
+    }
+
+    product.accumulate(B, 2, x, y);
+
+    for(auto const & i : grabin::view::indices(3))
+    for(auto const & j : grabin::view::indices(4))
+    {
+        CHECK(B(i, j) == A_obj(i, j));
+    }
+
+    // Подматрица и векторы, элементы которых хранятся не подряд
+    Matrix C(4, 5);
+    Matrix D(4, 3);
+    grabin::iota(D, 1);
+
+    auto C_block = C.block(1, 1, 3, 4);
+    grabin::strided_vector_view<Value const> const D_col(D.data() + 1, 3, D.dim2());
+
+    product.accumulate(C_block, 1, D_col, y);
+
+    for(auto const & i : grabin::view::indices(4))
+    for(auto const & j : grabin::view::indices(5))
+    {
+        auto const expected = (i == 0 || j == 0) ? 0.0 : D(i - 1, 1) * y[j - 1];
+        CHECK(C(i, j) == expected);
+    }
+
+    CHECK_THROWS_AS(product.accumulate(A, 1, y, y), std::logic_error);
+    CHECK_THROWS_AS(product.accumulate(A, 1, x, x), std::logic_error);
+}
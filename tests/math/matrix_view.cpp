@@ -0,0 +1,247 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/matrix_view.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/numeric/linear_algebra.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <vector>
+
+TEST_CASE("matrix_view : strided buffer")
+{
+    using Value = int;
+
+    // Матрица 2x3, строки которой выровнены по 4 элемента
+    std::vector<Value> buffer{1, 2, 3, -1,
+                              4, 5, 6, -1};
+
+    grabin::matrix_view<Value> const A(buffer.data(), 2, 3, 4);
+
+    static_assert(std::is_same<grabin::evaluated_type_t<decltype(A)>, grabin::matrix<Value>>::value, "");
+
+    CHECK(A.dim() == std::make_pair(std::ptrdiff_t(2), std::ptrdiff_t(3)));
+    CHECK(A.size() == 6);
+    CHECK(A.stride() == 4);
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(&A(i, j) == &buffer[i * 4 + j]);
+    }
+
+    CHECK_THROWS_AS(A(0, 3), std::out_of_range);
+    CHECK_THROWS_AS(A(2, 0), std::out_of_range);
+
+    // Итераторы обходят элементы по строкам, пропуская промежутки
+    CHECK(std::vector<Value>(A.begin(), A.end()) == (std::vector<Value>{1, 2, 3, 4, 5, 6}));
+    CHECK(std::vector<Value>(A.cbegin(), A.cend()) == (std::vector<Value>{1, 2, 3, 4, 5, 6}));
+
+    CHECK(A.row(1) == (grabin::math_vector<Value>{4, 5, 6}));
+
+    // Операции изменяют только элементы матрицы
+    auto B = A;
+    B *= 2;
+    CHECK(buffer == (std::vector<Value>{2, 4, 6, -1, 8, 10, 12, -1}));
+
+    B /= 2;
+    B += A;
+    CHECK(buffer == (std::vector<Value>{2, 4, 6, -1, 8, 10, 12, -1}));
+}
+
+TEST_CASE("matrix_view : empty")
+{
+    std::vector<int> buffer(4);
+
+    grabin::matrix_view<int> const A(buffer.data(), 2, 0, 2);
+    grabin::matrix_view<int> const B(buffer.data(), 0, 2);
+
+    CHECK(A.begin() == A.end());
+    CHECK(B.begin() == B.end());
+}
+
+TEST_CASE("matrix_view : view of matrix")
+{
+    using Value = int;
+    using Matrix = grabin::matrix<Value>;
+
+    Matrix A(3, 2);
+
+    std::uniform_int_distribution<Value> distr(-20, 20);
+    grabin::generate(A, [&]{ return distr(grabin_test::random_engine()); });
+
+    auto const view = grabin::make_matrix_view(grabin::as_const(A));
+
+    static_assert(std::is_same<decltype(view), grabin::matrix_view<Value const> const>::value, "");
+
+    CHECK(view.dim() == A.dim());
+    CHECK(view.data() == A.data());
+    CHECK(view.stride() == A.dim2());
+    CHECK(grabin::equal(view, A));
+}
+
+TEST_CASE("matrix_view : product with vector views")
+{
+    using Value = int;
+
+    std::vector<Value> const a{1, 2, 3,
+                               4, 5, 6};
+    std::vector<Value> const b{1, 0, -1};
+
+    grabin::matrix_view<Value const> const A(a.data(), 2, 3);
+    grabin::math_vector_view<Value const> const x(b.data(), 3);
+
+    auto const y = A * x;
+
+    static_assert(std::is_same<decltype(y), grabin::math_vector<Value> const>::value, "");
+    CHECK(y == (grabin::math_vector<Value>{-2, -2}));
+
+    // Матрица, владеющая элементами, умноженная на представление
+    CHECK(grabin::matrix<Value>(2, 3) * x == grabin::math_vector<Value>(2));
+
+    CHECK_THROWS_AS(A * grabin::math_vector<Value>(2), std::logic_error);
+}
+
+TEST_CASE("matrix_view : rows, columns and diagonal")
+{
+    using Value = int;
+
+    // Матрица 3x3, строки которой выровнены по 4 элемента
+    std::vector<Value> buffer{1, 2, 3, -1,
+                              4, 5, 6, -1,
+                              7, 8, 9, -1};
+
+    grabin::matrix_view<Value> const A(buffer.data(), 3, 3, 4);
+
+    static_assert(std::is_same<decltype(A.row(0)), grabin::math_vector_view<Value>>::value, "");
+    static_assert(std::is_same<decltype(A.col(0)), grabin::strided_vector_view<Value>>::value, "");
+
+    CHECK(A.row(1) == (grabin::math_vector<Value>{4, 5, 6}));
+    CHECK(grabin::math_vector<Value>(A.col(1)) == (grabin::math_vector<Value>{2, 5, 8}));
+    CHECK(grabin::math_vector<Value>(A.diagonal()) == (grabin::math_vector<Value>{1, 5, 9}));
+
+    CHECK_THROWS_AS(A.row(3), std::out_of_range);
+    CHECK_THROWS_AS(A.col(-1), std::out_of_range);
+
+    CHECK(grabin::linear_algebra::inner_prod(A.row(0), A.col(2)) == 3 + 12 + 27);
+
+    // Операции над столбцами и диагональю изменяют элементы матрицы
+    A.col(0) += A.col(2);
+    CHECK(buffer == (std::vector<Value>{4, 2, 3, -1, 10, 5, 6, -1, 16, 8, 9, -1}));
+
+    A.diagonal() *= 0;
+    CHECK(buffer == (std::vector<Value>{0, 2, 3, -1, 10, 0, 6, -1, 16, 8, 0, -1}));
+
+    grabin::fill(A.col(1), 7);
+    std::sort(A.col(0).begin(), A.col(0).end(), std::greater<>{});
+    CHECK(buffer == (std::vector<Value>{16, 7, 3, -1, 10, 7, 6, -1, 0, 7, 0, -1}));
+
+    // Диагональ прямоугольной матрицы
+    grabin::matrix_view<Value const> const B(buffer.data(), 2, 3, 4);
+    CHECK(B.diagonal().dim() == 2);
+}
+
+TEST_CASE("matrix_view : block")
+{
+    using Value = int;
+
+    std::vector<Value> buffer{ 1,  2,  3,  4,
+                               5,  6,  7,  8,
+                               9, 10, 11, 12};
+
+    grabin::matrix_view<Value> const A(buffer.data(), 3, 4);
+
+    auto B = A.block(1, 1, 2, 2);
+
+    static_assert(std::is_same<decltype(B), grabin::matrix_view<Value>>::value, "");
+
+    CHECK(B.dim() == std::make_pair(std::ptrdiff_t(2), std::ptrdiff_t(2)));
+    CHECK(B.stride() == A.stride());
+    CHECK(&B(0, 0) == &A(1, 1));
+    CHECK(std::vector<Value>(B.begin(), B.end()) == (std::vector<Value>{6, 7, 10, 11}));
+
+    // Блок блока
+    CHECK(&B.block(1, 0, 1, 2)(0, 1) == &A(2, 2));
+
+    B *= 10;
+    CHECK(buffer == (std::vector<Value>{1, 2, 3, 4, 5, 60, 70, 8, 9, 100, 110, 12}));
+
+    std::vector<Value> const other{1, 2, 3,
+                                   4, 5, 6};
+    B += grabin::matrix_view<Value const>(other.data(), 2, 3).block(0, 1, 2, 2);
+    CHECK(buffer == (std::vector<Value>{1, 2, 3, 4, 5, 62, 73, 8, 9, 105, 116, 12}));
+
+    // Пустые блоки допустимы, блоки за пределами матрицы -- нет
+    CHECK(A.block(3, 4, 0, 0).size() == 0);
+    CHECK_THROWS_AS(A.block(2, 0, 2, 1), std::out_of_range);
+    CHECK_THROWS_AS(A.block(0, 3, 1, 2), std::out_of_range);
+    CHECK_THROWS_AS(A.block(-1, 0, 1, 1), std::out_of_range);
+    CHECK_THROWS_AS(A.block(0, 0, -1, 1), std::out_of_range);
+}
+
+TEST_CASE("matrix_view : column-major layout")
+{
+    using Value = int;
+    using View = grabin::matrix_view<Value, grabin::math_vector_throws_check_policy,
+                                     grabin::column_major>;
+
+    // Матрица 2x3, столбцы которой выровнены по 3 элемента
+    std::vector<Value> buffer{1, 4, -1,
+                              2, 5, -1,
+                              3, 6, -1};
+
+    View const A(buffer.data(), 2, 3, 3);
+
+    static_assert(std::is_same<grabin::matrix_layout_t<View>, grabin::column_major>::value, "");
+    static_assert(std::is_same<decltype(A.row(0)), grabin::strided_vector_view<Value>>::value, "");
+    static_assert(std::is_same<decltype(A.col(0)), grabin::math_vector_view<Value>>::value, "");
+
+    CHECK(A(0, 2) == 3);
+    CHECK(A(1, 0) == 4);
+    CHECK(&A(1, 2) == &buffer[7]);
+
+    // Итераторы обходят элементы по столбцам, пропуская промежутки
+    CHECK(std::vector<Value>(A.begin(), A.end()) == (std::vector<Value>{1, 4, 2, 5, 3, 6}));
+
+    CHECK(grabin::math_vector<Value>(A.row(1)) == (grabin::math_vector<Value>{4, 5, 6}));
+    CHECK(A.col(2) == (grabin::math_vector<Value>{3, 6}));
+    CHECK(grabin::math_vector<Value>(A.diagonal()) == (grabin::math_vector<Value>{1, 5}));
+
+    CHECK(A * grabin::math_vector<Value>{1, 0, -1} == (grabin::math_vector<Value>{-2, -2}));
+
+    auto B = A.block(0, 1, 2, 2);
+    CHECK(&B(1, 0) == &A(1, 1));
+
+    B *= 2;
+    CHECK(buffer == (std::vector<Value>{1, 4, -1, 4, 10, -1, 6, 12, -1}));
+
+    // Представление матрицы, хранящейся по столбцам
+    grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                   std::allocator<Value>, grabin::column_major> M(2, 3);
+    auto M_view = grabin::make_matrix_view(M);
+
+    static_assert(std::is_same<decltype(M_view), View>::value, "");
+    CHECK(M_view.stride() == 2);
+
+    M_view += A;
+    CHECK(grabin::equal(M_view, A));
+    static_assert(std::is_same<grabin::evaluated_type_t<View>, decltype(M)>::value, "");
+}
@@ -0,0 +1,317 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/sparse_matrix.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/numeric/linear_algebra.hpp>
+#include <grabin/view/indices.hpp>
+
+#include <vector>
+
+TEST_CASE("csr_matrix : empty")
+{
+    using Value = double;
+
+    grabin::csr_matrix<Value> const A;
+
+    CHECK(A.dim() == std::make_pair(std::ptrdiff_t(0), std::ptrdiff_t(0)));
+    CHECK(A.nnz() == 0);
+    CHECK(A.row_offsets() == std::vector<std::ptrdiff_t>{0});
+
+    grabin::csr_matrix<Value> const Z(3, 2);
+
+    CHECK(Z.dim() == std::make_pair(std::ptrdiff_t(3), std::ptrdiff_t(2)));
+    CHECK(Z.nnz() == 0);
+    CHECK(Z(2, 1) == 0);
+    CHECK(Z * grabin::math_vector<Value>{1, 2} == grabin::math_vector<Value>(3));
+}
+
+TEST_CASE("csr_matrix : builder")
+{
+    using Value = int;
+
+    grabin::csr_matrix_builder<Value> builder(3, 4);
+
+    builder.add(2, 3, 7);
+    builder.add(0, 1, 1);
+    builder.add(2, 0, 5);
+    builder.add(0, 1, 2);
+    builder.add(1, 2, 4);
+    builder.add(0, 0, 3);
+
+    CHECK_THROWS_AS(builder.add(3, 0, 1), std::out_of_range);
+    CHECK_THROWS_AS(builder.add(0, 4, 1), std::out_of_range);
+
+    auto const A = builder.build();
+
+    static_assert(std::is_same<decltype(A), grabin::csr_matrix<Value> const>::value, "");
+
+    // Элементы упорядочены по строкам и столбцам, повторы сложены
+    CHECK(A.dim() == std::make_pair(std::ptrdiff_t(3), std::ptrdiff_t(4)));
+    CHECK(A.nnz() == 5);
+    CHECK(A.row_offsets() == (std::vector<std::ptrdiff_t>{0, 2, 3, 5}));
+    CHECK(A.column_indices() == (std::vector<std::ptrdiff_t>{0, 1, 2, 0, 3}));
+    CHECK(A.values() == (std::vector<Value>{3, 3, 4, 5, 7}));
+
+    CHECK(A(0, 1) == 3);
+    CHECK(A(1, 2) == 4);
+    CHECK(A(1, 0) == 0);
+    CHECK(A(2, 3) == 7);
+    CHECK_THROWS_AS(A(3, 0), std::out_of_range);
+
+    // Транспонирование (сжатый столбцовый формат)
+    auto const At = grabin::transpose(A);
+
+    CHECK(At.dim() == std::make_pair(std::ptrdiff_t(4), std::ptrdiff_t(3)));
+    CHECK(At.row_offsets() == (std::vector<std::ptrdiff_t>{0, 2, 3, 4, 5}));
+    CHECK(At.column_indices() == (std::vector<std::ptrdiff_t>{0, 2, 0, 1, 2}));
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(At(j, i) == A(i, j));
+    }
+}
+
+TEST_CASE("csr_matrix : invalid structure")
+{
+    using Matrix = grabin::csr_matrix<double>;
+    using Indices = std::vector<Matrix::size_type>;
+    using Values = std::vector<double>;
+
+    CHECK_NOTHROW(Matrix(2, 2, Indices{0, 1, 2}, Indices{1, 0}, Values{1, 2}));
+
+    // Неверное количество смещений
+    CHECK_THROWS_AS(Matrix(2, 2, Indices{0, 2}, Indices{1, 0}, Values{1, 2}), std::logic_error);
+    // Размеры массивов не совпадают
+    CHECK_THROWS_AS(Matrix(2, 2, Indices{0, 1, 2}, Indices{1, 0}, Values{1}), std::logic_error);
+    // Номер столбца вне диапазона
+    CHECK_THROWS_AS(Matrix(2, 2, Indices{0, 1, 2}, Indices{2, 0}, Values{1, 2}), std::logic_error);
+    // Номера столбцов в строке не возрастают
+    CHECK_THROWS_AS(Matrix(1, 2, Indices{0, 2}, Indices{1, 1}, Values{1, 2}), std::logic_error);
+    // Смещения убывают
+    CHECK_THROWS_AS(Matrix(2, 2, Indices{0, 2, 1}, Indices{0, 1}, Values{1, 2}), std::logic_error);
+    // Промежуточное смещение больше количества ненулевых элементов
+    CHECK_THROWS_AS(Matrix(2, 3, Indices{0, 5, 2}, Indices{0, 1}, Values{1, 2}), std::logic_error);
+}
+
+namespace
+{
+    // Случайная разреженная матрица и равная ей плотная
+    template <class Value>
+    std::pair<grabin::csr_matrix<Value>, grabin::matrix<Value>>
+    make_random_sparse(std::ptrdiff_t rows, std::ptrdiff_t cols, std::ptrdiff_t per_row)
+    {
+        auto & rnd = grabin_test::random_engine();
+        std::uniform_int_distribution<int> values(-10, 10);
+        std::uniform_int_distribution<std::ptrdiff_t> columns(0, cols - 1);
+
+        grabin::csr_matrix_builder<Value> builder(rows, cols);
+        grabin::matrix<Value> dense(rows, cols);
+
+        for(auto const & i : grabin::view::indices(rows))
+        for(auto k = 0*per_row; k != per_row; ++ k)
+        {
+            auto const j = columns(rnd);
+            auto const value = Value(values(rnd));
+
+            builder.add(i, j, value);
+            dense(i, j) += value;
+        }
+
+        return {builder.build(), dense};
+    }
+}
+
+TEST_CASE("csr_matrix : product with vector")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const m = 37;
+    auto const n = 23;
+
+    auto const AA = make_random_sparse<Value>(m, n, 4);
+    auto const & A = AA.first;
+    auto const & D = AA.second;
+
+    for(auto const & i : grabin::view::indices(m))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        REQUIRE(A(i, j) == D(i, j));
+    }
+
+    std::uniform_int_distribution<int> distr(-10, 10);
+    auto gen = [&]{ return distr(grabin_test::random_engine()); };
+
+    Vector x(n);
+    grabin::generate(x, gen);
+
+    Vector u(m);
+    grabin::generate(u, gen);
+
+    // Целые значения, поэтому сравнение точное
+    CHECK(A * x == D * x);
+    CHECK(A * (x + x) == D * (2.0 * x));
+    CHECK(grabin::multiply(grabin::execution::par, A, x) == D * x);
+    CHECK(grabin::multiply(grabin::execution::parallel_policy(3, 5), A, x) == D * x);
+
+    CHECK(grabin::multiply_transposed(A, u) == grabin::transpose(D) * u);
+    CHECK(grabin::transpose(A) * u == grabin::transpose(D) * u);
+
+    auto B = A;
+    B *= 2.0;
+    CHECK(B * x == 2.0 * (D * x));
+
+    CHECK_THROWS_AS(A * u, std::logic_error);
+    CHECK_THROWS_AS(grabin::multiply(grabin::execution::par, A, u), std::logic_error);
+    CHECK_THROWS_AS(grabin::multiply_transposed(A, x), std::logic_error);
+
+    // Запись результата в заданный вектор
+    Vector y(m);
+    auto const y_data = y.data();
+
+    grabin::multiply(grabin::execution::seq, A, x, y);
+    CHECK(y == D * x);
+
+    grabin::fill(y, 0.0);
+    grabin::multiply(grabin::execution::parallel_policy(3, 5), A, x, y);
+    CHECK(y == D * x);
+    CHECK(y.data() == y_data);
+
+    CHECK_THROWS_AS(grabin::multiply(grabin::execution::seq, A, u, y), std::logic_error);
+    CHECK_THROWS_AS(grabin::multiply(grabin::execution::seq, A, x, x), std::logic_error);
+    CHECK_THROWS_AS(grabin::multiply(grabin::execution::par, A, x, Vector(m + 1)), std::logic_error);
+}
+
+TEST_CASE("csr_matrix : parallel product does not depend on thread count")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const n = 100000;
+
+    // Трёхдиагональная матрица
+    grabin::csr_matrix_builder<Value> builder(n, n);
+    builder.reserve(3 * n);
+
+    for(auto const & i : grabin::view::indices(n))
+    {
+        if(i > 0)
+        {
+            builder.add(i, i - 1, -1.0);
+        }
+
+        builder.add(i, i, 2.5);
+
+        if(i + 1 < n)
+        {
+            builder.add(i, i + 1, -1.0 / 3);
+        }
+    }
+
+    auto const A = builder.build();
+
+    CHECK(A.nnz() == 3 * n - 2);
+
+    Vector x(n);
+    std::uniform_real_distribution<Value> distr(-1, 1);
+    grabin::generate(x, [&]{ return distr(grabin_test::random_engine()); });
+
+    auto const y = A * x;
+
+    for(auto threads : {1, 2, 3, 8})
+    {
+        CAPTURE(threads);
+        CHECK(grabin::multiply(grabin::execution::parallel_policy(threads, 1000), A, x) == y);
+    }
+}
+
+TEST_CASE("csr_matrix : minimal residue solver")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    grabin::csr_matrix_builder<Value> builder(2, 2);
+    builder.add(0, 0, 1);
+    builder.add(0, 1, -0.5);
+    builder.add(1, 0, -0.5);
+    builder.add(1, 1, 2);
+
+    auto const A = builder.build();
+
+    Vector const x{3, -4};
+
+    auto const x0 = grabin::linear_algebra::minimal_residue(A, A * x);
+
+    CHECK_THAT(x0, grabin_test::Matchers::elementwise_within_abs(x, 1e-3));
+}
+
+TEST_CASE("csr_matrix : minimal residue solver reuses workspace")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const n = 10000;
+
+    // Трёхдиагональная матрица с диагональным преобладанием
+    grabin::csr_matrix_builder<Value> builder(n, n);
+    builder.reserve(3 * n);
+
+    for(auto const & i : grabin::view::indices(n))
+    {
+        if(i > 0)
+        {
+            builder.add(i, i - 1, -1.0);
+        }
+
+        builder.add(i, i, 4.0);
+
+        if(i + 1 < n)
+        {
+            builder.add(i, i + 1, -0.5);
+        }
+    }
+
+    auto const A = builder.build();
+
+    grabin::linear_algebra::iterative_options options;
+    options.tolerance = 1e-12;
+
+    grabin::linear_algebra::iterative_workspace<Vector> workspace;
+
+    for(auto generation = 0; generation < 3; ++ generation)
+    {
+        Vector x_exact(n);
+        std::uniform_real_distribution<Value> distr(-1, 1);
+        grabin::generate(x_exact, [&]{ return distr(grabin_test::random_engine()); });
+
+        Vector const b = A * x_exact;
+
+        Vector x(n);
+        auto const report = grabin::linear_algebra::minimal_residue(A, b, x, options, workspace);
+
+        CAPTURE(report.iterations, report.residual);
+        CHECK(report.converged);
+        CHECK_THAT(x, grabin_test::Matchers::elementwise_within_abs(x_exact, 1e-10));
+        CHECK(workspace.size() == 2);
+    }
+}
@@ -0,0 +1,140 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/strided_vector_view.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/numeric/linear_algebra.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("strided_vector_view : types")
+{
+    using Value = double;
+    using View = grabin::strided_vector_view<Value const>;
+
+    static_assert(std::is_same<View::value_type, Value>::value, "");
+    static_assert(std::is_same<View::element_type, Value const>::value, "");
+    static_assert(std::is_same<View::check_policy, grabin::math_vector_throws_check_policy>::value, "");
+    static_assert(std::is_same<std::iterator_traits<View::iterator>::iterator_category,
+                               std::random_access_iterator_tag>::value, "");
+    static_assert(grabin::is_math_vector_expression<View>::value, "");
+    static_assert(std::is_same<grabin::evaluated_type_t<View>, grabin::math_vector<Value>>::value, "");
+}
+
+TEST_CASE("strided_vector_view : refers to every n-th element")
+{
+    using Value = int;
+
+    std::vector<Value> buffer{1, -1, 2, -1, 3, -1, 4};
+
+    grabin::strided_vector_view<Value> const x(buffer.data(), 4, 2);
+
+    CHECK(x.dim() == 4);
+    CHECK(x.size() == 4);
+    CHECK(x.stride() == 2);
+
+    for(auto const & i : grabin::view::indices_of(x))
+    {
+        CHECK(&x[i] == &buffer[2*i]);
+        CHECK(&x.at(i) == &buffer[2*i]);
+    }
+
+    CHECK_THROWS_AS(x[4], std::out_of_range);
+    CHECK_THROWS_AS(x.at(-1), std::out_of_range);
+
+    CHECK(x.end() - x.begin() == x.dim());
+    CHECK(std::vector<Value>(x.cbegin(), x.cend()) == (std::vector<Value>{1, 2, 3, 4}));
+    CHECK(x == grabin::strided_vector_view<Value>(buffer.data(), 4, 2));
+
+    // Алгоритмы изменяют только элементы представления
+    std::reverse(x.begin(), x.end());
+    CHECK(buffer == (std::vector<Value>{4, -1, 3, -1, 2, -1, 1}));
+
+    std::sort(x.begin(), x.end());
+    CHECK(buffer == (std::vector<Value>{1, -1, 2, -1, 3, -1, 4}));
+
+    grabin::fill(x, 0);
+    CHECK(buffer == (std::vector<Value>{0, -1, 0, -1, 0, -1, 0}));
+}
+
+TEST_CASE("strided_vector_view : iterators stay within the buffer")
+{
+    using Value = int;
+
+    // Последний элемент представления -- последний элемент буфера, поэтому
+    // адрес "за последним элементом" с шагом 3 лежал бы вне буфера
+    std::vector<Value> const buffer{1, -1, -1, 2, -1, -1, 3};
+
+    grabin::strided_vector_view<Value const> const x(buffer.data(), 3, 3);
+
+    auto const first = x.begin();
+    auto const last = x.end();
+
+    CHECK(last - first == 3);
+    CHECK(first < last);
+    CHECK(first + 3 == last);
+    CHECK(&*(last - 1) == &buffer.back());
+    CHECK(&first[2] == &buffer.back());
+    CHECK(std::vector<Value>(std::make_reverse_iterator(last), std::make_reverse_iterator(first))
+          == (std::vector<Value>{3, 2, 1}));
+
+    // Преобразование в константный итератор сохраняет позицию
+    auto data = buffer;
+    grabin::strided_vector_view<Value> const y(data.data(), 3, 3);
+
+    grabin::strided_vector_view<Value const>::iterator const y_last = y.end();
+    CHECK(y_last - y.cbegin() == 3);
+    CHECK(&*(y_last - 1) == &data.back());
+}
+
+TEST_CASE("strided_vector_view : linear operations")
+{
+    using Value = int;
+
+    std::vector<Value> buffer{1, 0, 2, 0, 3};
+
+    grabin::strided_vector_view<Value> x(buffer.data(), 3, 2);
+    grabin::math_vector<Value> const y{10, 20, 30};
+
+    CHECK(grabin::linear_algebra::inner_prod(x, y) == 10 + 40 + 90);
+
+    CHECK(grabin::evaluated_type_t<decltype(x)>(x + y) == (grabin::math_vector<Value>{11, 22, 33}));
+    CHECK(grabin::evaluated_type_t<decltype(x)>(2 * x) == (grabin::math_vector<Value>{2, 4, 6}));
+
+    x += y;
+    CHECK(buffer == (std::vector<Value>{11, 0, 22, 0, 33}));
+
+    x -= y;
+    x *= 3;
+    CHECK(buffer == (std::vector<Value>{3, 0, 6, 0, 9}));
+
+    x /= 3;
+    CHECK(buffer == (std::vector<Value>{1, 0, 2, 0, 3}));
+    CHECK_THROWS_AS(x /= 0, std::logic_error);
+
+    x = y - x;
+    CHECK(buffer == (std::vector<Value>{9, 0, 18, 0, 27}));
+
+    grabin::math_vector<Value> const z{1, 2};
+    CHECK_THROWS_AS(x = z, std::logic_error);
+    CHECK_THROWS_AS(x += z, std::logic_error);
+}
@@ -0,0 +1,152 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/math/symmetric_matrix.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/view/indices.hpp>
+
+TEST_CASE("symmetric_matrix : storage and access")
+{
+    using Value = int;
+
+    grabin::symmetric_matrix<Value> A(4);
+
+    CHECK(A.dim() == std::make_pair(std::ptrdiff_t(4), std::ptrdiff_t(4)));
+    CHECK(A.packed_size() == 10);
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(grabin::as_const(A)(i, j) == 0);
+    }
+
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    for(auto const & i : grabin::view::indices(j + 1))
+    {
+        A(i, j) = 10 * i + j;
+    }
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CAPTURE(i, j);
+        CHECK(&A(i, j) == &A(j, i));
+        CHECK(A(i, j) == 10 * std::min(i, j) + std::max(i, j));
+    }
+
+    // Упакованный формат: верхний треугольник по столбцам
+    CHECK(std::vector<Value>(A.packed_data(), A.packed_data() + A.packed_size())
+          == (std::vector<Value>{0, 1, 11, 2, 12, 22, 3, 13, 23, 33}));
+
+    auto const D = A.dense();
+
+    REQUIRE(D.dim() == A.dim());
+
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        CHECK(D(i, j) == A(i, j));
+    }
+
+    CHECK_THROWS_AS(A(4, 0), std::out_of_range);
+    CHECK_THROWS_AS(A(0, -1), std::out_of_range);
+}
+
+TEST_CASE("symmetric_matrix : linear operations")
+{
+    using Value = double;
+    using Matrix = grabin::symmetric_matrix<Value>;
+
+    Matrix A(3);
+    Matrix B(3);
+
+    for(auto const & j : grabin::view::indices(3))
+    for(auto const & i : grabin::view::indices(j + 1))
+    {
+        A(i, j) = i + 2 * j;
+        B(i, j) = 1 - i * j;
+    }
+
+    auto const sum = A + B;
+    auto const diff = A - B;
+    auto const scaled = 2.0 * A;
+    auto const divided = A / 4.0;
+
+    for(auto const & i : grabin::view::indices(3))
+    for(auto const & j : grabin::view::indices(3))
+    {
+        CHECK(sum(i, j) == A(i, j) + B(i, j));
+        CHECK(diff(i, j) == A(i, j) - B(i, j));
+        CHECK(scaled(i, j) == 2 * A(i, j));
+        CHECK(divided(i, j) == A(i, j) / 4);
+    }
+
+    CHECK(A * 2.0 == scaled);
+    CHECK(A != B);
+    CHECK(A == Matrix(A));
+
+    CHECK_THROWS_AS(A += Matrix(2), std::logic_error);
+    CHECK_THROWS_AS(A /= 0.0, std::logic_error);
+}
+
+TEST_CASE("symmetric_matrix : rank one update and product with vector")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    for(auto n : {0, 1, 2, 5, 17})
+    {
+        CAPTURE(n);
+
+        std::uniform_int_distribution<int> distr(-10, 10);
+        auto & rnd = grabin_test::random_engine();
+
+        Vector x(n);
+        Vector y(n);
+        grabin::generate(x, [&]{ return Value(distr(rnd)); });
+        grabin::generate(y, [&]{ return Value(distr(rnd)); });
+
+        grabin::symmetric_matrix<Value> A(n);
+        A.rank_one_update(2.0, x);
+        A.rank_one_update(-1.0, y);
+
+        // Сравнение с плотной матрицей
+        auto const dense = 2.0 * grabin::linear_algebra::outer_product{}(x, x)
+                         + (-1.0) * grabin::linear_algebra::outer_product{}(y, y);
+
+        CHECK(A.dense() == dense);
+
+        auto const z = x + y;
+
+        CHECK(A * z == dense * z);
+        CHECK(A * (x - y) == dense * (x - y));
+
+        // Внешнее произведение коллинеарных векторов
+        auto const xx = grabin::linear_algebra::symmetric_outer_product{}(x, Vector(3.0 * x));
+
+        CHECK(xx.dense() == 3.0 * grabin::linear_algebra::outer_product{}(x, x));
+    }
+
+    grabin::symmetric_matrix<Value> A(3);
+
+    CHECK_THROWS_AS(A.rank_one_update(1.0, Vector(2)), std::logic_error);
+    CHECK_THROWS_AS(A * Vector(4), std::logic_error);
+}
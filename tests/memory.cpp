@@ -0,0 +1,130 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/memory.hpp>
+
+#include <catch2/catch.hpp>
+#include "grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("aligned_allocator: alignment")
+{
+    using Value = double;
+    constexpr auto alignment = std::size_t(64);
+    using Allocator = grabin::aligned_allocator<Value, alignment>;
+
+    static_assert(Allocator::alignment == alignment, "");
+
+    auto property = [](grabin_test::container_size<std::size_t> n)
+    {
+        Allocator alloc;
+
+        auto const p = alloc.allocate(n + 1);
+
+        CHECK(reinterpret_cast<std::uintptr_t>(p) % alignment == 0);
+
+        // Память должна быть доступна для записи и чтения
+        for(auto i = std::size_t(0); i != n + 1; ++ i)
+        {
+            p[i] = Value(i);
+        }
+        for(auto i = std::size_t(0); i != n + 1; ++ i)
+        {
+            CHECK(p[i] == Value(i));
+        }
+
+        alloc.deallocate(p, n + 1);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("aligned_allocator: std::vector")
+{
+    using Value = int;
+    using Allocator = grabin::aligned_allocator<Value, 128>;
+
+    auto property = [](std::vector<Value> const & src)
+    {
+        std::vector<Value, Allocator> xs(src.begin(), src.end());
+
+        CHECK(grabin::equal(xs, src));
+
+        xs.push_back(42);
+        CHECK(reinterpret_cast<std::uintptr_t>(xs.data()) % 128 == 0);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("aligned_allocator: equality and rebind")
+{
+    using Allocator = grabin::aligned_allocator<double>;
+    using Other = std::allocator_traits<Allocator>::rebind_alloc<char>;
+
+    static_assert(std::is_same<Other, grabin::aligned_allocator<char>>::value, "");
+
+    Allocator const a1;
+    Other const a2(a1);
+
+    CHECK(a1 == a2);
+    CHECK_FALSE(a1 != a2);
+}
+
+namespace
+{
+    // Тип, позволяющий отличить инициализацию по умолчанию от инициализации значением
+    struct init_kind
+    {
+        init_kind()
+         : value_initialized(false)
+        {}
+
+        init_kind(int)
+         : value_initialized(true)
+        {}
+
+        bool value_initialized;
+    };
+}
+
+TEST_CASE("default_init_allocator")
+{
+    using Allocator = grabin::default_init_allocator<grabin::aligned_allocator<init_kind>>;
+    using Other = std::allocator_traits<Allocator>::rebind_alloc<int>;
+
+    static_assert(std::is_same<Other, grabin::default_init_allocator<grabin::aligned_allocator<int>>>::value, "");
+
+    // Создание без аргументов
+    std::vector<init_kind, Allocator> xs(5);
+    CHECK(grabin::none_of(xs, [](init_kind const & x) { return x.value_initialized; }));
+    CHECK(reinterpret_cast<std::uintptr_t>(xs.data()) % 64 == 0);
+
+    // Создание с аргументами передаётся исходному распределителю
+    xs.emplace_back(1);
+    xs.resize(7);
+    CHECK(xs[5].value_initialized);
+    CHECK_FALSE(xs[6].value_initialized);
+
+    // Значения по-прежнему копируются
+    std::vector<int, Other> const ys(3, 42);
+    CHECK(ys == (std::vector<int, Other>{42, 42, 42}));
+}
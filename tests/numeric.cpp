@@ -22,6 +22,10 @@ Grabin -- это свободной программное обеспечени
 #include "../istream_sequence.hpp"
 
 #include <forward_list>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 TEST_CASE("iota")
 {
@@ -151,3 +155,112 @@ TEST_CASE("reduce with custom operations")
 
     grabin_test::check(property);
 }
+
+TEST_CASE("parallel reduce")
+{
+    using Value = int;
+
+    auto property = [](std::vector<Value> const & xs, Value const & init_value)
+    {
+        // Маленький размер блока, чтобы даже короткие последовательности делились на блоки
+        grabin::execution::parallel_policy const policy(4, 3);
+
+        auto const r_std = std::accumulate(xs.begin(), xs.end(), init_value);
+
+        CHECK(grabin::reduce(policy, xs, init_value) == r_std);
+        CHECK(grabin::reduce(grabin::execution::seq, xs, init_value) == r_std);
+
+        auto const op = [](Value const & x, Value const & y) { return std::max(x, y); };
+
+        auto const r_max = std::accumulate(xs.begin(), xs.end(), init_value, op);
+
+        CHECK(grabin::reduce(policy, xs, init_value, op) == r_max);
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("parallel reduce: result does not depend on number of threads")
+{
+    std::uniform_real_distribution<double> distr(-1.0, 1.0);
+
+    std::vector<double> xs(100003);
+    for(auto & x : xs)
+    {
+        x = distr(grabin_test::random_engine());
+    }
+
+    auto const grain = 1000;
+    auto const r1 = grabin::reduce(grabin::execution::parallel_policy(1, grain), xs);
+
+    for(auto threads : {2, 3, 8, 200})
+    {
+        CAPTURE(threads);
+
+        CHECK(grabin::reduce(grabin::execution::parallel_policy(threads, grain), xs) == r1);
+    }
+
+    CHECK(grabin::reduce(grabin::execution::par, xs) == Approx(grabin::reduce(xs)));
+    CHECK(r1 == Approx(grabin::reduce(xs)));
+}
+
+TEST_CASE("parallel reduce: exceptions are propagated")
+{
+    std::vector<int> const xs(1000, 1);
+
+    auto const op = [](int x, int y)
+    {
+        if(x + y > 700)
+        {
+            throw std::overflow_error("too large");
+        }
+
+        return x + y;
+    };
+
+    grabin::execution::parallel_policy const policy(4, 10);
+
+    CHECK_THROWS_AS(grabin::reduce(policy, xs, 0, op), std::overflow_error);
+}
+
+TEST_CASE("parallel reduce: concurrent calls")
+{
+    std::vector<int> const xs(1000, 1);
+
+    grabin::execution::parallel_policy const policy(4, 10);
+
+    std::vector<int> results(3);
+    std::vector<std::thread> threads;
+
+    for(auto index = 0; index < 3; ++ index)
+    {
+        threads.emplace_back([&, index]
+        {
+            for(auto generation = 0; generation < 50; ++ generation)
+            {
+                results[index] += grabin::reduce(policy, xs);
+            }
+        });
+    }
+
+    for(auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(results == std::vector<int>(3, 50 * 1000));
+}
+
+TEST_CASE("parallel reduce: nested calls")
+{
+    std::vector<int> const xs(100, 1);
+
+    grabin::execution::parallel_policy const policy(4, 5);
+
+    auto const op = [&](int x, int y)
+    {
+        return x + y + grabin::reduce(policy, xs) - 100;
+    };
+
+    CHECK(grabin::reduce(policy, xs, 0, op) == 100);
+}
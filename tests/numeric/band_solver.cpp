@@ -0,0 +1,130 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/numeric/band_solver.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/math/band_matrix.hpp>
+#include <grabin/math/matrix.hpp>
+#include <grabin/numeric/dense_factorization.hpp>
+
+namespace
+{
+    // Случайная ленточная матрица с диагональным преобладанием
+    grabin::band_matrix<double>
+    make_random_band_matrix(std::ptrdiff_t n, std::ptrdiff_t kl, std::ptrdiff_t ku)
+    {
+        std::uniform_real_distribution<double> distr(-1, 1);
+        auto & rnd = grabin_test::random_engine();
+
+        grabin::band_matrix<double> A(n, kl, ku);
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            for(auto const & j : grabin::view::indices(n))
+            {
+                if(i != j && A.in_band(i, j))
+                {
+                    A(i, j) = distr(rnd);
+                }
+            }
+
+            A(i, i) = (kl + ku + 1) * (distr(rnd) < 0 ? -1.0 : 1.0);
+        }
+
+        return A;
+    }
+}
+
+TEST_CASE("band LU-solver")
+{
+    using Vector = grabin::math_vector<double>;
+
+    for(auto n : {0, 1, 2, 7, 40})
+    for(auto kl : {0, 1, 3})
+    for(auto ku : {0, 2, 5})
+    {
+        CAPTURE(n, kl, ku);
+
+        auto const A = make_random_band_matrix(n, kl, ku);
+
+        // Плотная копия для сравнения с LU_solver
+        grabin::matrix<double> D(n, n);
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            D(i, j) = A(i, j);
+        }
+
+        Vector x(n);
+        std::uniform_real_distribution<double> distr(-10, 10);
+        grabin::generate(x, [&]{ return distr(grabin_test::random_engine()); });
+
+        auto const b = A * x;
+
+        auto const x1 = grabin::linear_algebra::band_LU_solver{}(A, b);
+        auto const x2 = grabin::linear_algebra::LU_solver{}(D, b);
+
+        CHECK_THAT(x1, grabin_test::Matchers::elementwise_within_abs(x, 1e-9));
+        CHECK_THAT(x1, grabin_test::Matchers::elementwise_within_abs(x2, 1e-9));
+
+        if(kl <= 1 && ku <= 1)
+        {
+            auto const x3 = grabin::linear_algebra::tridiagonal_solver{}(A, b);
+            CHECK_THAT(x3, grabin_test::Matchers::elementwise_within_abs(x, 1e-9));
+        }
+        else
+        {
+            CHECK_THROWS_AS(grabin::linear_algebra::tridiagonal_solver{}(A, b), std::logic_error);
+        }
+    }
+}
+
+TEST_CASE("band LU-solver: errors")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const n = 5;
+
+    grabin::band_matrix<double> A(n, 1, 1);
+
+    for(auto const & i : grabin::view::indices(n))
+    {
+        A(i, i) = 4.0;
+
+        if(i + 1 < n)
+        {
+            A(i, i + 1) = 1.0;
+            A(i + 1, i) = 1.0;
+        }
+    }
+
+    CHECK_THROWS_AS(grabin::linear_algebra::band_LU_solver{}(A, Vector(n + 1)), std::logic_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::tridiagonal_solver{}(A, Vector(n - 1)), std::logic_error);
+
+    // Ведущий минор второго порядка вырожден, поэтому без выбора ведущего
+    // элемента на втором шаге исключения получается нулевой элемент
+    A(0, 0) = 1.0;
+    A(1, 1) = 1.0;
+
+    auto const b = Vector(n, 1.0);
+
+    CHECK_THROWS_AS(grabin::linear_algebra::band_LU_solver{}(A, b), std::domain_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::tridiagonal_solver{}(A, b), std::domain_error);
+}
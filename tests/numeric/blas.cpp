@@ -0,0 +1,478 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/numeric/blas.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/math/matrix_view.hpp>
+#include <grabin/numeric.hpp>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    template <class Value>
+    grabin::math_vector<Value> make_random_vector(std::ptrdiff_t n)
+    {
+        std::uniform_int_distribution<int> distr(-20, 20);
+        grabin::math_vector<Value> result(n);
+        grabin::generate(result, [&]{ return Value(distr(grabin_test::random_engine())); });
+        return result;
+    }
+
+    // Выражение не имеет функции-члена data(), поэтому используется обобщённая реализация
+    template <class Value>
+    void check_blas()
+    {
+        namespace la = grabin::linear_algebra;
+
+        for(auto n = 0; n < 40; ++ n)
+        {
+            auto const x = make_random_vector<Value>(n);
+            auto const y_old = make_random_vector<Value>(n);
+            auto const x_expr = x + grabin::math_vector<Value>(n);
+
+            CAPTURE(n, x, y_old);
+
+            // axpy
+            auto y = y_old;
+            la::axpy(3, x, y);
+            CHECK(y == y_old + Value(3) * x);
+
+            y = y_old;
+            la::axpy(3, x_expr, y);
+            CHECK(y == y_old + Value(3) * x);
+
+            // scal
+            y = y_old;
+            la::scal(-2, y);
+            CHECK(y == Value(-2) * y_old);
+
+            // asum
+            auto expected_asum = Value(0);
+            for(auto const & xi : x)
+            {
+                expected_asum += std::abs(xi);
+            }
+            CHECK(la::asum(x) == expected_asum);
+            CHECK(la::asum(x_expr) == expected_asum);
+
+            // nrm2
+            auto const expected_nrm2 = std::sqrt(grabin::inner_product(x, x, Value(0)));
+            CHECK(la::nrm2(x) == Approx(expected_nrm2));
+            CHECK(la::nrm2(x_expr) == Approx(expected_nrm2));
+
+            // iamax
+            auto const k = la::iamax(x);
+            if(n == 0)
+            {
+                CHECK(k == -1);
+            }
+            else
+            {
+                for(auto i = 0; i < n; ++ i)
+                {
+                    CHECK(std::abs(x[i]) <= std::abs(x[k]));
+
+                    if(i < k)
+                    {
+                        CHECK(std::abs(x[i]) < std::abs(x[k]));
+                    }
+                }
+            }
+
+            // swap и copy
+            auto x1 = x;
+            y = y_old;
+            la::swap(x1, y);
+            CHECK(x1 == y_old);
+            CHECK(y == x);
+
+            la::copy(x_expr, y);
+            CHECK(y == x);
+            la::copy(y_old, y);
+            CHECK(y == y_old);
+
+            // rot
+            x1 = x;
+            y = y_old;
+            la::rot(x1, y, Value(0), Value(1));
+            CHECK(x1 == y_old);
+            CHECK(y == Value(-1) * x);
+        }
+    }
+}
+
+TEST_CASE("BLAS-1: double")
+{
+    check_blas<double>();
+}
+
+TEST_CASE("BLAS-1: float")
+{
+    check_blas<float>();
+}
+
+TEST_CASE("BLAS-1: int")
+{
+    namespace la = grabin::linear_algebra;
+
+    grabin::math_vector<int> x{3, -7, 7, 2};
+    grabin::math_vector<int> y{1, 1, 1, 1};
+
+    la::axpy(2, x, y);
+    CHECK(y == (grabin::math_vector<int>{7, -13, 15, 5}));
+    CHECK(la::asum(x) == 19);
+    CHECK(la::iamax(x) == 1);
+    CHECK(la::nrm2(grabin::math_vector<int>{3, 4}) == 5);
+    CHECK(la::nrm2(grabin::math_vector<int>{}) == 0);
+}
+
+namespace
+{
+    template <class Vector1, class Vector2, class = void>
+    struct is_blas_swappable
+     : std::false_type
+    {};
+
+    template <class Vector1, class Vector2>
+    struct is_blas_swappable<Vector1, Vector2,
+                             decltype(grabin::linear_algebra::swap(std::declval<Vector1>(),
+                                                                   std::declval<Vector2>()))>
+     : std::true_type
+    {};
+
+    // Тип с функцией-членом dim, не являющийся вектором
+    struct has_dim
+    {
+        std::ptrdiff_t dim() const
+        {
+            return 0;
+        }
+    };
+}
+
+TEST_CASE("BLAS-1: swap accepts only vectors")
+{
+    using Vector = grabin::math_vector<double>;
+
+    static_assert(is_blas_swappable<Vector &, Vector &>::value, "");
+    static_assert(is_blas_swappable<Vector &, grabin::math_vector_view<double>>::value, "");
+    static_assert(!is_blas_swappable<has_dim &, has_dim &>::value, "");
+    static_assert(!is_blas_swappable<int &, int &>::value, "");
+}
+
+TEST_CASE("BLAS-1: dimensions mismatch")
+{
+    namespace la = grabin::linear_algebra;
+
+    grabin::math_vector<double> x(3);
+    grabin::math_vector<double> y(4);
+
+    CHECK_THROWS_AS(la::axpy(1.0, x, y), std::logic_error);
+    CHECK_THROWS_AS(la::swap(x, y), std::logic_error);
+    CHECK_THROWS_AS(la::copy(x, y), std::logic_error);
+    CHECK_THROWS_AS(la::rot(x, y, 1.0, 0.0), std::logic_error);
+}
+
+TEST_CASE("BLAS-1: nrm2 does not overflow or underflow")
+{
+    namespace la = grabin::linear_algebra;
+    using Value = double;
+
+    auto const big = std::numeric_limits<Value>::max() / 4;
+    grabin::math_vector<Value> const x{big, big, big, big};
+    CHECK(la::nrm2(x) == Approx(2 * big));
+
+    auto const small = std::numeric_limits<Value>::min();
+    grabin::math_vector<Value> const y{3 * small, 4 * small};
+    CHECK(la::nrm2(y) == Approx(5 * small));
+
+    CHECK(la::nrm2(grabin::math_vector<Value>(5)) == 0);
+    CHECK(la::nrm2(grabin::math_vector<Value>{}) == 0);
+}
+
+TEST_CASE("BLAS-1: Givens rotation")
+{
+    namespace la = grabin::linear_algebra;
+    using Value = double;
+
+    auto property = [](Value const & a, Value const & b)
+    {
+        if(!std::isfinite(std::hypot(a, b)))
+        {
+            return;
+        }
+
+        auto const g = la::rotg(a, b);
+
+        CHECK(g.c * g.c + g.s * g.s == Approx(1.0));
+
+        grabin::math_vector<Value> x{a};
+        grabin::math_vector<Value> y{b};
+        la::rot(x, y, g.c, g.s);
+
+        CHECK(x[0] == Approx(g.r));
+        CHECK(std::abs(y[0]) <= 1e-12 * std::abs(g.r));
+    };
+
+    grabin_test::check(property);
+}
+
+TEST_CASE("BLAS-1: rows of matrix views")
+{
+    namespace la = grabin::linear_algebra;
+
+    std::vector<double> buffer{1, 2, 3, 0,
+                               4, 5, 6, 0};
+    grabin::matrix_view<double> const A(buffer.data(), 2, 3, 4);
+
+    la::axpy(-4.0, A.row(0), A.row(1));
+    la::scal(0.5, A.row(0));
+
+    CHECK(buffer == (std::vector<double>{0.5, 1, 1.5, 0, 0, -3, -6, 0}));
+}
+
+TEST_CASE("BLAS-3: gemm")
+{
+    namespace la = grabin::linear_algebra;
+
+    grabin::matrix<double> A(2, 3);
+    grabin::iota(A, 1);
+
+    // B -- подматрица 3 x 2 внешнего буфера
+    std::vector<double> b_buffer{1,  0, 9,
+                                 0,  1, 9,
+                                 1, -1, 9};
+    grabin::matrix_view<double const> const B(b_buffer.data(), 3, 2, 3);
+
+    grabin::matrix<double> C(2, 2);
+    grabin::fill(C, 1.0);
+
+    la::gemm(2.0, A, B, -1.0, C);
+
+    CHECK(C(0, 0) == 7);
+    CHECK(C(0, 1) == -3);
+    CHECK(C(1, 0) == 19);
+    CHECK(C(1, 1) == -3);
+
+    la::gemm(1.0, A, B, 0.0, C);
+
+    CHECK(C(0, 0) == 4);
+    CHECK(C(1, 0) == 10);
+
+    CHECK_THROWS_AS(la::gemm(1.0, A, A, 0.0, C), std::logic_error);
+}
+
+TEST_CASE("BLAS-2: gemv")
+{
+    namespace la = grabin::linear_algebra;
+
+    // A -- подматрица 2 x 3 внешнего буфера
+    std::vector<double> a_buffer{1, 2, 3, 9,
+                                 4, 5, 6, 9};
+    grabin::matrix_view<double const> const A(a_buffer.data(), 2, 3, 4);
+
+    grabin::math_vector<double> const x{1, 0, -1};
+    grabin::math_vector<double> y{1, 2};
+
+    la::gemv(2.0, A, x, 3.0, y);
+
+    CHECK(y == (grabin::math_vector<double>{-1, 2}));
+
+    grabin::math_vector<double> const u{1, -1};
+    grabin::math_vector<double> z{1, 1, 1};
+
+    la::gemv_t(1.0, A, u, -1.0, z);
+
+    CHECK(z == (grabin::math_vector<double>{-4, -4, -4}));
+
+    // Строка матрицы как изменяемый вектор
+    std::vector<double> b_buffer(4, 7.0);
+    grabin::matrix_view<double> const B(b_buffer.data(), 2, 2);
+    la::gemv(1.0, A, x, 0.0, B.row(1));
+
+    CHECK(b_buffer == (std::vector<double>{7, 7, -2, -2}));
+
+    CHECK_THROWS_AS(la::gemv(1.0, A, y, 0.0, y), std::logic_error);
+    CHECK_THROWS_AS(la::gemv_t(1.0, A, x, 0.0, z), std::logic_error);
+}
+
+TEST_CASE("BLAS: column-major matrices")
+{
+    namespace la = grabin::linear_algebra;
+
+    using Matrix_c = grabin::matrix<double, grabin::math_vector_throws_check_policy,
+                                    std::allocator<double>, grabin::column_major>;
+
+    Matrix_c A(2, 3);
+    A(0, 0) = 1; A(0, 1) = 2; A(0, 2) = 3;
+    A(1, 0) = 4; A(1, 1) = 5; A(1, 2) = 6;
+
+    grabin::math_vector<double> y{1, 2};
+    la::gemv(2.0, A, grabin::math_vector<double>{1, 0, -1}, 3.0, y);
+
+    CHECK(y == (grabin::math_vector<double>{-1, 2}));
+
+    grabin::math_vector<double> z{1, 1, 1};
+    la::gemv_t(1.0, A, grabin::math_vector<double>{1, -1}, -1.0, z);
+
+    CHECK(z == (grabin::math_vector<double>{-4, -4, -4}));
+
+    // C = A * A^T, где A^T задана в виде матрицы, хранящейся по строкам
+    grabin::matrix<double> At(3, 2);
+    for(auto i = 0; i < 2; ++ i)
+    for(auto j = 0; j < 3; ++ j)
+    {
+        At(j, i) = A(i, j);
+    }
+
+    Matrix_c C(2, 2);
+    la::gemm(1.0, A, At, 0.0, C);
+
+    CHECK(C(0, 0) == 14);
+    CHECK(C(0, 1) == 32);
+    CHECK(C(1, 0) == 32);
+    CHECK(C(1, 1) == 77);
+}
+
+TEST_CASE("BLAS: transposed views")
+{
+    namespace la = grabin::linear_algebra;
+
+    grabin::matrix<double> A(2, 3);
+    grabin::iota(A, 1);
+
+    // C = A^T * A без копирования A^T
+    grabin::matrix<double> C(3, 3);
+    la::gemm(1.0, A.transposed(), A, 0.0, C);
+
+    CHECK(C == grabin::transpose(A) * A);
+    CHECK(C(0, 0) == 17);
+    CHECK(C(1, 2) == 36);
+
+    // y = A^T * x
+    grabin::math_vector<double> y(3);
+    la::gemv(1.0, A.transposed(), grabin::math_vector<double>{1, -1}, 0.0, y);
+
+    CHECK(y == (grabin::math_vector<double>{-3, -3, -3}));
+
+    // Результат может быть транспонированным представлением
+    grabin::matrix<double> D(3, 3);
+    la::gemm(1.0, A, A.transposed(), 0.0, D.block(0, 0, 2, 2).transposed());
+
+    CHECK(D(0, 0) == 14);
+    CHECK(D(0, 1) == 32);
+    CHECK(D(2, 2) == 0);
+}
+
+#include <grabin/math/symmetric_matrix.hpp>
+
+TEST_CASE("BLAS-2: packed symmetric matrices")
+{
+    namespace la = grabin::linear_algebra;
+
+    using Value = double;
+
+    for(auto n : {0, 1, 3, 8, 21})
+    {
+        CAPTURE(n);
+
+        auto const x = make_random_vector<Value>(n);
+        auto const u = make_random_vector<Value>(n);
+
+        grabin::symmetric_matrix<Value> A(n);
+        la::spr(3, x, A);
+        la::spr(-2, u, A);
+
+        auto const D = A.dense();
+
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            CHECK(D(i, j) == 3 * x[i] * x[j] - 2 * u[i] * u[j]);
+        }
+
+        // y = alpha*A*x + beta*y
+        auto y1 = make_random_vector<Value>(n);
+        auto y2 = y1;
+
+        la::spmv(2.0, A, x, -1.0, y1);
+        la::gemv(2.0, D, x, -1.0, y2);
+
+        CHECK(y1 == y2);
+
+        // Обобщённая реализация для векторов без data(): столбцы матрицы
+        grabin::matrix<Value> E(n, 3);
+        la::copy(x, E.col(2));
+
+        la::spmv(1.0, A, E.col(2), 0.0, E.col(0));
+        la::gemv(1.0, D, x, 0.0, E.col(1));
+
+        CHECK(E.col(0) == E.col(1));
+
+        grabin::symmetric_matrix<Value> B(n);
+        la::spr(3, E.col(2), B);
+        la::spr(-2, u, B);
+
+        CHECK(B == A);
+    }
+
+    grabin::symmetric_matrix<Value> A(3);
+    grabin::math_vector<Value> y(2);
+
+    CHECK_THROWS_AS(la::spr(1.0, y, A), std::logic_error);
+    CHECK_THROWS_AS(la::spmv(1.0, A, y, 0.0, y), std::logic_error);
+}
+
+TEST_CASE("BLAS-2: scalars of different types")
+{
+    namespace la = grabin::linear_algebra;
+
+    grabin::matrix<double> A(2, 2);
+    grabin::iota(A, 1);
+
+    grabin::math_vector<double> const x{1, -1};
+    grabin::math_vector<double> y{1, 2};
+
+    la::gemv(-1, A, x, 1.0, y);
+    CHECK(y == (grabin::math_vector<double>{2, 3}));
+
+    la::gemv_t(2.0f, A, x, 0, y);
+    CHECK(y == (grabin::math_vector<double>{-4, -4}));
+
+    grabin::matrix<double> C(2, 2);
+    la::gemm(1, A, A, 0.0, C);
+    CHECK(C(0, 0) == 7);
+    CHECK(C(1, 1) == 22);
+
+    grabin::symmetric_matrix<double> S(2);
+    la::spr(1, x, S);
+    la::spmv(2, S, x, 0.5, y);
+    CHECK(y == (grabin::math_vector<double>{2, -6}));
+
+    grabin::math_vector<double> z{1, 1};
+    la::rot(y, z, 0, 1.0);
+    CHECK(y == (grabin::math_vector<double>{1, 1}));
+    CHECK(z == (grabin::math_vector<double>{-2, 6}));
+}
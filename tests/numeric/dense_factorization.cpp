@@ -0,0 +1,638 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/numeric/dense_factorization.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/math/matrix.hpp>
+
+TEST_CASE("LU-solver: column-major matrix")
+{
+    using Value = double;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+    using Vector = grabin::math_vector<Value>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1, 1);
+
+    for(auto n = 1; n < 20; ++ n)
+    {
+        CAPTURE(n);
+
+        // Матрица с диагональным преобладанием
+        Matrix_r A_r(n, n);
+        Matrix_c A_c(n, n);
+        Vector b(n);
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            for(auto const & j : grabin::view::indices(n))
+            {
+                A_c(i, j) = A_r(i, j) = distr(rnd) + (i == j ? n : 0);
+            }
+
+            b[i] = distr(rnd);
+        }
+
+        auto const x_r = grabin::linear_algebra::LU_solver{}(A_r, b);
+        auto const x_c = grabin::linear_algebra::LU_solver{}(A_c, b);
+
+        CHECK_THAT(x_c, grabin_test::Matchers::elementwise_within_abs(x_r, 1e-12));
+        CHECK_THAT(Vector(A_c * x_c), grabin_test::Matchers::elementwise_within_abs(b, 1e-10));
+    }
+}
+
+TEST_CASE("lu_factorization: solve many systems with the same matrix")
+{
+    using Value = double;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+    using Vector = grabin::math_vector<Value>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1, 1);
+
+    for(auto n : {1, 2, 5, 17})
+    {
+        CAPTURE(n);
+
+        // Матрица с диагональным преобладанием
+        Matrix_r A(n, n);
+        Matrix_c A_c(n, n);
+
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            A_c(i, j) = A(i, j) = distr(rnd) + (i == j ? n : 0);
+        }
+
+        auto const lu = grabin::linear_algebra::make_lu_factorization(A);
+        auto const lu_c = grabin::linear_algebra::make_lu_factorization(A_c);
+
+        static_assert(std::is_same<decltype(lu)::matrix_type, Matrix_r>::value, "");
+        REQUIRE(lu.dim() == n);
+
+        // Несколько правых частей по очереди
+        for(auto k = 0; k < 3; ++ k)
+        {
+            Vector b(n);
+            grabin::generate(b, [&]{ return distr(rnd); });
+
+            auto const x = lu.solve(b);
+
+            CHECK_THAT(x, grabin_test::Matchers::elementwise_within_abs(grabin::linear_algebra::LU_solver{}(A, b), 1e-14));
+            CHECK_THAT(Vector(A * x), grabin_test::Matchers::elementwise_within_abs(b, 1e-10));
+            CHECK_THAT(lu_c.solve(b), grabin_test::Matchers::elementwise_within_abs(x, 1e-12));
+
+            auto y = b;
+            lu.solve_in_place(y);
+            CHECK(y == x);
+        }
+
+        // Все правые части одновременно
+        auto const m = 4;
+        Matrix_r B(n, m);
+        grabin::generate(B, [&]{ return distr(rnd); });
+
+        Matrix_c B_c(n, m);
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(m))
+        {
+            B_c(i, j) = B(i, j);
+        }
+
+        auto const X = lu.solve(B);
+        auto const X_c = lu_c.solve(B_c);
+
+        REQUIRE(X.dim() == B.dim());
+
+        for(auto const & j : grabin::view::indices(m))
+        {
+            Vector b(n);
+            for(auto const & i : grabin::view::indices(n))
+            {
+                b[i] = B(i, j);
+            }
+
+            auto const x = lu.solve(b);
+
+            for(auto const & i : grabin::view::indices(n))
+            {
+                CHECK(X(i, j) == Approx(x[i]).margin(1e-12));
+                CHECK(X_c(i, j) == Approx(x[i]).margin(1e-12));
+            }
+        }
+
+        // Обратная матрица
+        auto const A_inv = lu.inverse();
+        auto const I = A * A_inv;
+
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            CHECK(I(i, j) == Approx(i == j ? 1.0 : 0.0).margin(1e-12));
+        }
+
+        CHECK_THROWS_AS(lu.solve(Vector(n + 1)), std::logic_error);
+        CHECK_THROWS_AS(lu.solve(Matrix_r(n + 1, 2)), std::logic_error);
+    }
+}
+
+TEST_CASE("lu_factorization: determinant")
+{
+    using Value = double;
+    using Matrix = grabin::matrix<Value>;
+
+    Matrix A(3, 3);
+    A(0, 0) = 2; A(0, 1) = 1; A(0, 2) = 1;
+    A(1, 0) = 4; A(1, 1) = 3; A(1, 2) = 3;
+    A(2, 0) = 8; A(2, 1) = 7; A(2, 2) = 9;
+
+    auto const lu = grabin::linear_algebra::make_lu_factorization(A);
+
+    CHECK(lu.determinant() == Approx(4.0));
+
+    // Множители L и U хранятся в одной матрице, P*A == L*U
+    auto const & LU = lu.factors();
+    auto const & p = lu.pivots();
+
+    REQUIRE(p.size() == 3);
+    CHECK(p[0] == 2);
+
+    auto PA = A;
+    for(auto const & k : grabin::view::indices(3))
+    for(auto const & j : grabin::view::indices(3))
+    {
+        std::swap(PA(k, j), PA(p[k], j));
+    }
+
+    for(auto const & i : grabin::view::indices(3))
+    for(auto const & j : grabin::view::indices(3))
+    {
+        auto sum = (i <= j) ? LU(i, j) : LU(i, j) * LU(j, j);
+
+        for(auto const & k : grabin::view::indices(std::min(i, j)))
+        {
+            sum += LU(i, k) * LU(k, j);
+        }
+
+        CHECK(sum == Approx(PA(i, j)));
+    }
+
+    CHECK_THROWS_AS(grabin::linear_algebra::make_lu_factorization(Matrix(2, 3)), std::logic_error);
+}
+
+TEST_CASE("lu_factorization: small leading pivots")
+{
+    using Value = double;
+    using Matrix = grabin::matrix<Value>;
+    using Vector = grabin::math_vector<Value>;
+
+    // Без перестановки строк первый ведущий элемент равен нулю
+    Matrix A(2, 2);
+    A(0, 0) = 0; A(0, 1) = 1;
+    A(1, 0) = 1; A(1, 1) = 0;
+
+    Vector b(2);
+    b[0] = 3;
+    b[1] = 5;
+
+    auto const lu = grabin::linear_algebra::make_lu_factorization(A);
+
+    CHECK(!lu.is_singular());
+    CHECK(lu.determinant() == Approx(-1.0));
+
+    auto const x = lu.solve(b);
+    CHECK(x[0] == Approx(5.0));
+    CHECK(x[1] == Approx(3.0));
+
+    // Без перестановки строк решение теряет все значащие цифры
+    A(0, 0) = 1e-20; A(0, 1) = 1;
+    A(1, 0) = 1;     A(1, 1) = 1;
+
+    b[0] = 1;
+    b[1] = 2;
+
+    auto const y = grabin::linear_algebra::LU_solver{}(A, b);
+    CHECK(y[0] == Approx(1.0));
+    CHECK(y[1] == Approx(1.0));
+}
+
+TEST_CASE("lu_factorization: singular matrix")
+{
+    using Value = double;
+    using Matrix = grabin::matrix<Value>;
+    using Vector = grabin::math_vector<Value>;
+
+    Matrix A(3, 3);
+    A(0, 0) = 1; A(0, 1) = 2; A(0, 2) = 3;
+    A(1, 0) = 4; A(1, 1) = 5; A(1, 2) = 6;
+    A(2, 0) = 0; A(2, 1) = 0; A(2, 2) = 0;
+
+    auto const lu = grabin::linear_algebra::make_lu_factorization(A);
+
+    CHECK(lu.is_singular());
+    CHECK(lu.determinant() == 0.0);
+
+    CHECK_THROWS_AS(lu.solve(Vector(3)), std::domain_error);
+    CHECK_THROWS_AS(lu.solve(Matrix(3, 2)), std::domain_error);
+    CHECK_THROWS_AS(lu.inverse(), std::domain_error);
+}
+
+TEST_CASE("lu_factorization: blocked factorization of a large matrix")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1.0, 1.0);
+
+    // Размерность больше размера блока и не кратна ему
+    auto const n = 150;
+
+    Matrix_r A(n, n);
+    grabin::generate(A, [&]{ return distr(rnd); });
+
+    Matrix_c A_c(n, n);
+    for(auto const & i : grabin::view::indices(n))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        A_c(i, j) = A(i, j);
+    }
+
+    Vector b(n);
+    grabin::generate(b, [&]{ return distr(rnd); });
+
+    auto const lu = grabin::linear_algebra::make_lu_factorization(A);
+    auto const lu_c = grabin::linear_algebra::make_lu_factorization(A_c);
+
+    REQUIRE(!lu.is_singular());
+    CHECK(lu.pivots() == lu_c.pivots());
+    CHECK(lu.determinant() == Approx(lu_c.determinant()).epsilon(1e-10));
+
+    auto const x = lu.solve(b);
+    auto const x_c = lu_c.solve(b);
+
+    CHECK_THAT(Vector(A * x), grabin_test::Matchers::elementwise_within_abs(b, 1e-9));
+    CHECK_THAT(x_c, grabin_test::Matchers::elementwise_within_abs(x, 1e-9));
+}
+
+TEST_CASE("cholesky_factorization: agrees with LU")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1.0, 1.0);
+
+    // Последняя размерность больше размера блока и не кратна ему
+    for(auto n : {1, 2, 5, 17, 150})
+    {
+        CAPTURE(n);
+
+        auto const A = grabin_test::make_random_spd_matrix<Matrix_r>(n);
+        auto const A_c = grabin_test::make_random_spd_matrix<Matrix_c>(n);
+
+        Vector b(n);
+        grabin::generate(b, [&]{ return distr(rnd); });
+
+        auto const chol = grabin::linear_algebra::make_cholesky_factorization(A);
+        auto const chol_c = grabin::linear_algebra::make_cholesky_factorization(A_c);
+        auto const ldlt = grabin::linear_algebra::make_ldlt_factorization(A);
+        auto const ldlt_c = grabin::linear_algebra::make_ldlt_factorization(A_c);
+
+        REQUIRE(chol.is_positive_definite());
+        REQUIRE(chol_c.is_positive_definite());
+        CHECK(ldlt.rank() == n);
+        CHECK(ldlt.is_positive_semidefinite());
+
+        // Над диагональю множителя -- нули, A == L*L^T
+        auto const & L = chol.factors();
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            auto sum = 0.0;
+
+            for(auto const & k : grabin::view::indices(std::min(i, j) + 1))
+            {
+                sum += L(i, k) * L(j, k);
+            }
+
+            CHECK(sum == Approx(A(i, j)).margin(1e-10));
+
+            if(j > i)
+            {
+                CHECK(L(i, j) == 0.0);
+            }
+        }
+
+        auto const x = grabin::linear_algebra::LU_solver{}(A, b);
+
+        CHECK_THAT(chol.solve(b), grabin_test::Matchers::elementwise_within_abs(x, 1e-9));
+        CHECK_THAT(ldlt.solve(b), grabin_test::Matchers::elementwise_within_abs(x, 1e-9));
+        CHECK_THAT(Vector(A_c * chol_c.solve(b)), grabin_test::Matchers::elementwise_within_abs(b, 1e-9));
+        CHECK_THAT(Vector(A_c * ldlt_c.solve(b)), grabin_test::Matchers::elementwise_within_abs(b, 1e-9));
+        CHECK_THAT(grabin::linear_algebra::cholesky_solver{}(A, b),
+                   grabin_test::Matchers::elementwise_within_abs(x, 1e-9));
+
+        if(n <= 17)
+        {
+            auto const det = grabin::linear_algebra::make_lu_factorization(A).determinant();
+            CHECK(chol.determinant() == Approx(det).epsilon(1e-9));
+            CHECK(ldlt.determinant() == Approx(det).epsilon(1e-9));
+        }
+
+        CHECK_THROWS_AS(chol.solve(Vector(n + 1)), std::logic_error);
+        CHECK_THROWS_AS(ldlt.solve(Vector(n + 1)), std::logic_error);
+    }
+
+    CHECK_THROWS_AS(grabin::linear_algebra::make_cholesky_factorization(Matrix_r(2, 3)), std::logic_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::make_ldlt_factorization(Matrix_r(2, 3)), std::logic_error);
+}
+
+#include <grabin/math/symmetric_matrix.hpp>
+
+TEST_CASE("cholesky_factorization: packed symmetric matrix")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const n = 7;
+    auto const A = grabin_test::make_random_spd_matrix<grabin::matrix<Value>>(n);
+
+    grabin::symmetric_matrix<Value> S(n);
+    for(auto const & j : grabin::view::indices(n))
+    for(auto const & i : grabin::view::indices(j + 1))
+    {
+        S(i, j) = A(i, j);
+    }
+
+    Vector b(n);
+    for(auto const & i : grabin::view::indices(n))
+    {
+        b[i] = i + 1.0;
+    }
+
+    auto const x = grabin::linear_algebra::make_cholesky_factorization(A).solve(b);
+
+    CHECK_THAT(grabin::linear_algebra::cholesky_solver{}(S, b),
+               grabin_test::Matchers::elementwise_within_abs(x, 1e-12));
+    CHECK_THAT(grabin::linear_algebra::LDLT_solver{}(S, b),
+               grabin_test::Matchers::elementwise_within_abs(x, 1e-12));
+}
+
+TEST_CASE("cholesky_factorization: definiteness check")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    // Собственные числа 3 и -1
+    Matrix A(2, 2);
+    A(0, 0) = 1; A(0, 1) = 2;
+    A(1, 0) = 2; A(1, 1) = 1;
+
+    auto const chol = grabin::linear_algebra::make_cholesky_factorization(A);
+
+    CHECK(!chol.is_positive_definite());
+    CHECK_THROWS_AS(chol.solve(Vector(2)), std::domain_error);
+    CHECK_THROWS_AS(chol.determinant(), std::domain_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::cholesky_solver{}(A, Vector(2)), std::domain_error);
+
+    auto const ldlt = grabin::linear_algebra::make_ldlt_factorization(A);
+
+    CHECK(ldlt.rank() == 2);
+    CHECK(!ldlt.is_positive_semidefinite());
+    CHECK(ldlt.determinant() == Approx(-3.0));
+}
+
+TEST_CASE("ldlt_factorization: positive semidefinite matrix")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix_r = grabin::matrix<Value>;
+    using Matrix_c = grabin::matrix<Value, grabin::math_vector_throws_check_policy,
+                                    std::allocator<Value>, grabin::column_major>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1.0, 1.0);
+
+    // A = B*B^T, где B имеет r < n столбцов
+    for(auto n : {4, 100})
+    {
+        auto const r = n / 2;
+
+        CAPTURE(n, r);
+
+        Matrix_r B(n, r);
+        grabin::generate(B, [&]{ return distr(rnd); });
+
+        // Диагональное преобладание в первых r строках отделяет ненулевые
+        // собственные числа A от нуля, так что ранг определяется однозначно
+        for(auto const & k : grabin::view::indices(r))
+        {
+            B(k, k) += r;
+        }
+
+        Matrix_r A(n, n);
+        Matrix_c A_c(n, n);
+
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            auto sum = 0.0;
+
+            for(auto const & k : grabin::view::indices(r))
+            {
+                sum += B(i, k) * B(j, k);
+            }
+
+            A(i, j) = sum;
+            A_c(i, j) = sum;
+        }
+
+        // Совместная правая часть из образа A
+        Vector z(n);
+        grabin::generate(z, [&]{ return distr(rnd); });
+        Vector const b = A * z;
+
+        auto const ldlt = grabin::linear_algebra::make_ldlt_factorization(A);
+        auto const ldlt_c = grabin::linear_algebra::make_ldlt_factorization(A_c);
+
+        CHECK(ldlt.rank() == r);
+        CHECK(ldlt_c.rank() == r);
+        CHECK(ldlt.is_positive_semidefinite());
+
+        CHECK_THAT(Vector(A * ldlt.solve(b)), grabin_test::Matchers::elementwise_within_abs(b, 1e-8));
+        CHECK_THAT(Vector(A_c * ldlt_c.solve(b)), grabin_test::Matchers::elementwise_within_abs(b, 1e-8));
+    }
+}
+
+TEST_CASE("mixed_precision_lu_factorization: double accuracy from float factors")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1, 1);
+
+    auto const n = 150;
+
+    Matrix A(n, n);
+    grabin::generate(A, [&]{ return distr(rnd); });
+
+    for(auto const & i : grabin::view::indices(n))
+    {
+        A(i, i) += 2 * std::sqrt(Value(n));
+    }
+
+    Vector b(n);
+    grabin::generate(b, [&]{ return distr(rnd); });
+
+    auto const x_lu = la::LU_solver{}(A, b);
+
+    auto const lu = la::make_mixed_precision_lu_factorization(A);
+    CHECK(lu.dim() == n);
+
+    Vector x(n);
+    auto const report = lu.solve(b, x);
+
+    CAPTURE(report.iterations, report.backward_error);
+
+    CHECK(report.converged);
+    CHECK(!report.fallback);
+    CHECK(report.iterations > 0);
+    CHECK(report.iterations <= 5);
+    CHECK(report.backward_error <= std::numeric_limits<Value>::epsilon() * std::sqrt(Value(n)));
+
+    for(auto const & i : grabin::view::indices(n))
+    {
+        CHECK(x[i] == Approx(x_lu[i]).epsilon(1e-12).margin(1e-14));
+    }
+
+    // Повторное решение и функциональный объект
+    CHECK_THAT(lu.solve(b), grabin_test::Matchers::elementwise_within_abs(x, 1e-15));
+    CHECK_THAT(la::mixed_precision_LU_solver{}(A, b), grabin_test::Matchers::elementwise_within_abs(x, 1e-15));
+
+    // Ограничение количества итераций
+    la::refinement_options options;
+    options.max_iterations = 0;
+
+    auto const coarse = la::make_mixed_precision_lu_factorization(A, options);
+
+    Vector x_coarse(n);
+    auto const coarse_report = coarse.solve(b, x_coarse);
+
+    CHECK(coarse_report.iterations == 0);
+    CHECK(coarse_report.fallback);
+    CHECK(coarse_report.converged);
+
+    CHECK_THROWS_AS(lu.solve(Vector(n + 1)), std::logic_error);
+    CHECK_THROWS_AS(la::make_mixed_precision_lu_factorization(Matrix(2, 3)), std::logic_error);
+}
+
+TEST_CASE("mixed_precision_lu_factorization: fallback to full precision")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto check_fallback = [](Matrix const & A)
+    {
+        auto const n = A.dim1();
+
+        Vector b(n);
+        for(auto const & i : grabin::view::indices(n))
+        {
+            b[i] = Value(i + 1);
+        }
+
+        auto const x_lu = la::LU_solver{}(A, b);
+
+        auto const lu = la::make_mixed_precision_lu_factorization(A);
+
+        Vector x(n);
+        auto const report = lu.solve(b, x);
+
+        CAPTURE(A, report.iterations, report.backward_error);
+
+        CHECK(report.fallback);
+        CHECK(report.converged);
+        CHECK(report.backward_error <= std::numeric_limits<Value>::epsilon() * std::sqrt(Value(n)));
+        CHECK_THAT(x, grabin_test::Matchers::elementwise_within_abs(x_lu, 1e-15));
+
+        // Разложение с полной точностью используется и для следующих систем
+        auto const again = lu.solve(b, x);
+        CHECK(again.fallback);
+        CHECK(again.iterations == 0);
+    };
+
+    // Матрица Гильберта: число обусловленности больше 1 / FLT_EPSILON
+    {
+        auto const n = 9;
+
+        Matrix H(n, n);
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            H(i, j) = 1.0 / Value(i + j + 1);
+        }
+
+        check_fallback(H);
+    }
+
+    // Вырождена после округления до float
+    {
+        Matrix A(2, 2);
+        A(0, 0) = 1; A(0, 1) = 1;
+        A(1, 0) = 1; A(1, 1) = 1 + 1e-10;
+
+        check_fallback(A);
+    }
+
+    // Элементы не представимы во float
+    {
+        Matrix A(2, 2);
+        A(0, 0) = 1e300; A(0, 1) = 1;
+        A(1, 0) = 1;     A(1, 1) = 1e300;
+
+        check_fallback(A);
+    }
+
+    // Вырожденная матрица
+    Matrix Z(2, 2);
+    Z(0, 0) = Z(0, 1) = Z(1, 0) = Z(1, 1) = 1;
+
+    CHECK_THROWS_AS(la::make_mixed_precision_lu_factorization(Z).solve(Vector{1.0, 2.0}), std::domain_error);
+}
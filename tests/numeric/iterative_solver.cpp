@@ -0,0 +1,677 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/numeric/iterative_solver.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/math/matrix.hpp>
+#include <grabin/math/sparse_matrix.hpp>
+#include <grabin/stochastic/all.hpp>
+
+TEST_CASE("minimal_residue: options, initial guess and report")
+{
+    using Value = double;
+    using Matrix = grabin::matrix<Value>;
+    using Vector = grabin::math_vector<Value>;
+
+    Matrix A(3, 3);
+    A(0, 0) =  4; A(0, 1) = -1; A(0, 2) =  0;
+    A(1, 0) = -1; A(1, 1) =  4; A(1, 2) = -1;
+    A(2, 0) =  0; A(2, 1) = -1; A(2, 2) =  4;
+
+    Vector const x_exact{1.0, 2.0, 3.0};
+    Vector const b = A * x_exact;
+
+    grabin::linear_algebra::iterative_options options;
+    options.tolerance = 1e-12;
+
+    grabin::linear_algebra::iterative_workspace<Vector> workspace;
+
+    // Из нулевого начального приближения
+    Vector x(3);
+    auto const report = grabin::linear_algebra::minimal_residue(A, b, x, options, workspace);
+
+    CHECK(report.converged);
+    CHECK(report.iterations > 0);
+    CHECK(report.iterations <= options.max_iterations);
+    CHECK(report.residual <= options.tolerance * grabin::linear_algebra::nrm2(b));
+    CHECK_THAT(x, grabin_test::Matchers::elementwise_within_abs(x_exact, 1e-10));
+
+    // Точное начальное приближение: итерации не нужны, память не выделяется
+    REQUIRE(workspace.size() == 2);
+    auto const r_data = workspace[0].data();
+
+    x = x_exact;
+    auto const exact = grabin::linear_algebra::minimal_residue(A, b, x, options, workspace);
+
+    CHECK(exact.converged);
+    CHECK(exact.iterations == 0);
+    CHECK(exact.residual == 0.0);
+    CHECK(x == x_exact);
+    CHECK(workspace[0].data() == r_data);
+
+    // Ограничение количества итераций
+    options.max_iterations = 1;
+    Vector y(3);
+    auto const limited = grabin::linear_algebra::minimal_residue(A, b, y, options, workspace);
+
+    CHECK(!limited.converged);
+    CHECK(limited.iterations == 1);
+    CHECK(limited.residual > options.tolerance * grabin::linear_algebra::nrm2(b));
+    CHECK(workspace[0].data() == r_data);
+
+    // Абсолютный порог
+    options.max_iterations = 100;
+    options.tolerance = 0;
+    options.absolute_tolerance = 1e-3;
+
+    grabin::fill(y, 0.0);
+    auto const absolute = grabin::linear_algebra::minimal_residue(A, b, y, options);
+
+    CHECK(absolute.converged);
+    CHECK(absolute.residual <= 1e-3);
+    CHECK(absolute.iterations < report.iterations);
+
+    // Функциональный объект с параметрами
+    grabin::linear_algebra::minimal_residue_solver solver;
+    solver.options.tolerance = 1e-12;
+
+    CHECK_THAT(solver(A, b), grabin_test::Matchers::elementwise_within_abs(x_exact, 1e-10));
+
+    CHECK_THROWS_AS(grabin::linear_algebra::minimal_residue(A, b, Vector(2)), std::logic_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::minimal_residue(A, Vector(2), Vector(2)), std::logic_error);
+}
+
+namespace
+{
+    // Разностная аппроксимация оператора -u'' с нулевыми граничными условиями
+    grabin::csr_matrix<double> make_laplacian_1d(std::ptrdiff_t n)
+    {
+        grabin::csr_matrix_builder<double> builder(n, n);
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            if(i > 0)
+            {
+                builder.add(i, i - 1, -1.0);
+            }
+
+            builder.add(i, i, 2.0);
+
+            if(i + 1 < n)
+            {
+                builder.add(i, i + 1, -1.0);
+            }
+        }
+
+        return builder.build();
+    }
+
+    // Пятиточечная аппроксимация оператора Лапласа на сетке m x m
+    grabin::csr_matrix<double> make_laplacian_2d(std::ptrdiff_t m)
+    {
+        auto const n = m * m;
+
+        grabin::csr_matrix_builder<double> builder(n, n);
+
+        for(auto const & i : grabin::view::indices(m))
+        for(auto const & j : grabin::view::indices(m))
+        {
+            auto const row = i * m + j;
+
+            builder.add(row, row, 4.0);
+
+            if(i > 0)     { builder.add(row, row - m, -1.0); }
+            if(i + 1 < m) { builder.add(row, row + m, -1.0); }
+            if(j > 0)     { builder.add(row, row - 1, -1.0); }
+            if(j + 1 < m) { builder.add(row, row + 1, -1.0); }
+        }
+
+        return builder.build();
+    }
+
+    // Тот же оператор -u'', заданный без хранения матрицы
+    struct laplacian_1d_operator
+    {
+        std::ptrdiff_t n;
+
+        std::ptrdiff_t dim1() const { return n; }
+        std::ptrdiff_t dim2() const { return n; }
+
+        template <class Vector1, class Vector2>
+        void apply(Vector1 const & x, Vector2 & y) const
+        {
+            for(auto const & i : grabin::view::indices(n))
+            {
+                y[i] = 2 * x[i] - (i > 0 ? x[i-1] : 0.0) - (i + 1 < n ? x[i+1] : 0.0);
+            }
+        }
+    };
+}
+
+TEST_CASE("conjugate_gradient: far fewer products than minimal residue")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const n = 50;
+    auto const A = make_laplacian_1d(n);
+
+    Vector b(n);
+    std::uniform_real_distribution<Value> distr(-1, 1);
+    grabin::generate(b, [&]{ return distr(grabin_test::random_engine()); });
+
+    grabin::linear_algebra::iterative_options options;
+    options.tolerance = 1e-8;
+    options.max_iterations = 100000;
+
+    Vector x_cg(n);
+    auto const cg = grabin::linear_algebra::conjugate_gradient(A, b, x_cg,
+                                                                grabin::linear_algebra::identity_preconditioner{},
+                                                                options);
+
+    Vector x_mr(n);
+    auto const mr = grabin::linear_algebra::minimal_residue(A, b, x_mr, options);
+
+    CAPTURE(cg.iterations, mr.iterations);
+
+    REQUIRE(cg.converged);
+    REQUIRE(mr.converged);
+    CHECK(cg.iterations <= 2 * n);
+    CHECK(10 * cg.iterations < mr.iterations);
+
+    CHECK_THAT(Vector(A * x_cg), grabin_test::Matchers::elementwise_within_abs(b, 1e-7));
+    CHECK_THAT(x_cg, grabin_test::Matchers::elementwise_within_abs(x_mr, 1e-5));
+
+    // Оператор без матрицы даёт те же итерации
+    Vector x_op(n);
+    auto const op = grabin::linear_algebra::conjugate_gradient(laplacian_1d_operator{n}, b, x_op,
+                                                                grabin::linear_algebra::identity_preconditioner{},
+                                                                options);
+
+    CHECK(op.converged);
+    CHECK(op.iterations == cg.iterations);
+    CHECK_THAT(x_op, grabin_test::Matchers::elementwise_within_abs(x_cg, 1e-10));
+
+    // Форма с возвратом решения
+    CHECK_THAT(grabin::linear_algebra::conjugate_gradient(A, b),
+               grabin_test::Matchers::elementwise_within_abs(x_cg, 1e-7));
+}
+
+TEST_CASE("conjugate_gradient: Jacobi preconditioner on a badly scaled matrix")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    auto & rnd = grabin_test::random_engine();
+
+    auto const n = 40;
+
+    // D*A*D, где A хорошо обусловлена, а D -- диагональ разных порядков
+    auto A = grabin_test::make_random_spd_matrix<Matrix>(n);
+
+    std::uniform_real_distribution<Value> exponent(-3, 3);
+    std::vector<Value> d(n);
+    for(auto & d_i : d)
+    {
+        d_i = std::pow(10.0, exponent(rnd));
+    }
+
+    for(auto const & i : grabin::view::indices(n))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        A(i, j) *= d[i] * d[j];
+    }
+
+    Vector b(n);
+    std::uniform_real_distribution<Value> distr(-1, 1);
+    grabin::generate(b, [&]{ return distr(rnd); });
+
+    grabin::linear_algebra::iterative_options options;
+    options.tolerance = 1e-10;
+    options.max_iterations = 10000;
+
+    grabin::linear_algebra::iterative_workspace<Vector> workspace;
+
+    Vector x_plain(n);
+    auto const plain = grabin::linear_algebra::conjugate_gradient(A, b, x_plain,
+                                                                   grabin::linear_algebra::identity_preconditioner{},
+                                                                   options, workspace);
+
+    auto const M = grabin::linear_algebra::make_jacobi_preconditioner(A);
+    CHECK(M.dim() == n);
+
+    Vector x_jacobi(n);
+    auto const jacobi = grabin::linear_algebra::conjugate_gradient(A, b, x_jacobi, M, options, workspace);
+
+    CAPTURE(plain.iterations, jacobi.iterations);
+
+    REQUIRE(jacobi.converged);
+    CHECK(jacobi.iterations < plain.iterations);
+    CHECK(workspace.size() == 4);
+
+    auto const x = grabin::linear_algebra::cholesky_solver{}(A, b);
+    for(auto const & i : grabin::view::indices(n))
+    {
+        CHECK(x_jacobi[i] == Approx(x[i]).epsilon(1e-6).margin(1e-12));
+    }
+
+    // Нулевой диагональный элемент
+    Matrix Z(2, 2);
+    Z(0, 1) = Z(1, 0) = 1;
+    CHECK_THROWS_AS(grabin::linear_algebra::make_jacobi_preconditioner(Z), std::domain_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::make_jacobi_preconditioner(Matrix(2, 3)), std::logic_error);
+}
+
+TEST_CASE("conjugate_gradient: incomplete Cholesky preconditioner")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1, 1);
+
+    grabin::linear_algebra::iterative_options options;
+    options.tolerance = 1e-10;
+    options.max_iterations = 10000;
+
+    // Для трёхдиагональной матрицы неполное разложение совпадает с полным
+    {
+        auto const n = 30;
+        auto const A = make_laplacian_1d(n);
+
+        Matrix A_dense(n, n);
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            A_dense(i, j) = A(i, j);
+        }
+
+        Vector b(n);
+        grabin::generate(b, [&]{ return distr(rnd); });
+
+        auto const M = grabin::linear_algebra::make_incomplete_cholesky_preconditioner(A);
+        auto const M_dense = grabin::linear_algebra::make_incomplete_cholesky_preconditioner(A_dense);
+
+        CHECK(M.nnz() == 2 * n - 1);
+        CHECK(M_dense.nnz() == M.nnz());
+
+        Vector x(n);
+        auto const report = grabin::linear_algebra::conjugate_gradient(A, b, x, M, options);
+
+        CHECK(report.converged);
+        CHECK(report.iterations == 1);
+
+        Vector x_dense(n);
+        grabin::linear_algebra::conjugate_gradient(A_dense, b, x_dense, M_dense, options);
+
+        CHECK_THAT(x_dense, grabin_test::Matchers::elementwise_within_abs(x, 1e-10));
+    }
+
+    // Двумерная задача
+    {
+        auto const A = make_laplacian_2d(20);
+        auto const n = A.dim1();
+
+        Vector b(n);
+        grabin::generate(b, [&]{ return distr(rnd); });
+
+        Vector x_plain(n);
+        auto const plain = grabin::linear_algebra::conjugate_gradient(A, b, x_plain,
+                                                                       grabin::linear_algebra::identity_preconditioner{},
+                                                                       options);
+
+        auto const M = grabin::linear_algebra::make_incomplete_cholesky_preconditioner(A);
+
+        // Нижний треугольник: диагональ и по два соседа у внутренних узлов
+        CHECK(M.nnz() == (A.nnz() + n) / 2);
+
+        Vector x_ic(n);
+        auto const ic = grabin::linear_algebra::conjugate_gradient(A, b, x_ic, M, options);
+
+        CAPTURE(plain.iterations, ic.iterations);
+
+        REQUIRE(plain.converged);
+        REQUIRE(ic.converged);
+        CHECK(2 * ic.iterations < plain.iterations);
+        CHECK_THAT(Vector(A * x_ic), grabin_test::Matchers::elementwise_within_abs(b, 1e-8));
+
+        // Функциональный объект
+        grabin::linear_algebra::conjugate_gradient_solver<
+            grabin::linear_algebra::incomplete_cholesky_preconditioner<Value>> solver;
+        solver.options = options;
+
+        CHECK_THAT(solver(A, b), grabin_test::Matchers::elementwise_within_abs(x_ic, 1e-8));
+    }
+
+    // Разложение не существует
+    Matrix A(2, 2);
+    A(0, 0) = 1; A(0, 1) = 2;
+    A(1, 0) = 2; A(1, 1) = 1;
+
+    CHECK_THROWS_AS(grabin::linear_algebra::make_incomplete_cholesky_preconditioner(A), std::domain_error);
+    CHECK_THROWS_AS(grabin::linear_algebra::make_incomplete_cholesky_preconditioner(Matrix(2, 3)),
+                    std::logic_error);
+}
+
+TEST_CASE("conjugate_gradient: indefinite matrix is detected")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    Matrix A(2, 2);
+    A(0, 0) = 1;
+    A(1, 1) = -1;
+
+    Vector const b{1.0, 1.0};
+    Vector x(2);
+
+    auto const report = grabin::linear_algebra::conjugate_gradient(A, b, x,
+                                                                    grabin::linear_algebra::identity_preconditioner{});
+
+    CHECK(!report.converged);
+    CHECK(report.iterations == 0);
+
+    CHECK_THROWS_AS(grabin::linear_algebra::conjugate_gradient(A, Vector(3)), std::logic_error);
+}
+
+namespace
+{
+    // Уравнение конвекции-диффузии -u'' + c*u' на сетке m x m, производная
+    // против потока: матрица несимметрична
+    grabin::csr_matrix<double> make_convection_diffusion_2d(std::ptrdiff_t m, double c)
+    {
+        auto const n = m * m;
+
+        grabin::csr_matrix_builder<double> builder(n, n);
+
+        for(auto const & i : grabin::view::indices(m))
+        for(auto const & j : grabin::view::indices(m))
+        {
+            auto const row = i * m + j;
+
+            builder.add(row, row, 4.0 + c);
+
+            if(i > 0)     { builder.add(row, row - m, -1.0); }
+            if(i + 1 < m) { builder.add(row, row + m, -1.0); }
+            if(j > 0)     { builder.add(row, row - 1, -1.0 - c); }
+            if(j + 1 < m) { builder.add(row, row + 1, -1.0); }
+        }
+
+        return builder.build();
+    }
+}
+
+TEST_CASE("gmres and bicgstab: nonsymmetric matrix")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto const A = make_convection_diffusion_2d(20, 10.0);
+    auto const n = A.dim1();
+
+    Vector b(n);
+    std::uniform_real_distribution<Value> distr(-1, 1);
+    grabin::generate(b, [&]{ return distr(grabin_test::random_engine()); });
+
+    auto const M = la::make_incomplete_lu_preconditioner(A);
+    CHECK(M.nnz() == A.nnz());
+
+    la::gmres_options gmres_options;
+    gmres_options.tolerance = 1e-10;
+    gmres_options.max_iterations = 10000;
+    gmres_options.restart = 20;
+
+    la::bicgstab_options bicgstab_options;
+    bicgstab_options.tolerance = 1e-10;
+    bicgstab_options.max_iterations = 10000;
+
+    la::iterative_workspace<Vector> workspace;
+
+    Vector x_gmres(n);
+    auto const gmres = la::gmres(A, b, x_gmres, la::identity_preconditioner{},
+                                 gmres_options, workspace);
+    CHECK(workspace.size() == gmres_options.restart + 3);
+
+    Vector x_gmres_ilu(n);
+    auto const gmres_ilu = la::gmres(A, b, x_gmres_ilu, M, gmres_options, workspace);
+
+    Vector x_bicgstab(n);
+    auto const bicgstab = la::bicgstab(A, b, x_bicgstab, la::identity_preconditioner{},
+                                       bicgstab_options, workspace);
+
+    Vector x_bicgstab_ilu(n);
+    auto const bicgstab_ilu = la::bicgstab(A, b, x_bicgstab_ilu, M, bicgstab_options, workspace);
+
+    Vector x_bicgstab_jacobi(n);
+    auto const bicgstab_jacobi = la::bicgstab(A, b, x_bicgstab_jacobi,
+                                              la::make_jacobi_preconditioner(A),
+                                              bicgstab_options, workspace);
+
+    CAPTURE(gmres.iterations, gmres_ilu.iterations,
+            bicgstab.iterations, bicgstab_ilu.iterations, bicgstab_jacobi.iterations);
+
+    REQUIRE(gmres.converged);
+    REQUIRE(gmres_ilu.converged);
+    REQUIRE(bicgstab.converged);
+    REQUIRE(bicgstab_ilu.converged);
+    REQUIRE(bicgstab_jacobi.converged);
+
+    CHECK(2 * gmres_ilu.iterations < gmres.iterations);
+    CHECK(2 * bicgstab_ilu.iterations < bicgstab.iterations);
+
+    // Без перезапусков -- не больше n итераций
+    CHECK(gmres_ilu.iterations <= gmres_options.restart);
+
+    for(auto const * x : {&x_gmres, &x_gmres_ilu, &x_bicgstab, &x_bicgstab_ilu, &x_bicgstab_jacobi})
+    {
+        CHECK_THAT(Vector(A * *x), grabin_test::Matchers::elementwise_within_abs(b, 1e-8));
+    }
+
+    // Предобуславливание слева: контролируется невязка системы M^{-1}*A*x == M^{-1}*b
+    gmres_options.side = la::preconditioning_side::left;
+    bicgstab_options.side = la::preconditioning_side::left;
+
+    Vector x_left(n);
+    auto const gmres_left = la::gmres(A, b, x_left, M, gmres_options, workspace);
+    CHECK(workspace.size() == gmres_options.restart + 5);
+
+    CHECK(gmres_left.converged);
+    CHECK(2 * gmres_left.iterations < gmres.iterations);
+    CHECK_THAT(x_left, grabin_test::Matchers::elementwise_within_abs(x_gmres_ilu, 1e-6));
+
+    Vector x_left_bicgstab(n);
+    auto const bicgstab_left = la::bicgstab(A, b, x_left_bicgstab, M, bicgstab_options, workspace);
+
+    CHECK(bicgstab_left.converged);
+    CHECK_THAT(x_left_bicgstab, grabin_test::Matchers::elementwise_within_abs(x_gmres_ilu, 1e-6));
+
+    // Функциональные объекты
+    la::gmres_solver<la::incomplete_lu_preconditioner<Value>> gmres_solver;
+    gmres_solver.options.max_iterations = 10000;
+
+    la::bicgstab_solver<la::jacobi_preconditioner<Value>> bicgstab_solver;
+    bicgstab_solver.options.max_iterations = 10000;
+
+    CHECK_THAT(gmres_solver(A, b), grabin_test::Matchers::elementwise_within_abs(x_gmres_ilu, 1e-6));
+    CHECK_THAT(bicgstab_solver(A, b), grabin_test::Matchers::elementwise_within_abs(x_gmres_ilu, 1e-6));
+}
+
+TEST_CASE("gmres: restarts and exact preconditioner")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(-1, 1);
+
+    auto const n = 50;
+    auto const A = make_laplacian_1d(n);
+
+    Vector b(n);
+    grabin::generate(b, [&]{ return distr(rnd); });
+
+    la::gmres_options options;
+    options.tolerance = 1e-10;
+    options.max_iterations = 10000;
+
+    // Без перезапусков решение находится не более чем за n итераций
+    options.restart = n;
+
+    Vector x_full(n);
+    auto const full = la::gmres(A, b, x_full, la::identity_preconditioner{}, options);
+
+    CHECK(full.converged);
+    CHECK(full.iterations <= n);
+
+    // С перезапусками -- медленнее, но с меньшей памятью
+    options.restart = 5;
+
+    Vector x_restarted(n);
+    auto const restarted = la::gmres(A, b, x_restarted, la::identity_preconditioner{}, options);
+
+    CAPTURE(full.iterations, restarted.iterations);
+
+    CHECK(restarted.converged);
+    CHECK(full.iterations < restarted.iterations);
+    CHECK_THAT(x_restarted, grabin_test::Matchers::elementwise_within_abs(x_full, 1e-7));
+
+    // Оператор без матрицы даёт те же итерации
+    Vector x_op(n);
+    auto const op = la::gmres(laplacian_1d_operator{n}, b, x_op, la::identity_preconditioner{}, options);
+
+    CHECK(op.iterations == restarted.iterations);
+    CHECK_THAT(x_op, grabin_test::Matchers::elementwise_within_abs(x_restarted, 1e-10));
+
+    // Для трёхдиагональной матрицы неполное разложение совпадает с полным
+    Matrix A_dense(n, n);
+    for(auto const & i : grabin::view::indices(n))
+    for(auto const & j : grabin::view::indices(n))
+    {
+        A_dense(i, j) = A(i, j);
+    }
+
+    auto const M = la::make_incomplete_lu_preconditioner(A);
+    auto const M_dense = la::make_incomplete_lu_preconditioner(A_dense);
+
+    CHECK(M.nnz() == 3 * n - 2);
+    CHECK(M_dense.nnz() == M.nnz());
+
+    for(auto const & side : {la::preconditioning_side::right, la::preconditioning_side::left})
+    {
+        options.side = side;
+
+        Vector x(n);
+        auto const report = la::gmres(A_dense, b, x, M_dense, options);
+
+        CHECK(report.converged);
+        CHECK(report.iterations == 1);
+        CHECK_THAT(x, grabin_test::Matchers::elementwise_within_abs(x_full, 1e-7));
+
+        Vector y(n);
+        la::bicgstab_options bicgstab_options;
+        bicgstab_options.side = side;
+
+        CHECK(la::bicgstab(A, b, y, M, bicgstab_options).iterations == 1);
+        CHECK_THAT(y, grabin_test::Matchers::elementwise_within_abs(x_full, 1e-7));
+    }
+
+    // Начальное приближение уже является решением
+    auto const again = la::gmres(A, b, x_full, M, options);
+    CHECK(again.converged);
+    CHECK(again.iterations == 0);
+
+    // Разложение не существует
+    Matrix Z(2, 2);
+    Z(0, 1) = Z(1, 0) = 1;
+    CHECK_THROWS_AS(la::make_incomplete_lu_preconditioner(Z), std::domain_error);
+    CHECK_THROWS_AS(la::make_incomplete_lu_preconditioner(Matrix(2, 3)), std::logic_error);
+
+    CHECK_THROWS_AS(la::gmres(A, Vector(n + 1), x_full, M), std::logic_error);
+    CHECK_THROWS_AS(la::bicgstab(A, b, Vector(n + 1), M), std::logic_error);
+}
+
+TEST_CASE("iterative solvers: failure to converge is reported")
+{
+    namespace la = grabin::linear_algebra;
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    // Процесс гибели и размножения с 200 состояниями
+    auto const n = 200;
+    auto const nu_order = 1.0;
+    auto const nu_service = 2.0;
+
+    grabin::csr_matrix_builder<Value> builder(n, n);
+
+    for(auto i : grabin::view::indices(n - 1))
+    {
+        builder.add(i, i+1, nu_order);
+        builder.add(i+1, i, nu_service);
+    }
+
+    auto const lambda = builder.build();
+
+    Vector P1(n);
+    P1[0] = 1.0;
+
+    for(auto const & i : grabin::view::indices(n - 1))
+    {
+        P1[i+1] = nu_order / nu_service * P1[i];
+    }
+
+    P1 /= std::accumulate(P1.begin(), P1.end(), 0 * P1[0]);
+
+    // Без предобуславливания итераций по умолчанию не хватает
+    CHECK_THROWS_AS(grabin::stochastic::ctmc_stationary(lambda, la::bicgstab_solver<>{}),
+                    std::runtime_error);
+    CHECK_THROWS_AS(grabin::stochastic::ctmc_stationary(lambda, la::gmres_solver<>{}),
+                    std::runtime_error);
+
+    CHECK_THAT(grabin::stochastic::ctmc_stationary(lambda),
+               grabin_test::Matchers::elementwise_within_abs(P1, 1e-8));
+
+    // Симметричная положительно определённая матрица
+    auto const A = make_convection_diffusion_2d(20, 0.0);
+    Vector b(A.dim1(), 1.0);
+
+    la::minimal_residue_solver mr;
+    mr.options.max_iterations = 2;
+
+    la::conjugate_gradient_solver<> cg;
+    cg.options.max_iterations = 2;
+
+    // Метод минимальных невязок возвращает последнее приближение
+    CHECK_NOTHROW(mr(A, b));
+    CHECK_NOTHROW(la::minimal_residue(A, b));
+
+    CHECK_THROWS_AS(cg(A, b), std::runtime_error);
+
+    cg.options.max_iterations = 1000;
+    CHECK_THAT(A * cg(A, b), grabin_test::Matchers::elementwise_within_abs(b, 1e-6));
+}
@@ -195,3 +195,411 @@ TEST_CASE("LU-solver: many processors, one bus")
         REQUIRE_THAT(P, grabin_test::Matchers::elementwise_within_abs(P1, 1e-6));
     }
 }
+
+namespace
+{
+    // Решение системы с разреженной матрицей LU-разложением её плотной копии
+    struct dense_LU_solver
+    {
+        template <class T, class Check, class Vector>
+        grabin::evaluated_type_t<Vector>
+        operator()(grabin::csr_matrix<T, Check> const & A, Vector const & b) const
+        {
+            grabin::matrix<T> dense(A.dim1(), A.dim2());
+
+            for(auto const & i : grabin::view::indices(A.dim1()))
+            for(auto const & j : grabin::view::indices(A.dim2()))
+            {
+                dense(i, j) = A(i, j);
+            }
+
+            return grabin::linear_algebra::LU_solver{}(dense, b);
+        }
+    };
+}
+
+TEST_CASE("ctmc_stationary: sparse generator")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<double> distr(0.5, 2);
+
+    for(auto n = 1; n < 15; ++ n)
+    {
+        auto const nu_order = distr(rnd);
+        auto const nu_service = distr(rnd);
+
+        // Простейшая система массового обслуживания, только ненулевые интенсивности
+        grabin::csr_matrix_builder<double> builder(n+1, n+1);
+
+        builder.add(0, 1, nu_order);
+        for(auto i : grabin::view::indices(n-1))
+        {
+            builder.add(i+1, i, nu_service);
+            builder.add(i+1, i+2, nu_order);
+        }
+        builder.add(n, n-1, nu_service);
+
+        auto const lambda = builder.build();
+
+        auto const P = grabin::stochastic::ctmc_stationary(lambda, dense_LU_solver{});
+
+        auto const alpha = nu_order / nu_service;
+
+        Vector P1(n+1);
+        P1[0] = 1.0;
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            P1[i+1] = alpha * P1[i];
+        }
+
+        P1 /= std::accumulate(P1.begin(), P1.end(), 0 * P1[0]);
+
+        CAPTURE(n, alpha);
+        CHECK_THAT(P, grabin_test::Matchers::elementwise_within_abs(P1, 1e-6));
+    }
+}
+
+#include <grabin/math/matrix_view.hpp>
+
+TEST_CASE("solvers accept views of external buffers")
+{
+    using Value = double;
+
+    std::vector<Value> const a{ 4.0, -1.0,  0.0,
+                               -1.0,  4.0, -1.0,
+                                0.0, -1.0,  4.0};
+    std::vector<Value> const b{2.0, 4.0, 10.0};
+
+    grabin::matrix_view<Value const> const A(a.data(), 3, 3);
+    grabin::math_vector_view<Value const> const bv(b.data(), 3);
+
+    auto const x_obj = grabin::math_vector<Value>{1.0, 2.0, 3.0};
+
+    auto const x_lu = grabin::linear_algebra::LU_solver{}(A, bv);
+    auto const x_mr = grabin::linear_algebra::minimal_residue(A, bv);
+
+    static_assert(std::is_same<decltype(x_lu), grabin::math_vector<Value> const>::value, "");
+    static_assert(std::is_same<decltype(x_mr), grabin::math_vector<Value> const>::value, "");
+
+    CHECK_THAT(x_lu, grabin_test::Matchers::elementwise_within_abs(x_obj, 1e-10));
+    CHECK_THAT(x_mr, grabin_test::Matchers::elementwise_within_abs(x_obj, 1e-6));
+
+    // Исходные буферы не изменяются
+    CHECK(b == (std::vector<Value>{2.0, 4.0, 10.0}));
+}
+
+TEST_CASE("parallel inner_prod")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    std::uniform_int_distribution<int> distr(-10, 10);
+    auto const n = 100003;
+
+    Vector x(n);
+    Vector y(n);
+    for(auto i = 0; i < n; ++ i)
+    {
+        x[i] = distr(grabin_test::random_engine());
+        y[i] = distr(grabin_test::random_engine());
+    }
+
+    // Значения целые, поэтому все варианты суммирования дают точный результат
+    auto const expected = grabin::linear_algebra::inner_prod(x, y);
+
+    for(auto threads : {1, 2, 3, 8})
+    {
+        CAPTURE(threads);
+
+        grabin::execution::parallel_policy const policy(threads, 1000);
+
+        CHECK(grabin::linear_algebra::inner_prod(policy, x, y) == expected);
+    }
+
+    CHECK(grabin::linear_algebra::inner_prod(grabin::execution::par, x, y) == expected);
+    CHECK(grabin::linear_algebra::inner_prod(grabin::execution::seq, x, y) == expected);
+
+    CHECK_THROWS_AS(grabin::linear_algebra::inner_prod(grabin::execution::par, x, Vector(n+1)),
+                    std::logic_error);
+}
+
+#include <grabin/math/band_matrix.hpp>
+
+namespace
+{
+    // Простейшая система массового обслуживания с n местами
+    grabin::band_matrix<double>
+    make_birth_death_process(int n, double nu_order, double nu_service)
+    {
+        grabin::band_matrix<double> lambda(n+1, 1, 1);
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            lambda(i, i+1) = nu_order;
+            lambda(i+1, i) = nu_service;
+        }
+
+        return lambda;
+    }
+
+    grabin::math_vector<double>
+    birth_death_stationary(int n, double nu_order, double nu_service)
+    {
+        auto const alpha = nu_order / nu_service;
+
+        grabin::math_vector<double> P(n+1);
+        P[0] = 1.0;
+
+        for(auto const & i : grabin::view::indices(n))
+        {
+            P[i+1] = alpha * P[i];
+        }
+
+        P /= std::accumulate(P.begin(), P.end(), 0 * P[0]);
+
+        return P;
+    }
+}
+
+TEST_CASE("ctmc_stationary: banded birth-death process")
+{
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<double> distr(0.1, 10);
+
+    for(auto n = 1; n < 15; ++ n)
+    {
+        auto const nu_order = distr(rnd);
+        auto const nu_service = distr(rnd);
+
+        CAPTURE(n, nu_order, nu_service);
+
+        auto const P = grabin::stochastic::ctmc_stationary(make_birth_death_process(n, nu_order, nu_service));
+        auto const P1 = birth_death_stationary(n, nu_order, nu_service);
+
+        CHECK_THAT(P, grabin_test::Matchers::elementwise_within_abs(P1, 1e-10));
+
+        // Решение системы уравнений устойчиво, если вероятности убывают
+        auto const nu_min = std::min(nu_order, nu_service);
+        auto const nu_max = std::max(nu_order, nu_service);
+
+        auto const lambda = make_birth_death_process(n, nu_min, nu_max);
+        auto const P_LU = grabin::stochastic::ctmc_stationary(lambda, grabin::linear_algebra::band_LU_solver{});
+        auto const P_thomas = grabin::stochastic::ctmc_stationary(lambda, grabin::linear_algebra::tridiagonal_solver{});
+        auto const P2 = birth_death_stationary(n, nu_min, nu_max);
+
+        CHECK_THAT(P_LU, grabin_test::Matchers::elementwise_within_abs(P2, 1e-10));
+        CHECK_THAT(P_thomas, grabin_test::Matchers::elementwise_within_abs(P2, 1e-10));
+    }
+}
+
+TEST_CASE("ctmc_stationary: banded process agrees with dense")
+{
+    // Заявки поступают пачками по одной или две, обслуживаются по одной
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<double> distr(0.1, 10);
+
+    for(auto n = 1; n < 12; ++ n)
+    {
+        grabin::band_matrix<double> lambda(n, 1, 2);
+        grabin::matrix<double> lambda_dense(n, n);
+
+        for(auto const & i : grabin::view::indices(n))
+        for(auto const & j : grabin::view::indices(n))
+        {
+            if(i != j && lambda.in_band(i, j))
+            {
+                lambda(i, j) = distr(rnd);
+                lambda_dense(i, j) = lambda(i, j);
+            }
+        }
+
+        auto const P = grabin::stochastic::ctmc_stationary(lambda);
+        auto const P_dense = grabin::stochastic::ctmc_stationary(lambda_dense);
+
+        CAPTURE(n);
+        CHECK_THAT(P, grabin_test::Matchers::elementwise_within_abs(P_dense, 1e-10));
+    }
+}
+
+TEST_CASE("ctmc_stationary: large birth-death process")
+{
+    // Процесс гибели и размножения с миллионом состояний и постоянными
+    // интенсивностями: стационарное распределение геометрическое
+    auto const n = 1000 * 1000;
+    auto const birth = 1.0;
+    auto const death = 2.0;
+
+    grabin::band_matrix<double> lambda(n, 1, 1);
+
+    for(auto const & i : grabin::view::indices(n - 1))
+    {
+        lambda(i, i + 1) = birth;
+        lambda(i + 1, i) = death;
+    }
+
+    auto const P = grabin::stochastic::ctmc_stationary(lambda);
+    auto const P_thomas = grabin::stochastic::ctmc_stationary(lambda, grabin::linear_algebra::tridiagonal_solver{});
+
+    REQUIRE(P.dim() == n);
+    CHECK_THAT(P_thomas, grabin_test::Matchers::elementwise_within_abs(P, 1e-12));
+    CHECK(P[0] == Approx(0.5));
+    CHECK(P[1] == Approx(0.25));
+    CHECK(P[10] == Approx(std::pow(0.5, 11)));
+    CHECK(std::accumulate(P.begin(), P.end(), 0.0) == Approx(1.0));
+}
+
+TEST_CASE("ctmc_stationary: sparse generator with iterative solvers")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(0.5, 2);
+
+    // Случайный разреженный процесс: переходы в соседние состояния по
+    // кольцу и несколько случайных переходов
+    auto const n = 300;
+
+    grabin::csr_matrix_builder<Value> builder(n, n);
+
+    std::uniform_int_distribution<std::ptrdiff_t> state(0, n - 1);
+
+    for(auto const & i : grabin::view::indices(n))
+    {
+        builder.add(i, (i + 1) % n, distr(rnd));
+        builder.add((i + 1) % n, i, distr(rnd));
+
+        auto const j = state(rnd);
+
+        if(j != i && j != (i + 1) % n && j != (i + n - 1) % n)
+        {
+            builder.add(i, j, distr(rnd));
+        }
+    }
+
+    auto const lambda = builder.build();
+
+    auto const P_LU = grabin::stochastic::ctmc_stationary(lambda, dense_LU_solver{});
+
+    la::gmres_solver<la::incomplete_lu_preconditioner<Value>> gmres;
+    gmres.options.max_iterations = 1000;
+
+    la::bicgstab_solver<la::incomplete_lu_preconditioner<Value>> bicgstab;
+    bicgstab.options.max_iterations = 1000;
+
+    la::gmres_solver<la::jacobi_preconditioner<Value>> gmres_jacobi;
+    gmres_jacobi.options.max_iterations = 10000;
+
+    auto const P_default = grabin::stochastic::ctmc_stationary(lambda);
+    auto const P_gmres = grabin::stochastic::ctmc_stationary(lambda, gmres);
+    auto const P_bicgstab = grabin::stochastic::ctmc_stationary(lambda, bicgstab);
+    auto const P_jacobi = grabin::stochastic::ctmc_stationary(lambda, gmres_jacobi);
+
+    CHECK_THAT(P_default, grabin_test::Matchers::elementwise_within_abs(P_LU, 1e-8));
+    CHECK_THAT(P_gmres, grabin_test::Matchers::elementwise_within_abs(P_LU, 1e-8));
+    CHECK_THAT(P_bicgstab, grabin_test::Matchers::elementwise_within_abs(P_LU, 1e-8));
+    CHECK_THAT(P_jacobi, grabin_test::Matchers::elementwise_within_abs(P_LU, 1e-8));
+
+    // Процесс гибели и размножения
+    for(auto m = 1; m < 15; ++ m)
+    {
+        auto const nu_order = distr(rnd);
+        auto const nu_service = distr(rnd);
+
+        grabin::csr_matrix_builder<Value> bd(m+1, m+1);
+
+        for(auto i : grabin::view::indices(m))
+        {
+            bd.add(i, i+1, nu_order);
+            bd.add(i+1, i, nu_service);
+        }
+
+        auto const P = grabin::stochastic::ctmc_stationary(bd.build(), bicgstab);
+
+        auto const alpha = nu_order / nu_service;
+
+        Vector P1(m+1);
+        P1[0] = 1.0;
+
+        for(auto const & i : grabin::view::indices(m))
+        {
+            P1[i+1] = alpha * P1[i];
+        }
+
+        P1 /= std::accumulate(P1.begin(), P1.end(), 0 * P1[0]);
+
+        CAPTURE(m, alpha);
+        CHECK_THAT(P, grabin_test::Matchers::elementwise_within_abs(P1, 1e-8));
+    }
+}
+
+TEST_CASE("ctmc_stationary: Kronecker-structured generator")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+    using Matrix = grabin::matrix<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto & rnd = grabin_test::random_engine();
+    std::uniform_real_distribution<Value> distr(0.5, 2);
+
+    // Транспонированный генератор процесса гибели и размножения и его
+    // стационарное распределение
+    auto make_process = [&](std::ptrdiff_t n, Matrix & QT, Vector & P)
+    {
+        auto const nu_order = distr(rnd);
+        auto const nu_service = distr(rnd);
+
+        QT = Matrix(n, n);
+        P = Vector(n);
+        P[0] = 1;
+
+        for(auto const & i : grabin::view::indices(n - 1))
+        {
+            QT(i + 1, i) = nu_order;
+            QT(i, i) -= nu_order;
+            QT(i, i + 1) = nu_service;
+            QT(i + 1, i + 1) -= nu_service;
+
+            P[i + 1] = P[i] * nu_order / nu_service;
+        }
+
+        P /= std::accumulate(P.begin(), P.end(), 0 * P[0]);
+    };
+
+    auto const n1 = 6;
+    auto const n2 = 9;
+
+    Matrix Q1T, Q2T;
+    Vector P1, P2;
+    make_process(n1, Q1T, P1);
+    make_process(n2, Q2T, P2);
+
+    // Пара независимых процессов: кронекерова сумма генераторов
+    auto const QT = la::make_sum_operator(la::make_kronecker_operator(Q1T, la::identity_operator(n2)),
+                                          la::make_kronecker_operator(la::identity_operator(n1), Q2T));
+
+    la::gmres_solver<> solver;
+    solver.options.max_iterations = 10000;
+
+    auto const P = grabin::stochastic::ctmc_stationary_matrix_free(QT, solver);
+
+    REQUIRE(P.dim() == n1 * n2);
+
+    for(auto const & i : grabin::view::indices(n1))
+    for(auto const & j : grabin::view::indices(n2))
+    {
+        CAPTURE(i, j);
+        CHECK(P[i*n2 + j] == Approx(P1[i] * P2[j]).margin(1e-9));
+    }
+
+    // Явная матрица тоже является оператором
+    auto const P_one = grabin::stochastic::ctmc_stationary_matrix_free(Q1T, solver);
+    CHECK_THAT(P_one, grabin_test::Matchers::elementwise_within_abs(P1, 1e-9));
+}
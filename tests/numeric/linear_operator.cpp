@@ -0,0 +1,256 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/numeric/linear_operator.hpp>
+
+#include <catch2/catch.hpp>
+#include "../grabin_test.hpp"
+
+#include <grabin/algorithm.hpp>
+#include <grabin/math/sparse_matrix.hpp>
+#include <grabin/numeric/linear_algebra.hpp>
+
+namespace
+{
+    // Целочисленные элементы позволяют сравнивать результаты точно
+    template <class Value>
+    grabin::math_vector<Value> make_random_vector(std::ptrdiff_t n)
+    {
+        std::uniform_int_distribution<int> distr(-20, 20);
+        grabin::math_vector<Value> result(n);
+        grabin::generate(result, [&]{ return Value(distr(grabin_test::random_engine())); });
+        return result;
+    }
+
+    template <class Value>
+    grabin::matrix<Value> make_random_matrix(std::ptrdiff_t rows, std::ptrdiff_t cols)
+    {
+        std::uniform_int_distribution<int> distr(-20, 20);
+        grabin::matrix<Value> result(rows, cols);
+        grabin::generate(result, [&]{ return Value(distr(grabin_test::random_engine())); });
+        return result;
+    }
+}
+
+TEST_CASE("linear_operator: apply_operator accepts matrices and operators")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto const A = make_random_matrix<Value>(4, 3);
+
+    grabin::csr_matrix_builder<Value> builder(4, 3);
+    for(auto const & i : grabin::view::indices(A.dim1()))
+    for(auto const & j : grabin::view::indices(A.dim2()))
+    {
+        builder.add(i, j, A(i, j));
+    }
+    auto const A_sparse = builder.build();
+
+    auto const A_function = grabin::linear_algebra::make_linear_operator(4, 3,
+        [&A](Vector const & x, Vector & y) { y = A * x; });
+
+    CHECK(A_function.dim1() == 4);
+    CHECK(A_function.dim2() == 3);
+
+    auto const x = make_random_vector<Value>(3);
+    Vector const expected = A * x;
+
+    Vector y_dense(4);
+    grabin::linear_algebra::apply_operator(A, x, y_dense);
+    CHECK(y_dense == expected);
+
+    Vector y_sparse(4);
+    grabin::linear_algebra::apply_operator(A_sparse, x, y_sparse);
+    CHECK(y_sparse == expected);
+
+    Vector y_function(4);
+    grabin::linear_algebra::apply_operator(A_function, x, y_function);
+    CHECK(y_function == expected);
+
+    Vector y_identity(3);
+    grabin::linear_algebra::apply_operator(grabin::linear_algebra::identity_operator(3), x, y_identity);
+    CHECK(y_identity == x);
+}
+
+TEST_CASE("linear_operator: iterative solvers accept lambdas")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto const n = 40;
+
+    // -u'' + u с нулевыми граничными условиями
+    auto const A = la::make_linear_operator(n, n, [n](Vector const & x, Vector & y)
+    {
+        for(auto const & i : grabin::view::indices(n))
+        {
+            y[i] = 3 * x[i] - (i > 0 ? x[i-1] : 0.0) - (i + 1 < n ? x[i+1] : 0.0);
+        }
+    });
+
+    auto const b = make_random_vector<Value>(n);
+
+    grabin::matrix<Value> A_dense(n, n);
+    for(auto const & i : grabin::view::indices(n))
+    {
+        A_dense(i, i) = 3;
+
+        if(i > 0)
+        {
+            A_dense(i, i - 1) = A_dense(i - 1, i) = -1;
+        }
+    }
+
+    auto const x = la::LU_solver{}(A_dense, b);
+
+    la::iterative_options options;
+    options.max_iterations = 1000;
+
+    la::gmres_options gmres_options;
+    gmres_options.max_iterations = 1000;
+
+    la::bicgstab_options bicgstab_options;
+    bicgstab_options.max_iterations = 1000;
+
+    Vector x_cg(n);
+    CHECK(la::conjugate_gradient(A, b, x_cg, la::identity_preconditioner{}, options).converged);
+
+    Vector x_mr(n);
+    CHECK(la::minimal_residue(A, b, x_mr, options).converged);
+
+    Vector x_gmres(n);
+    CHECK(la::gmres(A, b, x_gmres, la::identity_preconditioner{}, gmres_options).converged);
+
+    Vector x_bicgstab(n);
+    CHECK(la::bicgstab(A, b, x_bicgstab, la::identity_preconditioner{}, bicgstab_options).converged);
+
+    for(auto const * result : {&x_cg, &x_mr, &x_gmres, &x_bicgstab})
+    {
+        CHECK_THAT(*result, grabin_test::Matchers::elementwise_within_abs(x, 1e-6));
+    }
+
+    la::minimal_residue_solver solver;
+    solver.options = options;
+    CHECK_THAT(solver(A, b), grabin_test::Matchers::elementwise_within_abs(x, 1e-6));
+}
+
+TEST_CASE("linear_operator: composition and sum")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto const A = make_random_matrix<Value>(3, 4);
+    auto const B = make_random_matrix<Value>(4, 5);
+    auto const C = make_random_matrix<Value>(3, 5);
+
+    auto const x = make_random_vector<Value>(5);
+
+    auto const AB = la::make_composed_operator(A, B);
+
+    CHECK(AB.dim1() == 3);
+    CHECK(AB.dim2() == 5);
+
+    Vector y(3);
+    AB.apply(x, y);
+    CHECK(y == Vector(A * Vector(B * x)));
+
+    // A*B + C, где C задана функцией
+    auto const C_function = la::make_linear_operator(3, 5,
+        [&C](Vector const & x, Vector & y) { y = C * x; });
+
+    auto const sum = la::make_sum_operator(AB, C_function);
+
+    CHECK(sum.dim1() == 3);
+    CHECK(sum.dim2() == 5);
+
+    sum.apply(x, y);
+    CHECK(y == Vector(A * Vector(B * x) + C * x));
+
+    CHECK_THROWS_AS(la::make_composed_operator(B, A), std::logic_error);
+    CHECK_THROWS_AS(la::make_sum_operator(A, B), std::logic_error);
+}
+
+TEST_CASE("linear_operator: Kronecker product")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    namespace la = grabin::linear_algebra;
+
+    auto const m1 = 3;
+    auto const n1 = 2;
+    auto const m2 = 4;
+    auto const n2 = 5;
+
+    auto const A = make_random_matrix<Value>(m1, n1);
+    auto const B = make_random_matrix<Value>(m2, n2);
+
+    grabin::matrix<Value> K(m1 * m2, n1 * n2);
+    for(auto const & p : grabin::view::indices(m1))
+    for(auto const & i : grabin::view::indices(n1))
+    for(auto const & q : grabin::view::indices(m2))
+    for(auto const & j : grabin::view::indices(n2))
+    {
+        K(p*m2 + q, i*n2 + j) = A(p, i) * B(q, j);
+    }
+
+    auto const AB = la::make_kronecker_operator(A, B);
+
+    CHECK(AB.dim1() == m1 * m2);
+    CHECK(AB.dim2() == n1 * n2);
+
+    auto const x = make_random_vector<Value>(n1 * n2);
+
+    Vector y(m1 * m2);
+    AB.apply(x, y);
+    CHECK(y == Vector(K * x));
+
+    // Сомножители, заданные без матриц, и кронекерова сумма
+    auto const a = make_random_matrix<Value>(3, 3);
+    auto const b = make_random_matrix<Value>(4, 4);
+
+    auto const a_function = la::make_linear_operator(3, 3, [&a](Vector const & x, Vector & y) { y = a * x; });
+
+    auto const kronecker_sum = la::make_sum_operator(la::make_kronecker_operator(a_function, la::identity_operator(4)),
+                                                     la::make_kronecker_operator(la::identity_operator(3), b));
+
+    grabin::matrix<Value> S(12, 12);
+    for(auto const & p : grabin::view::indices(3))
+    for(auto const & q : grabin::view::indices(4))
+    {
+        for(auto const & i : grabin::view::indices(3))
+        {
+            S(p*4 + q, i*4 + q) += a(p, i);
+        }
+
+        for(auto const & j : grabin::view::indices(4))
+        {
+            S(p*4 + q, p*4 + j) += b(q, j);
+        }
+    }
+
+    auto const z = make_random_vector<Value>(12);
+
+    Vector w(12);
+    kronecker_sum.apply(z, w);
+    CHECK(w == Vector(S * z));
+}
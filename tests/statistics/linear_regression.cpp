@@ -277,3 +277,128 @@ TEST_CASE("linear regression multy-variable: regression")
     CHECK_THAT(acc.intercept(), Catch::Matchers::WithinAbs(beta, 1e-3));
     CHECK_THAT(acc.slope(), grabin_test::Matchers::elementwise_within_abs(alpha, 1e-3));
 }
+
+#include <grabin/math/fixed_matrix.hpp>
+
+TEST_CASE("linear regression multy-variable: fixed dimension")
+{
+    using Output = double;
+    using Input = grabin::fixed_math_vector<double, 2>;
+    using Counter = std::size_t;
+
+    auto const beta = -42.5605978118;
+    auto const alpha = Input{76.6734388259, 27.1004337164};
+    auto const gamma = -2.5101011538;
+
+    using grabin::v1::statistics::linear_regression_accumulator;
+    using Accumulator
+        = linear_regression_accumulator<Input, Counter, grabin::linear_algebra::inner_product,
+                                        grabin::linear_algebra::outer_product,
+                                        grabin::linear_algebra::LU_solver>;
+
+    static_assert(std::is_same<Accumulator::covariance_type, Input>::value, "");
+
+    Accumulator acc{Input{}};
+
+    for(auto const & i : grabin::view::indices(12))
+    for(auto const & j : grabin::view::indices(12))
+    {
+        auto const x = Input{static_cast<double>(i), j + gamma * i};
+        Output const y = grabin::linear_algebra::inner_prod(alpha, x) + beta;
+
+        acc(x, y);
+    }
+
+    CHECK_THAT(acc.intercept(), Catch::Matchers::WithinAbs(beta, 1e-3));
+    CHECK_THAT(acc.slope(), grabin_test::Matchers::elementwise_within_abs(alpha, 1e-3));
+}
+
+#include <grabin/math/symmetric_matrix.hpp>
+
+TEST_CASE("linear regression multy-variable: symmetric solvers")
+{
+    using Output = double;
+    using Input = grabin::math_vector<double>;
+    using Counter = std::size_t;
+
+    auto const beta = -42.5605978118;
+    auto const alpha = Input{76.6734388259, 27.1004337164, -3.25};
+    auto const gamma = -2.5101011538;
+
+    using grabin::v1::statistics::linear_regression_accumulator;
+
+    linear_regression_accumulator<Input, Counter, grabin::linear_algebra::inner_product,
+                                  grabin::linear_algebra::outer_product,
+                                  grabin::linear_algebra::cholesky_solver>
+        acc_dense(Input(3));
+
+    linear_regression_accumulator<Input, Counter, grabin::linear_algebra::inner_product,
+                                  grabin::linear_algebra::symmetric_outer_product,
+                                  grabin::linear_algebra::cholesky_solver>
+        acc_packed(Input(3));
+
+    linear_regression_accumulator<Input, Counter, grabin::linear_algebra::inner_product,
+                                  grabin::linear_algebra::symmetric_outer_product,
+                                  grabin::linear_algebra::LDLT_solver>
+        acc_ldlt(Input(3));
+
+    for(auto const & i : grabin::view::indices(8))
+    for(auto const & j : grabin::view::indices(8))
+    for(auto const & k : grabin::view::indices(3))
+    {
+        auto const x = Input{static_cast<double>(i), j + gamma * i, k * 1.0 + i * j};
+        Output const y = grabin::linear_algebra::inner_prod(alpha, x) + beta;
+
+        acc_dense(x, y);
+        acc_packed(x, y);
+        acc_ldlt(x, y);
+    }
+
+    CHECK_THAT(acc_dense.intercept(), Catch::Matchers::WithinAbs(beta, 1e-6));
+    CHECK_THAT(acc_dense.slope(), grabin_test::Matchers::elementwise_within_abs(alpha, 1e-6));
+
+    CHECK_THAT(acc_packed.intercept(), Catch::Matchers::WithinAbs(beta, 1e-6));
+    CHECK_THAT(acc_packed.slope(), grabin_test::Matchers::elementwise_within_abs(alpha, 1e-6));
+
+    CHECK_THAT(acc_ldlt.intercept(), Catch::Matchers::WithinAbs(beta, 1e-6));
+    CHECK_THAT(acc_ldlt.slope(), grabin_test::Matchers::elementwise_within_abs(alpha, 1e-6));
+}
+
+TEST_CASE("linear regression multy-variable: linearly dependent inputs")
+{
+    using Output = double;
+    using Input = grabin::math_vector<double>;
+    using Counter = std::size_t;
+
+    auto const beta = 3.5;
+    auto const alpha = Input{2.0, -1.0};
+
+    // Второй вход пропорционален первому, ковариационная матрица вырождена
+    std::vector<Input> xs;
+    for(auto const & i : grabin::view::indices(20))
+    {
+        xs.push_back(Input{i * 0.5, i * 1.5});
+    }
+
+    using grabin::v1::statistics::linear_regression_accumulator;
+    linear_regression_accumulator<Input, Counter, grabin::linear_algebra::inner_product,
+                                  grabin::linear_algebra::symmetric_outer_product,
+                                  grabin::linear_algebra::LDLT_solver>
+        acc(Input(2));
+
+    for(auto const & x : xs)
+    {
+        acc(x, Output(grabin::linear_algebra::inner_prod(alpha, x) + beta));
+    }
+
+    // Коэффициенты не единственны, но прогнозы должны совпадать
+    auto const slope = acc.slope();
+
+    for(auto const & x : xs)
+    {
+        auto const expected = grabin::linear_algebra::inner_prod(alpha, x) + beta;
+        auto const predicted = grabin::linear_algebra::inner_prod(slope, x) + acc.intercept();
+
+        CHECK(predicted == Approx(expected).margin(1e-9));
+    }
+}
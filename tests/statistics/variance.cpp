@@ -192,3 +192,193 @@ TEST_CASE("covariance_matrix")
     CHECK_THAT(acc.mean(), grabin_test::Matchers::elementwise_within_abs(m_obj, 1e-10));
     CHECK_THAT(acc.variance(), grabin_test::Matchers::elementwise_within_abs(C_obj, 1e-10));
 }
+
+#include <grabin/math/fixed_matrix.hpp>
+
+TEST_CASE("covariance_matrix : fixed dimension")
+{
+    using Value = double;
+    using Vector = grabin::fixed_math_vector<Value, 2>;
+    using Dynamic_vector = grabin::math_vector<Value>;
+
+    using Product = grabin::linear_algebra::outer_product;
+    using Accumulator = grabin::statistics::variance_accumulator<Vector, int, Product>;
+
+    // Промежуточные значения не требуют выделения динамической памяти
+    static_assert(std::is_same<Accumulator::mean_type, Vector>::value, "");
+    static_assert(std::is_same<Accumulator::variance_type,
+                               grabin::fixed_matrix<Value, 2, 2>>::value, "");
+
+    // Результат совпадает с результатом для векторов динамической размерности
+    auto property = [](grabin_test::container_size<int> n)
+    {
+        std::uniform_int_distribution<int> distr(-100, 100);
+        auto & rnd = grabin_test::random_engine();
+
+        Accumulator acc(Vector{});
+        grabin::statistics::variance_accumulator<Dynamic_vector, int, Product>
+            acc_dynamic(Dynamic_vector(2));
+
+        for(auto const & i : grabin::view::indices(n.value))
+        {
+            auto const x1 = Value(distr(rnd));
+            auto const x2 = Value(distr(rnd) + i);
+
+            acc(Vector{x1, x2});
+            acc_dynamic(Dynamic_vector{x1, x2});
+        }
+
+        CHECK(acc.count() == acc_dynamic.count());
+        CHECK_THAT(acc.mean(),
+                   grabin_test::Matchers::elementwise_within_abs(Vector(acc_dynamic.mean()), 1e-10));
+
+        auto const C = acc.variance();
+        auto const C_obj = acc_dynamic.variance();
+
+        for(auto const & i : grabin::view::indices(2))
+        for(auto const & j : grabin::view::indices(2))
+        {
+            CHECK_THAT(C(i, j), Catch::Matchers::WithinAbs(C_obj(i, j), 1e-8));
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+#include <grabin/math/symmetric_matrix.hpp>
+
+TEST_CASE("covariance_matrix : symmetric packed storage")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    using Accumulator = grabin::statistics::variance_accumulator<Vector, int, grabin::linear_algebra::outer_product>;
+    using Symmetric_accumulator
+        = grabin::statistics::variance_accumulator<Vector, int, grabin::linear_algebra::symmetric_outer_product>;
+
+    static_assert(std::is_same<Symmetric_accumulator::variance_type,
+                               grabin::symmetric_matrix<Value>>::value, "");
+
+    // Результат совпадает с результатом для плотной матрицы
+    auto property = [](grabin_test::container_size<int> n)
+    {
+        auto const dim = 5;
+
+        std::uniform_real_distribution<Value> distr(-100, 100);
+        auto & rnd = grabin_test::random_engine();
+
+        Accumulator acc{Vector(dim)};
+        Symmetric_accumulator acc_symmetric{Vector(dim)};
+
+        for(auto const & i : grabin::view::indices(n.value))
+        {
+            Vector x(dim);
+            grabin::generate(x, [&]{ return distr(rnd); });
+            x[0] += i;
+
+            acc(x);
+            acc_symmetric(x);
+        }
+
+        CHECK(acc_symmetric.count() == acc.count());
+        CHECK_THAT(acc_symmetric.mean(), grabin_test::Matchers::elementwise_within_abs(acc.mean(), 1e-10));
+
+        auto const C = acc_symmetric.variance();
+        auto const C_obj = acc.variance();
+
+        REQUIRE(C.dim() == C_obj.dim());
+
+        for(auto const & i : grabin::view::indices(dim))
+        for(auto const & j : grabin::view::indices(dim))
+        {
+            CHECK_THAT(C(i, j), Catch::Matchers::WithinAbs(C_obj(i, j), 1e-6));
+        }
+    };
+
+    grabin_test::check(property);
+}
+
+namespace
+{
+    // Внешнее произведение без функции-члена accumulate
+    struct outer_product_without_accumulate
+    {
+        template <class Vector>
+        grabin::matrix<typename Vector::value_type>
+        operator()(Vector const & x, Vector const & y) const
+        {
+            return grabin::linear_algebra::outer_product{}(x, y);
+        }
+    };
+
+    // Внешнее произведение, подсчитывающее вызовы
+    struct counting_outer_product
+     : grabin::linear_algebra::outer_product
+    {
+        template <class Vector>
+        auto operator()(Vector const & x, Vector const & y) const
+        {
+            ++ *products;
+            return grabin::linear_algebra::outer_product::operator()(x, y);
+        }
+
+        template <class Matrix, class Scalar, class Vector>
+        void accumulate(Matrix & A, Scalar const & alpha, Vector const & x, Vector const & y) const
+        {
+            ++ *updates;
+            return grabin::linear_algebra::outer_product::accumulate(A, alpha, x, y);
+        }
+
+        static int * products;
+        static int * updates;
+    };
+
+    int * counting_outer_product::products = nullptr;
+    int * counting_outer_product::updates = nullptr;
+}
+
+TEST_CASE("covariance_matrix : in-place rank one update")
+{
+    using Value = double;
+    using Vector = grabin::math_vector<Value>;
+
+    auto property = [](grabin_test::container_size<int> n)
+    {
+        auto const dim = 7;
+
+        std::uniform_real_distribution<Value> distr(-100, 100);
+        auto & rnd = grabin_test::random_engine();
+
+        auto products = 0;
+        auto updates = 0;
+        counting_outer_product::products = &products;
+        counting_outer_product::updates = &updates;
+
+        grabin::statistics::variance_accumulator<Vector, int, counting_outer_product> acc{Vector(dim)};
+        grabin::statistics::variance_accumulator<Vector, int, outer_product_without_accumulate>
+            acc_obj{Vector(dim)};
+
+        // Вспомогательный вектор хранится, только если он используется
+        static_assert(sizeof(acc_obj) < sizeof(acc), "");
+
+        for(auto const & i : grabin::view::indices(n.value))
+        {
+            Vector x(dim);
+            grabin::generate(x, [&]{ return distr(rnd); });
+            x[i % dim] += i;
+
+            acc(x);
+            acc_obj(x);
+        }
+
+        // Матрица создаётся только один раз, в конструкторе
+        CHECK(products == 1);
+        CHECK(updates == n.value);
+
+        CHECK(acc.count() == acc_obj.count());
+        CHECK_THAT(acc.mean(), grabin_test::Matchers::elementwise_within_abs(acc_obj.mean(), 1e-10));
+        CHECK_THAT(acc.variance(), grabin_test::Matchers::elementwise_within_abs(acc_obj.variance(), 1e-8));
+    };
+
+    grabin_test::check(property);
+}
@@ -0,0 +1,58 @@
+/* (c) 2019 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки Grabin.
+
+Grabin -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#include <grabin/utility/no_init.hpp>
+
+#include <catch2/catch.hpp>
+
+namespace
+{
+    struct with_no_init
+    {
+        with_no_init(int n)
+         : size(n)
+         , initialized(true)
+        {}
+
+        with_no_init(int n, grabin::no_init_t)
+         : size(n)
+         , initialized(false)
+        {}
+
+        int size;
+        bool initialized;
+    };
+
+    struct without_no_init
+    {
+        without_no_init(int n)
+         : size(n)
+        {}
+
+        int size;
+    };
+}
+
+TEST_CASE("make_no_init")
+{
+    auto const x = grabin::make_no_init<with_no_init>(3);
+    CHECK(x.size == 3);
+    CHECK_FALSE(x.initialized);
+
+    auto const y = grabin::make_no_init<without_no_init>(5);
+    CHECK(y.size == 5);
+}